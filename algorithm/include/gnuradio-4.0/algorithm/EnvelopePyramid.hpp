@@ -0,0 +1,253 @@
+#ifndef GNURADIO_ENVELOPE_PYRAMID_HPP
+#define GNURADIO_ENVELOPE_PYRAMID_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace gr::graphs {
+
+/**
+ * @brief multi-resolution (mip-map-like) min/max/mean envelope of the most recent `capacity()` samples of a stream
+ *
+ * Level 0 stores the raw samples, level L > 0 stores one envelope per `decimation^L` consecutive samples (aligned to
+ * the first pushed sample). The levels are updated incrementally while pushing (amortised O(1) per sample), so that
+ * an envelope of 'nPoints' covering an arbitrary number of recent samples is computed in O(nPoints * decimation)
+ * rather than O(nSamples) -- e.g. to display a 100 MS/s stream on a ~2000 pixel wide chart.
+ *
+ * Example:
+ * @code
+ * gr::graphs::EnvelopePyramid<float> pyramid(1'000'000UZ);
+ * pyramid.push_back_bulk(samples);
+ * std::vector<gr::graphs::EnvelopePyramid<float>::Envelope> points(2000UZ);
+ * const auto range = pyramid.envelope(points, 500'000UZ); // 2000 points spanning the last 500k samples
+ * @endcode
+ *
+ * N.B. not thread-safe: concurrent writers and readers need to be synchronised externally.
+ */
+template<typename T, std::size_t decimation = 8UZ>
+    requires std::is_arithmetic_v<T> && (decimation >= 2UZ)
+class EnvelopePyramid {
+public:
+    struct Envelope {
+        T min;
+        T max;
+        T mean;
+    };
+
+    struct Range {
+        std::size_t   nPoints     = 0UZ; // number of valid points
+        std::uint64_t firstSample = 0U;  // absolute index (w.r.t. the first pushed sample) of the first covered sample
+        std::uint64_t endSample   = 0U;  // absolute index past the last covered sample
+        std::size_t   bucketSize  = 1UZ; // resolution, i.e. sections consist of an integer number of buckets
+    };
+
+private:
+    struct Bucket {
+        T      min;
+        T      max;
+        double sum;
+
+        constexpr void
+        merge(const Bucket &other) noexcept {
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+            sum += other.sum;
+        }
+    };
+
+    struct Level {
+        std::vector<Bucket> buckets; // ring buffer of completed buckets
+        std::uint64_t       nCompleted  = 0U;
+        Bucket              partial     = {};
+        std::size_t         partialFill = 0UZ; // number of buckets (samples for level 1) merged into 'partial'
+    };
+
+    std::vector<T>     _samples; // level 0 ring buffer
+    std::uint64_t      _nSamples = 0U;
+    std::vector<Level> _levels; // _levels[L - 1] <-> level L
+
+public:
+    explicit EnvelopePyramid(std::size_t capacity) : _samples(std::max(capacity, 1UZ)) {
+        for (std::size_t bucketSize = decimation; bucketSize <= _samples.size(); bucketSize *= decimation) {
+            _levels.emplace_back(Level{ .buckets = std::vector<Bucket>(_samples.size() / bucketSize + 1UZ) });
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    capacity() const noexcept {
+        return _samples.size();
+    }
+
+    /// @return number of retained samples
+    [[nodiscard]] constexpr std::size_t
+    size() const noexcept {
+        return static_cast<std::size_t>(std::min(_nSamples, static_cast<std::uint64_t>(_samples.size())));
+    }
+
+    /// @return total number of samples pushed since construction or the last reset()
+    [[nodiscard]] constexpr std::uint64_t
+    nSamplesTotal() const noexcept {
+        return _nSamples;
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    nLevels() const noexcept {
+        return _levels.size() + 1UZ;
+    }
+
+    void
+    reset() noexcept {
+        _nSamples = 0U;
+        for (Level &level : _levels) {
+            level.nCompleted  = 0U;
+            level.partialFill = 0UZ;
+        }
+    }
+
+    void
+    push_back(const T &value) noexcept {
+        push_back_bulk(std::span<const T>(&value, 1UZ));
+    }
+
+    void
+    push_back_bulk(std::span<const T> data) noexcept {
+        if (data.size() > _samples.size()) { // older samples would be overwritten immediately, but they still count for the coarse levels
+            const auto skipped = data.first(data.size() - _samples.size());
+            updateLevels(skipped);
+            _nSamples += skipped.size();
+            data = data.last(_samples.size());
+        }
+        const auto offset = static_cast<std::size_t>(_nSamples % _samples.size());
+        const auto nFirst = std::min(data.size(), _samples.size() - offset);
+        std::ranges::copy(data.first(nFirst), _samples.begin() + static_cast<std::ptrdiff_t>(offset));
+        std::ranges::copy(data.subspan(nFirst), _samples.begin());
+        updateLevels(data);
+        _nSamples += data.size();
+    }
+
+    /**
+     * brings this pyramid -- a previous copy of 'source' -- up to date by re-pushing the samples 'source' received since,
+     * i.e. in O(#new samples) as long as these are still retained by 'source', and falls back to a full copy otherwise.
+     * Used to maintain snapshots for concurrent readers w/o copying the whole pyramid for every update.
+     */
+    void
+    sync(const EnvelopePyramid &source) {
+        if (_samples.size() != source._samples.size() || _nSamples > source._nSamples || source._nSamples - _nSamples > source.size()) {
+            *this = source;
+            return;
+        }
+        const auto nNew   = static_cast<std::size_t>(source._nSamples - _nSamples);
+        const auto offset = static_cast<std::size_t>(_nSamples % _samples.size());
+        const auto nFirst = std::min(nNew, _samples.size() - offset);
+        push_back_bulk(std::span<const T>(source._samples).subspan(offset, nFirst));
+        push_back_bulk(std::span<const T>(source._samples).first(nNew - nFirst));
+    }
+
+    /**
+     * Fills 'points' with the envelopes of consecutive, (nearly) equally long sections spanning the last 'nSamples'
+     * retained samples. The sections are aligned to the buckets of the coarsest level with `decimation^L <= nSamples / points.size()`,
+     * thus the latest, incomplete bucket (i.e. less than one section) is not yet covered.
+     * @return number of filled points and the absolute range of covered samples
+     */
+    [[nodiscard]] Range
+    envelope(std::span<Envelope> points, std::size_t nSamples) const noexcept {
+        nSamples = std::min(nSamples, size());
+        if (points.empty() || nSamples == 0UZ) {
+            return { 0UZ, _nSamples, _nSamples, 1UZ };
+        }
+
+        const std::size_t samplesPerPoint = std::max(nSamples / points.size(), 1UZ);
+        std::size_t       level           = 0UZ;
+        std::size_t       bucketSize      = 1UZ;
+        while (level < _levels.size() && bucketSize * decimation <= samplesPerPoint) {
+            bucketSize *= decimation;
+            ++level;
+        }
+
+        const std::uint64_t nCompleted = level == 0UZ ? _nSamples : _levels[level - 1UZ].nCompleted;
+        const std::uint64_t nRetained  = level == 0UZ ? size() : std::min(nCompleted, static_cast<std::uint64_t>(_levels[level - 1UZ].buckets.size()));
+        const std::uint64_t nBuckets   = std::min(static_cast<std::uint64_t>(nSamples / bucketSize), nRetained);
+        const std::size_t   nPoints    = static_cast<std::size_t>(std::min(static_cast<std::uint64_t>(points.size()), nBuckets));
+        const std::uint64_t first      = nCompleted - nBuckets;
+
+        for (std::size_t i = 0UZ; i < nPoints; ++i) {
+            const std::uint64_t begin  = first + i * nBuckets / nPoints;
+            const std::uint64_t end    = first + (i + 1UZ) * nBuckets / nPoints;
+            Bucket              merged = bucketAt(level, begin);
+            for (std::uint64_t index = begin + 1U; index < end; ++index) {
+                merged.merge(bucketAt(level, index));
+            }
+            points[i] = { merged.min, merged.max, static_cast<T>(merged.sum / static_cast<double>((end - begin) * bucketSize)) };
+        }
+        return { nPoints, first * bucketSize, nCompleted * bucketSize, bucketSize };
+    }
+
+private:
+    [[nodiscard]] Bucket
+    bucketAt(std::size_t level, std::uint64_t index) const noexcept {
+        if (level == 0UZ) {
+            const T &value = _samples[static_cast<std::size_t>(index % _samples.size())];
+            return { value, value, static_cast<double>(value) };
+        }
+        const auto &buckets = _levels[level - 1UZ].buckets;
+        return buckets[static_cast<std::size_t>(index % buckets.size())];
+    }
+
+    void
+    updateLevels(std::span<const T> data) noexcept {
+        if (_levels.empty()) {
+            return;
+        }
+        Level &level1 = _levels.front();
+        while (!data.empty()) {
+            const auto chunk       = data.first(std::min(data.size(), decimation - level1.partialFill));
+            const auto [min, max]  = std::ranges::minmax(chunk);
+            Bucket     chunkBucket = { min, max, 0. };
+            for (const T &value : chunk) {
+                chunkBucket.sum += static_cast<double>(value);
+            }
+            if (level1.partialFill == 0UZ) {
+                level1.partial = chunkBucket;
+            } else {
+                level1.partial.merge(chunkBucket);
+            }
+            level1.partialFill += chunk.size();
+            if (level1.partialFill == decimation) {
+                completeBucket(0UZ);
+            }
+            data = data.subspan(chunk.size());
+        }
+    }
+
+    void
+    completeBucket(std::size_t levelIndex) noexcept {
+        for (; levelIndex < _levels.size(); ++levelIndex) {
+            Level       &level     = _levels[levelIndex];
+            const Bucket completed = level.partial;
+            level.buckets[static_cast<std::size_t>(level.nCompleted % level.buckets.size())] = completed;
+            ++level.nCompleted;
+            level.partialFill = 0UZ;
+            if (levelIndex + 1UZ == _levels.size()) {
+                return;
+            }
+
+            Level &parent = _levels[levelIndex + 1UZ];
+            if (parent.partialFill == 0UZ) {
+                parent.partial = completed;
+            } else {
+                parent.partial.merge(completed);
+            }
+            if (++parent.partialFill < decimation) {
+                return;
+            }
+        }
+    }
+};
+
+} // namespace gr::graphs
+
+#endif // GNURADIO_ENVELOPE_PYRAMID_HPP
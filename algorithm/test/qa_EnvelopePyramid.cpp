@@ -0,0 +1,115 @@
+#include <boost/ut.hpp>
+
+#include <random>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/algorithm/EnvelopePyramid.hpp>
+
+const boost::ut::suite EnvelopePyramidTests = [] {
+    using namespace boost::ut;
+    using namespace gr::graphs;
+
+    "basic envelope"_test = [] {
+        EnvelopePyramid<float, 2UZ> pyramid(16UZ);
+        expect(eq(pyramid.capacity(), 16UZ));
+        expect(eq(pyramid.nLevels(), 5UZ));
+        expect(eq(pyramid.size(), 0UZ));
+
+        std::vector<EnvelopePyramid<float, 2UZ>::Envelope> points(4UZ);
+        expect(eq(pyramid.envelope(points, 16UZ).nPoints, 0UZ)) << "empty pyramid";
+
+        for (int i = 0; i < 16; ++i) {
+            pyramid.push_back(static_cast<float>(i));
+        }
+        const auto range = pyramid.envelope(points, 16UZ);
+        expect(eq(range.nPoints, 4UZ));
+        expect(eq(range.firstSample, 0UZ));
+        expect(eq(range.endSample, 16UZ));
+        for (std::size_t i = 0UZ; i < points.size(); ++i) {
+            expect(eq(points[i].min, static_cast<float>(4UZ * i)));
+            expect(eq(points[i].max, static_cast<float>(4UZ * i + 3UZ)));
+            expect(eq(points[i].mean, static_cast<float>(4UZ * i) + 1.5f));
+        }
+
+        pyramid.reset();
+        expect(eq(pyramid.size(), 0UZ));
+        expect(eq(pyramid.envelope(points, 16UZ).nPoints, 0UZ)) << "after reset";
+    };
+
+    "envelope vs. brute-force reference"_test = [] {
+        constexpr std::size_t                      capacity = 100'000UZ;
+        EnvelopePyramid<float>                     pyramid(capacity);
+        std::vector<float>                         history; // all samples ever pushed
+        std::mt19937                               rng(42);
+        std::normal_distribution<float>            noise(0.f, 1.f);
+        std::uniform_int_distribution<std::size_t> chunkSize(1UZ, 30'000UZ);
+
+        for (std::size_t iteration = 0UZ; iteration < 20UZ; ++iteration) {
+            std::vector<float> chunk(chunkSize(rng));
+            std::ranges::generate(chunk, [&] { return noise(rng); });
+            if (iteration % 2UZ == 0UZ) {
+                pyramid.push_back_bulk(chunk);
+            } else {
+                std::ranges::for_each(chunk, [&pyramid](float x) { pyramid.push_back(x); });
+            }
+            history.insert(history.end(), chunk.begin(), chunk.end());
+            expect(eq(pyramid.nSamplesTotal(), history.size()));
+            expect(eq(pyramid.size(), std::min(history.size(), capacity)));
+
+            for (const auto &[nPoints, nSamples] : { std::pair{ 2000UZ, capacity }, std::pair{ 100UZ, 1000UZ }, std::pair{ 500UZ, 333UZ }, std::pair{ 7UZ, 50'000UZ } }) {
+                std::vector<EnvelopePyramid<float>::Envelope> points(nPoints);
+                const auto                                    range = pyramid.envelope(points, nSamples);
+                expect(le(range.endSample, history.size()));
+                expect(le(history.size() - range.endSample, std::max(nSamples / nPoints, 1UZ))) << "lags less than one point";
+                expect(le(range.endSample - range.firstSample, static_cast<std::uint64_t>(nSamples)));
+                expect(le(range.nPoints, nPoints));
+
+                expect(gt(range.nPoints, 0UZ));
+                const std::uint64_t nBuckets = (range.endSample - range.firstSample) / range.bucketSize;
+                bool                ok       = true;
+                for (std::size_t i = 0UZ; i < range.nPoints; ++i) {
+                    const auto begin = history.begin() + static_cast<std::ptrdiff_t>(range.firstSample + i * nBuckets / range.nPoints * range.bucketSize);
+                    const auto end   = history.begin() + static_cast<std::ptrdiff_t>(range.firstSample + (i + 1UZ) * nBuckets / range.nPoints * range.bucketSize);
+                    double     sum   = 0.;
+                    std::for_each(begin, end, [&sum](float x) { sum += static_cast<double>(x); });
+                    const auto mean = static_cast<float>(sum / static_cast<double>(std::distance(begin, end)));
+                    ok              = ok && points[i].min == *std::min_element(begin, end) && points[i].max == *std::max_element(begin, end) && std::abs(points[i].mean - mean) < 1e-5f;
+                }
+                expect(ok) << fmt::format("iteration {} - {} points over {} samples", iteration, nPoints, nSamples);
+            }
+        }
+    };
+
+    "incremental sync of a snapshot"_test = [] {
+        constexpr std::size_t  capacity = 1000UZ;
+        EnvelopePyramid<float> source(capacity);
+        EnvelopePyramid<float> snapshot(capacity);
+        std::vector<float>     chunk;
+        float                  value = 0.f;
+        const auto             same  = [&source, &snapshot] {
+            std::vector<EnvelopePyramid<float>::Envelope> expected(50UZ);
+            std::vector<EnvelopePyramid<float>::Envelope> actual(50UZ);
+            const auto                                    rangeExpected = source.envelope(expected, capacity);
+            const auto                                    rangeActual   = snapshot.envelope(actual, capacity);
+            return rangeExpected.firstSample == rangeActual.firstSample && rangeExpected.endSample == rangeActual.endSample && std::ranges::equal(expected, actual, [](const auto &a, const auto &b) { return a.min == b.min && a.max == b.max; });
+        };
+
+        for (std::size_t nSamples : { 10UZ, 333UZ, 999UZ, 1000UZ, 2500UZ, 7UZ }) { // N.B. > capacity -> falls back to a full copy
+            chunk.resize(nSamples);
+            std::ranges::generate(chunk, [&value] { return value++; });
+            source.push_back_bulk(chunk);
+            snapshot.sync(source);
+            expect(eq(snapshot.nSamplesTotal(), source.nSamplesTotal()));
+            expect(same()) << fmt::format("after pushing {} samples", nSamples);
+        }
+
+        source.reset();
+        snapshot.sync(source); // snapshot ahead of source -> full copy
+        expect(eq(snapshot.nSamplesTotal(), 0UZ));
+    };
+};
+
+int
+main() { /* tests are statically executed */
+}
@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <charconv>
 #include <chrono>
+#include <cmath>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <mutex>
@@ -926,10 +928,87 @@ public:
             std::cout << _printer.colors().pass << "all micro-benchmarks passed:\n" << _printer.colors().none;
         }
         print();
+        if (const char *file_name = std::getenv("BM_OUTPUT_FILE"); file_name != nullptr) {
+            export_results(file_name);
+        }
         std::cerr.flush();
         std::cout.flush();
     }
 
+    /**
+     * writes all results in a machine-readable format to 'file_name' to allow tracking of benchmarks across releases.
+     * The format is derived from the file extension: '.json' -> JSON, otherwise CSV with one 'benchmark,metric,value,unit' line per metric.
+     * Values are exported in their base unit (i.e. w/o SI-prefix scaling).
+     */
+    static void
+    export_results(std::string_view file_name) {
+        std::ofstream out{ std::string(file_name) };
+        if (!out) {
+            fmt::print(stderr, "benchmark::results: could not open '{}' for writing\n", file_name);
+            return;
+        }
+        const bool json  = file_name.ends_with(".json");
+        const auto value = [](const auto &variant) -> std::string {
+            if (std::holds_alternative<long double>(variant)) {
+                return std::isfinite(std::get<long double>(variant)) ? fmt::format("{}", std::get<long double>(variant)) : std::string{};
+            } else if (std::holds_alternative<uint64_t>(variant)) {
+                return fmt::format("{}", std::get<uint64_t>(variant));
+            } else if (std::holds_alternative<benchmark::perf_sub_metric>(variant)) {
+                return fmt::format("{}", std::get<benchmark::perf_sub_metric>(variant).ratio);
+            }
+            return {};
+        };
+        const auto name = [](std::string_view test_name) { // strip the tree-drawing prefix used for marker sub-results
+            const auto first = test_name.find_first_not_of(" ├└─");
+            return std::string(first == std::string_view::npos ? std::string_view{} : test_name.substr(first, test_name.find_last_not_of(' ') - first + 1UZ));
+        };
+        const auto escape = [json](std::string_view str) { // JSON: \" and \\, CSV (RFC 4180): ""
+            std::string result;
+            for (const char c : str) {
+                if (json ? (c == '"' || c == '\\') : c == '"') {
+                    result.push_back(json ? '\\' : '"');
+                }
+                result.push_back(c);
+            }
+            return result;
+        };
+
+        std::string parent;
+        bool        first_entry = true;
+        out << (json ? "[" : "benchmark,metric,value,unit\n");
+        for (const auto &[test_name, result_map] : benchmark::results::data()) {
+            if (test_name.empty()) { // separator
+                continue;
+            }
+            const bool is_child = test_name.starts_with(' ');
+            const auto full_name = is_child ? fmt::format("{}/{}", parent, name(test_name)) : name(test_name);
+            if (!is_child) {
+                parent = full_name;
+            }
+            std::map<std::string_view, std::pair<std::string, std::string_view>> sorted_metrics; // metric -> {value, unit}, stable order across runs
+            for (const auto &[metric_key, entry] : result_map) {
+                if (auto str = value(std::get<0>(entry)); !str.empty()) {
+                    sorted_metrics.try_emplace(metric_key, std::move(str), std::get<1>(entry));
+                }
+            }
+            if (json) {
+                out << (first_entry ? "\n" : ",\n") << fmt::format(R"(  {{ "benchmark": "{}", "metrics": {{)", escape(full_name));
+                bool first_metric = true;
+                for (const auto &[metric_key, metric] : sorted_metrics) {
+                    out << (first_metric ? " " : ", ") << fmt::format(R"("{}": {{ "value": {}, "unit": "{}" }})", escape(metric_key), metric.first, escape(metric.second));
+                    first_metric = false;
+                }
+                out << " } }";
+            } else {
+                for (const auto &[metric_key, metric] : sorted_metrics) {
+                    out << fmt::format("\"{}\",\"{}\",{},\"{}\"\n", escape(full_name), escape(metric_key), metric.first, escape(metric.second));
+                }
+            }
+            first_entry = false;
+        }
+        out << (json ? "\n]\n" : "");
+    }
+
     template<std::size_t SIGNIFICANT_DIGITS = 3>
     static void
     print() {
@@ -7,11 +7,18 @@
 #include <gnuradio-4.0/DataSet.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 #include <gnuradio-4.0/Tag.hpp>
+#include <gnuradio-4.0/algorithm/EnvelopePyramid.hpp>
 
 #include <any>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <deque>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace gr::basic {
 
@@ -175,6 +182,14 @@ public:
         return sink ? sink->getSnapshotPoller(std::forward<M>(matcher), delay, block) : nullptr;
     }
 
+    template<typename T>
+    std::shared_ptr<typename DataSink<T>::EnvelopePoller>
+    getEnvelopePoller(const DataSinkQuery &query, std::size_t historySize) {
+        std::lock_guard lg{ _mutex };
+        auto            sink = findSink<T>(query);
+        return sink ? sink->getEnvelopePoller(historySize) : nullptr;
+    }
+
     template<typename T, StreamCallback<T> Callback>
     bool
     registerStreamingCallback(const DataSinkQuery &query, std::size_t maxChunkSize, Callback &&callback) {
@@ -309,6 +324,36 @@ tagAndMetadata(const std::optional<property_map> &tagData, const std::optional<M
     return merged;
 }
 
+/**
+ * re-initialises a (recycled) data set from the template in place: the per-trigger containers are cleared and refilled
+ * (retaining their capacity), the axis and signal metadata -- invariant unless the sink's settings change -- is only
+ * re-assigned if it differs from the template.
+ */
+template<typename T>
+inline void
+resetDataSet(DataSet<T> &dataSet, const DataSet<T> &tmpl) {
+    auto assignIfChanged = [](auto &field, const auto &value) {
+        if (field != value) {
+            field = value;
+        }
+    };
+    dataSet.timestamp = tmpl.timestamp;
+    dataSet.layout    = tmpl.layout; // N.B. layout tags are not equality-comparable
+    assignIfChanged(dataSet.axis_names, tmpl.axis_names);
+    assignIfChanged(dataSet.axis_units, tmpl.axis_units);
+    assignIfChanged(dataSet.axis_values, tmpl.axis_values);
+    assignIfChanged(dataSet.extents, tmpl.extents);
+    assignIfChanged(dataSet.signal_names, tmpl.signal_names);
+    assignIfChanged(dataSet.signal_units, tmpl.signal_units);
+    assignIfChanged(dataSet.signal_ranges, tmpl.signal_ranges);
+    dataSet.signal_values.assign(tmpl.signal_values.begin(), tmpl.signal_values.end());
+    dataSet.signal_errors.assign(tmpl.signal_errors.begin(), tmpl.signal_errors.end());
+    dataSet.meta_information.clear();
+    dataSet.meta_information.insert(dataSet.meta_information.end(), tmpl.meta_information.begin(), tmpl.meta_information.end());
+    dataSet.timing_events.resize(1UZ); // DataSink data sets carry a single signal
+    dataSet.timing_events[0].clear();
+}
+
 template<typename T>
 [[nodiscard]] inline DataSet<T>
 makeDataSetTemplate(Metadata metadata) {
@@ -393,13 +438,22 @@ synchronously (/asynchronously) if handled by the same (/different) sink block.
 @tparam T input sample type
 )"">;
     struct AbstractListener;
-
-    static constexpr std::size_t                  _listener_buffer_size = 65536;
-    std::deque<std::unique_ptr<AbstractListener>> _listeners;
-    bool                                          _listeners_finished = false;
-    std::mutex                                    _listener_mutex;
-    std::optional<gr::HistoryBuffer<T>>           _history;
-    bool                                          _registered = false;
+    using ListenerList = std::vector<std::shared_ptr<AbstractListener>>; // immutable once published
+
+    static constexpr std::size_t _listener_buffer_size = 65536;
+    static constexpr std::size_t _recycle_buffer_size  = 64;
+    // RCU-style listener list: writers (registration, pruning) copy the current list under '_listener_mutex' and publish
+    // the copy atomically, the work thread reads the published list w/o locking and protects it via a single hazard pointer.
+    // Replaced lists are retired and reclaimed by the next writer once the work thread no longer uses them.
+    std::mutex                                 _listener_mutex; // serialises writers only
+    std::unique_ptr<ListenerList>              _currentListeners = std::make_unique<ListenerList>();
+    std::atomic<const ListenerList *>          _listeners{ _currentListeners.get() };
+    std::atomic<const ListenerList *>          _listenersInUse{ nullptr }; // hazard pointer of the work thread
+    std::vector<std::unique_ptr<ListenerList>> _retiredListeners;
+    std::atomic<std::size_t>                   _requestedHistorySize = 0UZ; // applied by the work thread
+    bool                                       _listeners_finished   = false;
+    std::optional<gr::HistoryBuffer<T>>        _history;
+    bool                                       _registered = false;
 
 public:
     Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>           sample_rate = 1.f;
@@ -410,39 +464,101 @@ public:
 
     PortIn<T, RequiredSamples<std::dynamic_extent, _listener_buffer_size>> in;
 
+    /**
+     * Samples and their tags as seen by streaming pollers. Blocking pollers attach as additional readers to one stream
+     * shared by the sink (i.e. the sink copies each chunk once, independent of the number of pollers), while each
+     * non-blocking poller reads from a private stream so that samples can be dropped for slow consumers only.
+     * Tag indices are absolute w.r.t. 'samples_written'.
+     */
+    struct StreamBuffer {
+        gr::CircularBuffer<T>             buffer          = gr::CircularBuffer<T>(_listener_buffer_size);
+        decltype(buffer.new_writer())     writer          = buffer.new_writer();
+        gr::CircularBuffer<Tag>           tag_buffer      = gr::CircularBuffer<Tag>(1024);
+        decltype(tag_buffer.new_writer()) tag_writer      = tag_buffer.new_writer();
+        std::size_t                       samples_written = 0; // writer thread
+
+        /// never blocks, @return number of samples written, less than data.size() if readers lag behind ('tagData0' is only consumed if > 0)
+        std::size_t
+        write(std::span<const T> data, std::optional<property_map> &&tagData0) {
+            const auto toWrite = std::min(data.size(), writer.available());
+            if (toWrite == 0 || (tagData0 && tag_writer.available() == 0UZ)) {
+                return 0UZ;
+            }
+            if (tagData0) {
+                auto tw = tag_writer.reserve(1);
+                tw[0]   = { static_cast<Tag::signed_index_type>(samples_written), std::move(*tagData0) };
+                tw.publish(1);
+            }
+            auto writeData = writer.reserve(toWrite);
+            std::ranges::copy(data.first(toWrite), writeData.begin());
+            writeData.publish(toWrite);
+            samples_written += toWrite;
+            return toWrite;
+        }
+    };
+
     struct Poller {
-        // TODO consider whether reusing port<T> here makes sense
-        gr::CircularBuffer<T>             buffer       = gr::CircularBuffer<T>(_listener_buffer_size);
-        decltype(buffer.new_reader())     reader       = buffer.new_reader();
-        decltype(buffer.new_writer())     writer       = buffer.new_writer();
-        gr::CircularBuffer<Tag>           tag_buffer   = gr::CircularBuffer<Tag>(1024);
-        decltype(tag_buffer.new_reader()) tag_reader   = tag_buffer.new_reader();
-        decltype(tag_buffer.new_writer()) tag_writer   = tag_buffer.new_writer();
-        std::size_t                       samples_read = 0; // reader thread
-        std::atomic<bool>                 finished     = false;
-        std::atomic<std::size_t>          drop_count   = 0;
+        using Reader    = decltype(std::declval<gr::CircularBuffer<T> &>().new_reader());
+        using TagReader = decltype(std::declval<gr::CircularBuffer<Tag> &>().new_reader());
+
+        /// N.B. co-owned by the sink's listener, which releases them on the writing thread once the poller has been dropped, i.e.
+        /// readers never detach from a stream (modifying its reader list) concurrently to a write
+        struct Readers {
+            Reader    reader;
+            TagReader tag_reader;
+        };
+
+        std::shared_ptr<Readers>    readers;      // attached by the writing thread before the first sample is written
+        std::optional<property_map> initial_tag;  // metadata at the first sample
+        std::size_t                 samples_read = 0; // reader thread, absolute stream position
+        std::atomic<bool>           attached     = false;
+        std::atomic<bool>           finished     = false;
+        std::atomic<std::size_t>    drop_count   = 0;
+
+        /// N.B. to be called by the thread writing to 'stream', @return the readers to be kept (and eventually released) by that thread
+        [[nodiscard]] std::shared_ptr<Readers>
+        attach(StreamBuffer &stream, std::optional<property_map> initialTag) {
+            readers      = std::make_shared<Readers>(stream.buffer.new_reader(), stream.tag_buffer.new_reader());
+            samples_read = stream.samples_written;
+            initial_tag  = std::move(initialTag);
+            attached.store(true, std::memory_order_release);
+            return readers;
+        }
 
         template<typename Handler>
         [[nodiscard]] bool
         process(Handler fnc, std::size_t requested = std::numeric_limits<std::size_t>::max()) {
-            const auto nProcess = std::min(reader.available(), requested);
+            if (!attached.load(std::memory_order_acquire)) {
+                return false;
+            }
+            const auto nProcess = std::min(readers->reader.available(), requested);
             if (nProcess == 0) {
                 return false;
             }
 
-            const auto readData = reader.get(nProcess);
+            const auto readData = readers->reader.get(nProcess); // N.B. zero-copy view into the (possibly shared) stream
             if constexpr (requires { fnc(std::span<const T>(), std::span<const Tag>()); }) {
-                const auto tags         = tag_reader.get();
-                const auto it           = std::find_if_not(tags.begin(), tags.end(), [until = static_cast<int64_t>(samples_read + nProcess)](const auto &tag) { return tag.index < until; });
-                auto       relevantTags = std::vector<Tag>(tags.begin(), it);
-                for (auto &t : relevantTags) {
-                    t.index -= static_cast<int64_t>(samples_read);
+                const auto       tags = readers->tag_reader.get();
+                const auto       it   = std::find_if_not(tags.begin(), tags.end(), [until = static_cast<int64_t>(samples_read + nProcess)](const auto &tag) { return tag.index < until; });
+                std::vector<Tag> relevantTags;
+                relevantTags.reserve(static_cast<std::size_t>(std::distance(tags.begin(), it)) + 1UZ);
+                for (auto tag = tags.begin(); tag != it; ++tag) {
+                    relevantTags.emplace_back(tag->index - static_cast<int64_t>(samples_read), tag->map);
+                }
+                if (initial_tag) {
+                    if (relevantTags.empty() || relevantTags.front().index != 0) {
+                        relevantTags.emplace(relevantTags.begin(), 0, std::move(*initial_tag));
+                    } else {
+                        relevantTags.front().map.insert(initial_tag->begin(), initial_tag->end()); // N.B. stream tag takes precedence
+                    }
+                    initial_tag.reset();
                 }
                 fnc(readData, std::span<const Tag>(relevantTags));
-                std::ignore = tags.consume(relevantTags.size());
+                std::ignore = tags.consume(static_cast<std::size_t>(std::distance(tags.begin(), it)));
             } else {
-                const auto tags = tag_reader.get();
+                const auto tags = readers->tag_reader.get();
                 std::ignore     = tags.consume(tags.size());
+                initial_tag.reset();
                 fnc(readData);
             }
 
@@ -457,6 +573,11 @@ public:
         decltype(buffer.new_reader())  reader = buffer.new_reader();
         decltype(buffer.new_writer())  writer = buffer.new_writer();
 
+        // consumed data sets are handed back to the sink and re-used together with their allocated signal buffers
+        gr::CircularBuffer<DataSet<T>>        recycle_buffer = gr::CircularBuffer<DataSet<T>>(_recycle_buffer_size);
+        decltype(recycle_buffer.new_reader()) recycle_reader = recycle_buffer.new_reader(); // sink thread
+        decltype(recycle_buffer.new_writer()) recycle_writer = recycle_buffer.new_writer(); // reader thread
+
         std::atomic<bool>        finished   = false;
         std::atomic<std::size_t> drop_count = 0;
 
@@ -469,9 +590,89 @@ public:
 
             const auto readData = reader.get(nProcess);
             fnc(readData);
+            recycle(readData);
             std::ignore = readData.consume(nProcess);
             return true;
         }
+
+        /// sink thread: returns a data set initialised from 'tmpl', re-using a consumed one if available
+        [[nodiscard]] DataSet<T>
+        acquire(const DataSet<T> &tmpl, std::size_t nSamples) {
+            DataSet<T> dataSet;
+            if (recycle_reader.available() > 0UZ) {
+                const auto recycled = recycle_reader.get(1UZ);
+                dataSet             = std::move(const_cast<DataSet<T> &>(recycled[0])); // N.B. single reader owns the slot until consume()
+                std::ignore         = recycled.consume(1UZ);
+            }
+            detail::resetDataSet(dataSet, tmpl);
+            dataSet.signal_values.reserve(nSamples);
+            return dataSet;
+        }
+
+    private:
+        void
+        recycle(std::span<const DataSet<T>> consumed) {
+            const auto nRecycle = std::min(consumed.size(), recycle_writer.available()); // N.B. surplus is released with the next overwrite
+            if (nRecycle == 0UZ) {
+                return;
+            }
+            auto recycled = recycle_writer.reserve(nRecycle);
+            for (std::size_t i = 0UZ; i < nRecycle; ++i) {
+                recycled[i] = std::move(const_cast<DataSet<T> &>(consumed[i])); // N.B. single reader owns the slot until consume()
+            }
+            recycled.publish(nRecycle);
+        }
+    };
+
+    /**
+     * Display-oriented acquisition: the sink maintains a multi-resolution min/max/mean envelope of the most recent
+     * 'historySize' samples, so that e.g. a UI can fetch a ~2000 point wide trace of the last T seconds of a 100 MS/s
+     * signal in O(#points) instead of polling and decimating all samples itself.
+     * Never blocks the flow-graph: the sink updates its private pyramid and publishes snapshots through a lock-free triple
+     * buffer, the reader hands the previously used snapshot back in exchange for the latest one. Snapshots are synchronised
+     * incrementally (@see gr::graphs::EnvelopePyramid::sync), i.e. the sink only re-pushes the samples a snapshot missed.
+     * N.B. a triple buffer rather than a FIFO ring so that the sink can re-claim snapshots the reader has not yet taken,
+     * which keeps the reader's view current irrespective of its polling rate (at the cost of four pyramids in memory).
+     */
+    struct EnvelopePoller {
+        using Pyramid  = gr::graphs::EnvelopePyramid<T>;
+        using Envelope = typename Pyramid::Envelope;
+
+        static constexpr std::uint8_t kFresh     = 0x4; // flag: the 'middle' snapshot has not yet been taken by the reader
+        static constexpr std::uint8_t kIndexMask = 0x3;
+
+        std::array<Pyramid, 3UZ>          snapshots;
+        mutable std::atomic<std::uint8_t> middle      = 1U;  // index of the last published snapshot (| kFresh)
+        std::size_t                       back        = 0UZ; // sink thread: snapshot being updated
+        mutable std::size_t               front       = 2UZ; // reader thread(s): snapshot being queried
+        mutable std::mutex                reader_mutex;      // serialises concurrent readers only, never taken by the sink
+        std::atomic<float>                sample_rate = 1.f;
+        std::atomic<bool>                 finished    = false;
+
+        explicit EnvelopePoller(std::size_t historySize) : snapshots{ Pyramid(historySize), Pyramid(historySize), Pyramid(historySize) } {}
+
+        /// sink thread: brings the back snapshot up to date with 'pyramid' and publishes it
+        void
+        publish(const Pyramid &pyramid) {
+            snapshots[back].sync(pyramid);
+            back = static_cast<std::size_t>(middle.exchange(static_cast<std::uint8_t>(back | kFresh), std::memory_order_acq_rel) & kIndexMask);
+        }
+
+        /// fills 'points' with the envelope of the last 'nSamples' samples, @see gr::graphs::EnvelopePyramid::envelope
+        [[nodiscard]] typename Pyramid::Range
+        envelope(std::span<Envelope> points, std::size_t nSamples) const {
+            std::lock_guard lg{ reader_mutex };
+            if ((middle.load(std::memory_order_relaxed) & kFresh) != 0U) {
+                front = static_cast<std::size_t>(middle.exchange(static_cast<std::uint8_t>(front), std::memory_order_acq_rel) & kIndexMask);
+            }
+            return snapshots[front].envelope(points, nSamples);
+        }
+
+        /// fills 'points' with the envelope of the last 'timeSpan' seconds
+        [[nodiscard]] typename Pyramid::Range
+        envelope(std::span<Envelope> points, std::chrono::duration<double> timeSpan) const {
+            return envelope(points, static_cast<std::size_t>(std::max(timeSpan.count(), 0.) * static_cast<double>(sample_rate.load())));
+        }
     };
 
     void
@@ -480,8 +681,9 @@ public:
         if (oldSignalName != signal_name && _registered) {
             DataSinkRegistry::instance().updateSignalName(this, oldSignalName.value_or(""), signal_name);
         }
+        _sharedStreamMetadata = detail::Metadata{ sample_rate, signal_name, signal_unit, signal_min, signal_max };
         std::lock_guard lg{ _listener_mutex };
-        for (auto &listener : _listeners) {
+        for (auto &listener : *_currentListeners) {
             listener->setMetadata(detail::Metadata{ sample_rate, signal_name, signal_unit, signal_min, signal_max });
         }
     }
@@ -492,7 +694,11 @@ public:
         auto            handler = std::make_shared<Poller>();
         std::lock_guard lg(_listener_mutex);
         handler->finished = _listeners_finished;
-        addListener(std::make_unique<ContinuousListener<gr::meta::null_type>>(handler, block, *this), block);
+        if (block) {
+            addListener(std::make_unique<SharedStreamListener>(handler, *this), block);
+        } else {
+            addListener(std::make_unique<ContinuousListener<gr::meta::null_type>>(handler, *this), block);
+        }
         return handler;
     }
 
@@ -503,8 +709,8 @@ public:
         auto            handler = std::make_shared<DataSetPoller>();
         std::lock_guard lg(_listener_mutex);
         handler->finished = _listeners_finished;
+        requestHistorySize(preSamples);
         addListener(std::make_unique<TriggerListener<gr::meta::null_type, M>>(std::forward<M>(matcher), handler, preSamples, postSamples, block), block);
-        ensureHistorySize(preSamples);
         return handler;
     }
 
@@ -528,17 +734,28 @@ public:
         return handler;
     }
 
+    std::shared_ptr<EnvelopePoller>
+    getEnvelopePoller(std::size_t historySize) {
+        auto            handler = std::make_shared<EnvelopePoller>(historySize);
+        std::lock_guard lg(_listener_mutex);
+        handler->finished = _listeners_finished;
+        addListener(std::make_unique<EnvelopeListener>(handler), false);
+        return handler;
+    }
+
     template<StreamCallback<T> Callback>
     void
     registerStreamingCallback(std::size_t maxChunkSize, Callback &&callback) {
+        std::lock_guard lg(_listener_mutex);
         addListener(std::make_unique<ContinuousListener<Callback>>(maxChunkSize, std::forward<Callback>(callback), *this), false);
     }
 
     template<TriggerMatcher M, DataSetCallback<T> Callback>
     void
     registerTriggerCallback(M &&matcher, std::size_t preSamples, std::size_t postSamples, Callback &&callback) {
+        std::lock_guard lg(_listener_mutex);
+        requestHistorySize(preSamples);
         addListener(std::make_unique<TriggerListener<Callback, M>>(std::forward<M>(matcher), preSamples, postSamples, std::forward<Callback>(callback)), false);
-        ensureHistorySize(preSamples);
     }
 
     template<TriggerMatcher M, DataSetCallback<T> Callback>
@@ -566,7 +783,7 @@ public:
         DataSinkRegistry::instance().unregisterSink(this);
         _registered = false;
         std::lock_guard lg(_listener_mutex);
-        for (auto &listener : _listeners) {
+        for (auto &listener : *_currentListeners) {
             listener->stop();
         }
         _listeners_finished = true;
@@ -580,23 +797,112 @@ public:
             tagData = this->mergedInputTag().map;
         }
 
-        {
-            std::lock_guard lg(_listener_mutex); // TODO review/profile if a lock-free data structure should be used here
-            const auto      historyView = _history ? _history->get_span(0) : std::span<const T>();
-            std::erase_if(_listeners, [](const auto &l) { return l->expired; });
-            for (auto &listener : _listeners) {
+        const ListenerList &listeners = acquireListeners();
+        ensureHistorySize(_requestedHistorySize.load());
+        const auto historyView = _history ? _history->get_span(0) : std::span<const T>();
+        bool       anyExpired  = false;
+        for (const auto &listener : listeners) {
+            if (!listener->expired) {
                 listener->process(historyView, inData, tagData);
             }
-            if (_history) {
-                // store potential pre-samples for triggers at the beginning of the next chunk
-                const auto toWrite = std::min(inData.size(), _history->capacity());
-                _history->push_back_bulk(inData.last(toWrite).begin(), inData.last(toWrite).end());
+            anyExpired = anyExpired || listener->expired;
+        }
+        if (_sharedStream && _sharedStream->buffer.n_readers() > 0UZ) { // single copy for all attached blocking pollers
+            writeSharedStream(listeners, inData, detail::tagAndMetadata(tagData, _sharedStreamMetadata));
+        }
+        _sharedStreamMetadata.reset();
+        if (_history) {
+            // store potential pre-samples for triggers at the beginning of the next chunk
+            const auto toWrite = std::min(inData.size(), _history->capacity());
+            _history->push_back_bulk(inData.last(toWrite).begin(), inData.last(toWrite).end());
+        }
+        releaseListeners();
+
+        if (anyExpired) { // deferred: expired listeners are skipped until the list can be pruned w/o waiting for a writer
+            if (std::unique_lock lock(_listener_mutex, std::try_to_lock); lock.owns_lock()) {
+                publishListeners(ListenerList(*_currentListeners));
             }
         }
         return work::Status::OK;
     }
 
 private:
+    std::unique_ptr<StreamBuffer>   _sharedStream; // read by all blocking streaming pollers, created by the work thread
+    std::optional<detail::Metadata> _sharedStreamMetadata;
+
+    /// @return data set initialised from 'tmpl', recycled from the poller if possible (allocation-free in steady state)
+    [[nodiscard]] static DataSet<T>
+    newDataSet(const std::weak_ptr<DataSetPoller> &pollingHandler, const DataSet<T> &tmpl, std::size_t nSamples) {
+        if (auto poller = pollingHandler.lock()) {
+            return poller->acquire(tmpl, nSamples);
+        }
+        DataSet<T> dataSet = tmpl; // callbacks take ownership of the data sets
+        dataSet.timing_events.resize(1UZ);
+        dataSet.signal_values.reserve(nSamples);
+        return dataSet;
+    }
+
+    /// work thread only
+    StreamBuffer &
+    sharedStream() {
+        if (!_sharedStream) {
+            _sharedStream = std::make_unique<StreamBuffer>();
+        }
+        return *_sharedStream;
+    }
+
+    /// work thread only: blocks until all attached pollers have room for 'data', releasing the readers of pollers dropped meanwhile
+    /// (N.B. these would otherwise block the stream, and must not detach themselves from another thread, @see Poller::Readers)
+    void
+    writeSharedStream(const ListenerList &listeners, std::span<const T> data, std::optional<property_map> tagData) {
+        while (!data.empty()) {
+            if (const auto written = _sharedStream->write(data, std::move(tagData)); written > 0UZ) {
+                tagData.reset();
+                data = data.subspan(written);
+                continue;
+            }
+            for (const auto &listener : listeners) {
+                listener->releaseDroppedReaders();
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    /// work thread only: returns the latest published listener list and protects it against reclamation until releaseListeners()
+    const ListenerList &
+    acquireListeners() noexcept {
+        const ListenerList *listeners = _listeners.load();
+        while (true) {
+            _listenersInUse.store(listeners);
+            const ListenerList *latest = _listeners.load(); // re-validate: a writer might have retired 'listeners' meanwhile
+            if (latest == listeners) {
+                return *listeners;
+            }
+            listeners = latest;
+        }
+    }
+
+    void
+    releaseListeners() noexcept {
+        _listenersInUse.store(nullptr);
+    }
+
+    /// caller must hold '_listener_mutex'
+    void
+    publishListeners(ListenerList &&listeners) {
+        std::erase_if(listeners, [](const auto &l) { return l->expired.load(); });
+        auto next = std::make_unique<ListenerList>(std::move(listeners));
+        _listeners.store(next.get());
+        _retiredListeners.push_back(std::exchange(_currentListeners, std::move(next)));
+        std::erase_if(_retiredListeners, [inUse = _listenersInUse.load()](const auto &retired) { return retired.get() != inUse; });
+    }
+
+    /// caller must hold '_listener_mutex', the history buffer itself is resized by the work thread
+    void
+    requestHistorySize(std::size_t size) {
+        _requestedHistorySize.store(std::max(_requestedHistorySize.load(), size));
+    }
+
     void
     ensureHistorySize(std::size_t new_size) {
         const auto old_size = _history ? _history->capacity() : std::size_t{ 0 };
@@ -616,18 +922,24 @@ private:
         _history = new_history;
     }
 
+    /// caller must hold '_listener_mutex'
     void
     addListener(std::unique_ptr<AbstractListener> &&l, bool block) {
         l->setMetadata(detail::Metadata{ sample_rate, signal_name, signal_unit, signal_min, signal_max });
+        ListenerList next;
+        next.reserve(_currentListeners->size() + 1UZ);
+        if (!block) { // non-blocking listeners are served before potentially blocking ones
+            next.emplace_back(std::move(l));
+        }
+        next.insert(next.end(), _currentListeners->begin(), _currentListeners->end());
         if (block) {
-            _listeners.push_back(std::move(l));
-        } else {
-            _listeners.push_front(std::move(l));
+            next.emplace_back(std::move(l));
         }
+        publishListeners(std::move(next));
     }
 
     struct AbstractListener {
-        bool expired = false;
+        std::atomic<bool> expired = false; // set by the work thread, read by writers when pruning
 
         virtual ~AbstractListener() = default;
 
@@ -638,6 +950,10 @@ private:
 
         virtual void setMetadata(detail::Metadata) = 0;
 
+        /// work thread only: releases the stream readers of a dropped poller
+        virtual void
+        releaseDroppedReaders() {}
+
         virtual void
         process(std::span<const T> history, std::span<const T> data, std::optional<property_map> tagData0)
                 = 0;
@@ -652,7 +968,6 @@ private:
                                                || std::is_invocable_v<Callback, std::span<const T>, std::span<const Tag>, const DataSink<T> &>;
 
         const DataSink<T>              &parent_sink;
-        bool                            block           = false;
         std::size_t                     samples_written = 0;
         std::optional<detail::Metadata> _pendingMetadata;
 
@@ -661,14 +976,18 @@ private:
         std::vector<T>   buffer;
         std::vector<Tag> tag_buffer;
 
-        // polling-only
-        std::weak_ptr<Poller> polling_handler = {};
-        Callback              callback;
+        // polling-only (non-blocking, blocking pollers share the sink's stream via 'SharedStreamListener')
+        std::weak_ptr<Poller>                    polling_handler = {};
+        std::unique_ptr<StreamBuffer>            stream;
+        std::shared_ptr<typename Poller::Readers> readers; // released by the work thread once the poller has been dropped
+        Callback                                 callback;
 
         template<typename CallbackFW>
         explicit ContinuousListener(std::size_t maxChunkSize, CallbackFW &&c, const DataSink<T> &parent) : parent_sink(parent), buffer(maxChunkSize), callback{ std::forward<CallbackFW>(c) } {}
 
-        explicit ContinuousListener(std::shared_ptr<Poller> poller, bool doBlock, const DataSink<T> &parent) : parent_sink(parent), block(doBlock), polling_handler{ std::move(poller) } {}
+        explicit ContinuousListener(std::shared_ptr<Poller> poller, const DataSink<T> &parent) : parent_sink(parent), polling_handler{ poller }, stream(std::make_unique<StreamBuffer>()) {
+            readers = poller->attach(*stream, std::nullopt); // N.B. listener not yet published, i.e. no concurrent writer
+        }
 
         inline void
         callCallback(std::span<const T> data, std::span<const Tag> tags) {
@@ -742,22 +1061,14 @@ private:
             } else {
                 auto poller = polling_handler.lock();
                 if (!poller) {
+                    readers.reset(); // N.B. detaches from 'stream' on the writing thread
                     this->setExpired();
                     return;
                 }
 
-                const auto toWrite = block ? data.size() : std::min(data.size(), poller->writer.available());
-
+                const auto toWrite = stream->write(data, detail::tagAndMetadata(tagData0, _pendingMetadata));
                 if (toWrite > 0) {
-                    if (auto tag = detail::tagAndMetadata(tagData0, _pendingMetadata)) {
-                        auto tw = poller->tag_writer.reserve(1);
-                        tw[0]   = { static_cast<Tag::signed_index_type>(samples_written), std::move(*tag) };
-                        tw.publish(1);
-                    }
                     _pendingMetadata.reset();
-                    auto writeData = poller->writer.reserve(toWrite);
-                    std::ranges::copy(data | std::views::take(toWrite), writeData.begin());
-                    writeData.publish(writeData.size());
                 }
                 poller->drop_count += data.size() - toWrite;
                 samples_written += toWrite;
@@ -780,6 +1091,50 @@ private:
         }
     };
 
+    /// blocking streaming poller: attaches as an additional reader to the sink's shared stream, no per-poller copy
+    struct SharedStreamListener : public AbstractListener {
+        DataSink<T>                              &parent_sink;
+        std::weak_ptr<Poller>                     polling_handler = {};
+        std::shared_ptr<typename Poller::Readers> readers; // owned by the work thread, the poller only holds a handle
+        std::optional<detail::Metadata>           _pendingMetadata;
+
+        explicit SharedStreamListener(std::shared_ptr<Poller> poller, DataSink<T> &parent) : parent_sink(parent), polling_handler{ std::move(poller) } {}
+
+        void
+        setMetadata(detail::Metadata metadata) override {
+            _pendingMetadata = std::move(metadata); // N.B. only needed for attaching, updates are written to the shared stream
+        }
+
+        void
+        process(std::span<const T>, std::span<const T>, std::optional<property_map>) override {
+            auto poller = polling_handler.lock();
+            if (!poller) {
+                readers.reset(); // N.B. detaches from the shared stream on the work thread, i.e. never concurrently to its write
+                this->setExpired();
+                return;
+            }
+            if (!readers) {
+                readers = poller->attach(parent_sink.sharedStream(), _pendingMetadata ? std::optional(_pendingMetadata->toTagMap()) : std::nullopt);
+                _pendingMetadata.reset();
+            }
+        }
+
+        void
+        releaseDroppedReaders() override {
+            if (readers && polling_handler.expired()) {
+                readers.reset();
+                this->setExpired();
+            }
+        }
+
+        void
+        stop() override {
+            if (auto p = polling_handler.lock()) {
+                p->finished = true;
+            }
+        }
+    };
+
     struct PendingWindow {
         DataSet<T>  dataset;
         std::size_t pending_post_samples = 0;
@@ -840,13 +1195,12 @@ private:
         void
         process(std::span<const T> history, std::span<const T> inData, std::optional<property_map> tagData0) override {
             if (tagData0 && trigger_matcher(Tag{ 0, *tagData0 }) == TriggerMatchResult::Matching) {
-                DataSet<T> dataset = dataset_template;
-                dataset.signal_values.reserve(preSamples + postSamples); // TODO maybe make the circ. buffer smaller but preallocate these
+                DataSet<T> dataset = newDataSet(polling_handler, dataset_template, preSamples + postSamples);
 
                 const auto preSampleView = history.subspan(0UZ, std::min(preSamples, history.size()));
                 dataset.signal_values.insert(dataset.signal_values.end(), preSampleView.rbegin(), preSampleView.rend());
 
-                dataset.timing_events = { { { static_cast<Tag::signed_index_type>(preSampleView.size()), *tagData0 } } };
+                dataset.timing_events[0].emplace_back(static_cast<Tag::signed_index_type>(preSampleView.size()), *tagData0);
                 pending_trigger_windows.push_back({ .dataset = std::move(dataset), .pending_post_samples = postSamples });
             }
 
@@ -942,9 +1296,8 @@ private:
                     }
                 }
                 if (obsr == TriggerMatchResult::Matching) {
-                    pending_dataset = dataset_template;
-                    pending_dataset->signal_values.reserve(maximumWindowSize); // TODO might be too much?
-                    pending_dataset->timing_events = { { { 0, *tagData0 } } };
+                    pending_dataset = newDataSet(polling_handler, dataset_template, maximumWindowSize); // TODO might be too much?
+                    pending_dataset->timing_events[0].emplace_back(0, *tagData0);
                 }
             }
             if (pending_dataset) {
@@ -1044,9 +1397,9 @@ private:
                     break;
                 }
 
-                DataSet<T> dataset    = dataset_template;
-                dataset.timing_events = { { { -static_cast<Tag::signed_index_type>(it->delay), std::move(it->tag_data) } } };
-                dataset.signal_values = { inData[it->pending_samples] };
+                DataSet<T> dataset = newDataSet(polling_handler, dataset_template, 1UZ);
+                dataset.timing_events[0].emplace_back(-static_cast<Tag::signed_index_type>(it->delay), std::move(it->tag_data));
+                dataset.signal_values.push_back(inData[it->pending_samples]);
                 this->publishDataSet(std::move(dataset));
 
                 it = pending.erase(it);
@@ -1061,6 +1414,38 @@ private:
             }
         }
     };
+
+    struct EnvelopeListener : public AbstractListener {
+        std::weak_ptr<EnvelopePoller>    polling_handler = {};
+        typename EnvelopePoller::Pyramid pyramid; // work thread, authoritative state
+
+        explicit EnvelopeListener(std::shared_ptr<EnvelopePoller> poller) : polling_handler{ std::move(poller) }, pyramid(polling_handler.lock()->snapshots[0].capacity()) {}
+
+        void
+        setMetadata(detail::Metadata metadata) override {
+            if (auto p = polling_handler.lock()) {
+                p->sample_rate = metadata.sampleRate;
+            }
+        }
+
+        void
+        process(std::span<const T>, std::span<const T> data, std::optional<property_map>) override {
+            auto poller = polling_handler.lock();
+            if (!poller) {
+                this->setExpired();
+                return;
+            }
+            pyramid.push_back_bulk(data);
+            poller->publish(pyramid);
+        }
+
+        void
+        stop() override {
+            if (auto p = polling_handler.lock()) {
+                p->finished = true;
+            }
+        }
+    };
 };
 
 } // namespace gr::basic
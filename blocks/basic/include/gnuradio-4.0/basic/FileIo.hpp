@@ -0,0 +1,401 @@
+#ifndef GNURADIO_FILE_IO_HPP
+#define GNURADIO_FILE_IO_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/BinarySerialiser.hpp>
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+namespace gr::basic {
+
+// optional shortening
+template<typename T, gr::meta::fixed_string description = "", typename... Arguments>
+using A = gr::Annotated<T, description, Arguments...>;
+using namespace gr;
+
+namespace file {
+/**
+ * Recording layout shared by `FileSink`, `FileSource` and `MmapFileSource`:
+ *  - raw samples in native layout, either in `<file_name>` or -- if rotation is enabled -- in `<file_name>.0000`, `<file_name>.0001`, ...
+ *  - tags in a side-car file `<data-file>.tags` as a sequence of records:
+ *    [std::int64_t sample index w.r.t. the start of the data file][std::uint32_t size][size bytes of binary encoded property_map]
+ */
+[[nodiscard]] inline std::filesystem::path
+segmentPath(const std::filesystem::path &fileName, std::size_t segmentIndex, bool rotating) {
+    return rotating ? std::filesystem::path(fmt::format("{}.{:04}", fileName.string(), segmentIndex)) : fileName;
+}
+
+[[nodiscard]] inline std::filesystem::path
+tagIndexPath(const std::filesystem::path &dataFile) {
+    return std::filesystem::path(dataFile.string() + ".tags");
+}
+
+/// @return data files of a (possibly rotated) recording in playback order
+[[nodiscard]] inline std::vector<std::filesystem::path>
+recordingSegments(const std::filesystem::path &fileName) {
+    if (std::filesystem::exists(fileName)) {
+        return { fileName };
+    }
+    std::vector<std::filesystem::path> segments;
+    for (std::size_t index = 0UZ; std::filesystem::exists(segmentPath(fileName, index, true)); ++index) {
+        segments.emplace_back(segmentPath(fileName, index, true));
+    }
+    return segments;
+}
+
+inline void
+writeTagRecord(std::FILE *tagFile, std::int64_t sampleIndex, const property_map &map) {
+    const std::vector<std::uint8_t> encoded = serialiser::serialise(map);
+    const auto                      size    = static_cast<std::uint32_t>(encoded.size());
+    if (std::fwrite(&sampleIndex, sizeof(sampleIndex), 1UZ, tagFile) != 1UZ || std::fwrite(&size, sizeof(size), 1UZ, tagFile) != 1UZ || std::fwrite(encoded.data(), 1UZ, encoded.size(), tagFile) != encoded.size()) {
+        throw std::system_error(errno, std::system_category(), "failed to write tag record");
+    }
+}
+
+/// @return all tags of the side-car index belonging to `dataFile` (empty if there is none), ordered by sample index
+[[nodiscard]] inline std::vector<Tag>
+readTagIndex(const std::filesystem::path &dataFile) {
+    std::vector<Tag> tags;
+    std::FILE       *tagFile = std::fopen(tagIndexPath(dataFile).c_str(), "rb");
+    if (tagFile == nullptr) {
+        return tags;
+    }
+    std::int64_t              sampleIndex;
+    std::uint32_t             size;
+    std::vector<std::uint8_t> encoded;
+    while (std::fread(&sampleIndex, sizeof(sampleIndex), 1UZ, tagFile) == 1UZ && std::fread(&size, sizeof(size), 1UZ, tagFile) == 1UZ) {
+        encoded.resize(size);
+        if (std::fread(encoded.data(), 1UZ, size, tagFile) != size) {
+            break; // truncated last record, e.g. recording was interrupted
+        }
+        tags.emplace_back(sampleIndex, serialiser::deserialise<property_map>(encoded));
+    }
+    std::fclose(tagFile);
+    std::ranges::stable_sort(tags, {}, &Tag::index);
+    return tags;
+}
+} // namespace file
+
+template<typename T>
+struct FileSink : public Block<FileSink<T>, BlockingIO<true>> {
+    using Description = Doc<R""(
+@brief records the raw input stream to (rotating) files and the tags to a binary side-car index
+
+Samples are written straight from the input buffer's reader span, i.e. without intermediate copies, using large
+batched writes on the block's IO thread so that the scheduler thread is never blocked. Page-aligned ranges are
+written with `O_DIRECT` to bypass the page cache, unaligned heads/tails (and file-systems without `O_DIRECT`
+support, e.g. tmpfs) fall back to regular buffered writes. See `gr::basic::file` for the on-disk layout.
+)"">;
+    using ClockType = std::chrono::steady_clock;
+
+    PortIn<T> in;
+
+    A<std::string, "file name", Visible, Doc<"data file, '.NNNN' suffix is appended if files are rotated">> file_name     = std::string("recording.bin");
+    A<bool, "direct IO", Doc<"use O_DIRECT for page-aligned batches">>                                      direct_io     = true;
+    A<gr::Size_t, "batch size", Unit<"B">, Doc<"minimum number of bytes per write">>                        batch_size    = 4U << 20U;
+    A<std::uint64_t, "max file size", Unit<"B">, Doc<"rotate to a new file once exceeded, 0: no rotation">> max_file_size = 0U;
+    A<gr::Size_t, "flush timeout", Unit<"ms">, Doc<"maximum time data is held back to complete a batch">>   flush_timeout = 100U;
+    std::uint64_t                                                                                           n_bytes_written{ 0U };
+
+private:
+    int                   _bufferedFd = -1;
+    int                   _directFd   = -1;
+    std::FILE            *_tagFile    = nullptr;
+    std::size_t           _fileIndex  = 0UZ;
+    std::size_t           _fileOffset = 0UZ; // in bytes
+    ClockType::time_point _lastWrite  = ClockType::now();
+    property_map          _pendingTag; // tag of a held-back chunk, N.B. the port only presents it once
+
+    static constexpr std::size_t kDirectAlignment = 4096UZ; // conservative: covers 512 and 4096 byte logical block sizes
+    static constexpr bool        kDirectCapable   = kDirectAlignment % sizeof(T) == 0UZ;
+
+public:
+    ~FileSink() { closeFiles(); }
+
+    void
+    start() {
+        n_bytes_written = 0U;
+        _fileIndex      = 0UZ;
+        _pendingTag.clear();
+        openFiles();
+    }
+
+    void
+    stop() {
+        closeFiles();
+    }
+
+    [[nodiscard]] work::Status
+    processBulk(ConsumableSpan auto &input) {
+        if (_bufferedFd < 0) {
+            std::ignore = input.consume(0UZ);
+            return work::Status::ERROR;
+        }
+        if (this->input_tags_present()) {
+            for (const auto &[key, value] : this->mergedInputTag().map) {
+                _pendingTag.insert_or_assign(key, value);
+            }
+        }
+        // flush incomplete batches if the chunk is bounded by a tag, the block is shutting down, or data was held back for too long
+        const bool flush = in.streamReader().available() > input.size() || lifecycle::isShuttingDown(this->state()) || ClockType::now() - _lastWrite >= std::chrono::milliseconds(flush_timeout);
+        if (input.size() * sizeof(T) < batch_size && !flush) {
+            std::ignore = input.consume(0UZ);
+            return work::Status::INSUFFICIENT_INPUT_ITEMS;
+        }
+
+        std::span<const T> data(input.data(), input.size());
+        bool               endOfSegment = false;
+        if (const std::size_t maxSamples = segmentSamplesLeft(data.data()); max_file_size > 0U && data.size() >= maxSamples) {
+            data         = data.first(maxSamples);
+            endOfSegment = true;
+        }
+        const std::size_t nWritten = writeSamples(data, flush || endOfSegment);
+        if (nWritten > 0UZ && !_pendingTag.empty()) {
+            file::writeTagRecord(_tagFile, static_cast<std::int64_t>((_fileOffset / sizeof(T)) - nWritten), _pendingTag);
+            _pendingTag.clear();
+        }
+        if (endOfSegment && nWritten == data.size()) {
+            closeFiles();
+            ++_fileIndex;
+            openFiles();
+        }
+        std::ignore = input.consume(nWritten);
+        return work::Status::OK;
+    }
+
+private:
+    // @return number of samples that still fit into the current file -- the cut is placed at a page-aligned buffer address
+    // (if possible) so that the next file's offsets are congruent with the buffer addresses, which is required by O_DIRECT
+    [[nodiscard]] std::size_t
+    segmentSamplesLeft(const T *next) const noexcept {
+        const std::size_t maxSamples = std::max(static_cast<std::size_t>((max_file_size - std::min<std::uint64_t>(_fileOffset, max_file_size)) / sizeof(T)), 1UZ);
+        if constexpr (kDirectCapable) {
+            const auto address    = reinterpret_cast<std::uintptr_t>(next);
+            const auto endAddress = address + maxSamples * sizeof(T);
+            if (const auto alignedEnd = endAddress - endAddress % kDirectAlignment; direct_io && alignedEnd > address) {
+                return (alignedEnd - address) / sizeof(T);
+            }
+        }
+        return maxSamples;
+    }
+
+    // @return number of samples written -- either an unaligned head up to the next page boundary, a page-aligned body, or (if flushing) everything
+    std::size_t
+    writeSamples(std::span<const T> data, bool flush) {
+        if constexpr (kDirectCapable) {
+            const auto address = reinterpret_cast<std::uintptr_t>(data.data());
+            if (_directFd >= 0 && address % kDirectAlignment == _fileOffset % kDirectAlignment) {
+                if (const std::size_t headBytes = (kDirectAlignment - address % kDirectAlignment) % kDirectAlignment; headBytes > 0UZ) {
+                    return writeBytes(_bufferedFd, data.first(std::min(data.size(), headBytes / sizeof(T))));
+                }
+                if (const std::size_t bodySamples = (data.size_bytes() / kDirectAlignment) * kDirectAlignment / sizeof(T); bodySamples > 0UZ) {
+                    if (const std::size_t nWritten = writeBytes(_directFd, data.first(bodySamples)); nWritten > 0UZ) {
+                        return nWritten;
+                    }
+                }
+            }
+        }
+        return flush ? writeBytes(_bufferedFd, data) : 0UZ;
+    }
+
+    std::size_t
+    writeBytes(int fd, std::span<const T> data) {
+        const auto *bytes     = reinterpret_cast<const char *>(data.data());
+        std::size_t remaining = data.size_bytes();
+        while (remaining > 0UZ) {
+            const ssize_t ret = pwrite(fd, bytes + (data.size_bytes() - remaining), remaining, static_cast<off_t>(_fileOffset + data.size_bytes() - remaining));
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                if (fd == _directFd && errno == EINVAL && remaining == data.size_bytes()) { // O_DIRECT constraints not met by this file-system -> fall back to buffered writes
+                    ::close(_directFd);
+                    _directFd = -1;
+                    return 0UZ;
+                }
+                throw std::system_error(errno, std::system_category(), fmt::format("{} - failed to write {} bytes to '{}'", this->name, remaining, currentPath().string()));
+            }
+            remaining -= static_cast<std::size_t>(ret);
+        }
+        _fileOffset += data.size_bytes();
+        n_bytes_written += data.size_bytes();
+        _lastWrite = ClockType::now();
+        return data.size();
+    }
+
+    [[nodiscard]] std::filesystem::path
+    currentPath() const {
+        return file::segmentPath(file_name.value, _fileIndex, max_file_size > 0U);
+    }
+
+    void
+    openFiles() {
+        const auto path = currentPath();
+        _fileOffset     = 0UZ;
+        _lastWrite      = ClockType::now();
+        _bufferedFd     = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (_bufferedFd < 0) {
+            throw std::system_error(errno, std::system_category(), fmt::format("{} - failed to open '{}'", this->name, path.string()));
+        }
+#ifdef O_DIRECT
+        if (direct_io && kDirectCapable) {
+            _directFd = ::open(path.c_str(), O_WRONLY | O_DIRECT | O_CLOEXEC); // N.B. may fail (e.g. tmpfs) -> buffered writes only
+        }
+#endif
+        _tagFile = std::fopen(file::tagIndexPath(path).c_str(), "wb");
+        if (_tagFile == nullptr) {
+            throw std::system_error(errno, std::system_category(), fmt::format("{} - failed to open '{}'", this->name, file::tagIndexPath(path).string()));
+        }
+    }
+
+    void
+    closeFiles() noexcept {
+        for (int *fd : { &_bufferedFd, &_directFd }) {
+            if (*fd >= 0) {
+                ::close(*fd);
+                *fd = -1;
+            }
+        }
+        if (_tagFile != nullptr) {
+            std::fclose(_tagFile);
+            _tagFile = nullptr;
+        }
+    }
+};
+
+template<typename T>
+struct FileSource : public Block<FileSource<T>, BlockingIO<true>> {
+    using Description = Doc<R""(
+@brief replays a (possibly rotated) recording written by `FileSink<T>` including its side-car tags
+
+Samples are read directly into the output buffer on the block's IO thread. The source finishes after the last file.
+)"">;
+
+    PortOut<T> out;
+
+    A<std::string, "file name", Visible, Doc<"data file or base name of a rotated recording">> file_name = std::string("recording.bin");
+    std::uint64_t                                                                          n_samples_produced{ 0U };
+
+private:
+    std::vector<std::filesystem::path> _segments;
+    std::size_t                        _segmentIndex = 0UZ;
+    int                                _fd           = -1;
+    std::size_t                        _fileOffset   = 0UZ; // in bytes
+    std::vector<Tag>                   _tags;
+    std::size_t                        _nextTag = 0UZ;
+
+public:
+    ~FileSource() { closeFile(); }
+
+    void
+    start() {
+        n_samples_produced = 0U;
+        _segments          = file::recordingSegments(file_name.value);
+        _segmentIndex      = 0UZ;
+        if (_segments.empty()) {
+            throw gr::exception(fmt::format("{} - no recording found for '{}'", this->name, file_name.value));
+        }
+        openFile();
+    }
+
+    void
+    stop() {
+        closeFile();
+    }
+
+    [[nodiscard]] work::Status
+    processBulk(PublishableSpan auto &output) {
+        while (_fd >= 0) {
+            const std::size_t nRead = readSamples(std::span<T>(output.data(), output.size()));
+            if (nRead > 0UZ) {
+                const auto firstSample = static_cast<Tag::signed_index_type>(_fileOffset / sizeof(T) - nRead);
+                for (; _nextTag < _tags.size() && _tags[_nextTag].index < firstSample + static_cast<Tag::signed_index_type>(nRead); ++_nextTag) {
+                    out.publishTag(_tags[_nextTag].map, std::max(_tags[_nextTag].index - firstSample, Tag::signed_index_type{ 0 }));
+                }
+                n_samples_produced += nRead;
+                output.publish(nRead);
+                return work::Status::OK;
+            }
+            if (output.size() == 0UZ) {
+                output.publish(0UZ);
+                return work::Status::INSUFFICIENT_OUTPUT_ITEMS;
+            }
+            closeFile(); // end of segment -> continue with the next one (if any)
+            if (++_segmentIndex < _segments.size()) {
+                openFile();
+            }
+        }
+        output.publish(0UZ);
+        return work::Status::DONE;
+    }
+
+private:
+    // @return number of complete samples read, trailing partial samples are ignored
+    std::size_t
+    readSamples(std::span<T> buffer) {
+        auto       *bytes     = reinterpret_cast<char *>(buffer.data());
+        std::size_t nBytes    = 0UZ;
+        while (nBytes < buffer.size_bytes()) {
+            const ssize_t ret = pread(_fd, bytes + nBytes, buffer.size_bytes() - nBytes, static_cast<off_t>(_fileOffset + nBytes));
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::system_category(), fmt::format("{} - failed to read '{}'", this->name, _segments[_segmentIndex].string()));
+            }
+            if (ret == 0) {
+                break; // end of file
+            }
+            nBytes += static_cast<std::size_t>(ret);
+        }
+        const std::size_t nSamples = nBytes / sizeof(T);
+        _fileOffset += nSamples * sizeof(T);
+        return nSamples;
+    }
+
+    void
+    openFile() {
+        const auto &path = _segments[_segmentIndex];
+        _fd              = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (_fd < 0) {
+            throw std::system_error(errno, std::system_category(), fmt::format("{} - failed to open '{}'", this->name, path.string()));
+        }
+        posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        _fileOffset = 0UZ;
+        _tags       = file::readTagIndex(path);
+        _nextTag    = 0UZ;
+    }
+
+    void
+    closeFile() noexcept {
+        if (_fd >= 0) {
+            ::close(_fd);
+            _fd = -1;
+        }
+    }
+};
+
+} // namespace gr::basic
+
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::basic::FileSink, in, file_name, direct_io, batch_size, max_file_size, flush_timeout);
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::basic::FileSource, out, file_name);
+
+auto registerFileSink   = gr::registerBlock<gr::basic::FileSink, float, double>(gr::globalBlockRegistry());
+auto registerFileSource = gr::registerBlock<gr::basic::FileSource, float, double>(gr::globalBlockRegistry());
+
+#endif // GNURADIO_FILE_IO_HPP
@@ -0,0 +1,245 @@
+#ifndef GNURADIO_MMAP_FILE_SOURCE_HPP
+#define GNURADIO_MMAP_FILE_SOURCE_HPP
+
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+#include <gnuradio-4.0/basic/FileIo.hpp>
+
+namespace gr::basic {
+
+template<typename T>
+struct MmapFileSource : public Block<MmapFileSource<T>> {
+    using Description = Doc<R""(
+@brief replays a (possibly rotated) `FileSink<T>` recording from memory-mapped files as fast as back-pressure permits
+
+The data files are mapped read-only and copied straight from the page cache into the output buffer (no read()
+syscalls, no user-space staging). Tags are re-injected from the side-car index at their original sample positions so
+that downstream triggers (e.g. `DataSink`) fire exactly as during live operation.
+
+The `Seek` property (message `Set` command) repositions the playback:
+ - `{ "sample_index": <integer> }` jumps to an absolute sample index
+ - `{ "time": <std::uint64_t, UTC ns> }` jumps to the sample corresponding to the given time-stamp, derived from the
+   latest indexed `trigger_time` tag at or before the given time and the recording's sample rate
+)"">;
+    static inline const char *kSeek = "Seek";
+
+    PortOut<T> out;
+
+    A<std::string, "file name", Visible, Doc<"data file or base name of a rotated recording">> file_name   = std::string("recording.bin");
+    A<float, "sample rate", Unit<"Hz">, Doc<"used for time-based seeks if not given by a tag">> sample_rate = 1.f;
+    std::uint64_t                                                                           n_samples_produced{ 0U };
+
+private:
+    struct Segment {
+        std::filesystem::path path;
+        std::size_t           firstSample;
+        std::size_t           nSamples;
+    };
+    std::vector<Segment>       _segments;
+    std::vector<Tag>           _tags; // indices are absolute w.r.t. the start of the recording
+    std::size_t                _nSamples = 0UZ;
+    std::size_t                _position = 0UZ;
+    std::size_t                _nextTag  = 0UZ;
+    std::optional<std::size_t> _pendingSeek;
+
+    std::size_t _mappedSegment = std::numeric_limits<std::size_t>::max();
+    const T    *_mapped        = nullptr;
+    std::size_t _mappedBytes   = 0UZ;
+
+public:
+    ~MmapFileSource() { unmap(); }
+
+    void
+    start() {
+        _segments.clear();
+        _tags.clear();
+        _nSamples = 0UZ;
+        for (const auto &path : file::recordingSegments(file_name.value)) {
+            const std::size_t nSamples = static_cast<std::size_t>(std::filesystem::file_size(path)) / sizeof(T);
+            for (Tag &tag : file::readTagIndex(path)) {
+                tag.index += static_cast<Tag::signed_index_type>(_nSamples);
+                _tags.emplace_back(std::move(tag));
+            }
+            _segments.push_back({ path, _nSamples, nSamples });
+            _nSamples += nSamples;
+        }
+        if (_segments.empty()) {
+            throw gr::exception(fmt::format("{} - no recording found for '{}'", this->name, file_name.value));
+        }
+        n_samples_produced = 0U;
+        seek(0UZ);
+        this->propertyCallbacks.emplace(kSeek, &MmapFileSource::propertyCallbackSeek);
+    }
+
+    void
+    stop() {
+        unmap();
+    }
+
+    [[nodiscard]] std::size_t
+    position() const noexcept {
+        return _position;
+    }
+
+    [[nodiscard]] work::Status
+    processBulk(PublishableSpan auto &output) {
+        if (_pendingSeek.has_value()) {
+            seek(*std::exchange(_pendingSeek, std::nullopt));
+        }
+        if (_position >= _nSamples) {
+            output.publish(0UZ);
+            return work::Status::DONE;
+        }
+
+        const auto     segmentIndex = static_cast<std::size_t>(std::distance(_segments.begin(), std::ranges::upper_bound(_segments, _position, {}, &Segment::firstSample))) - 1UZ;
+        const Segment &segment      = _segments[segmentIndex];
+        map(segmentIndex);
+        const std::size_t offset   = _position - segment.firstSample;
+        const std::size_t nSamples = std::min(output.size(), segment.nSamples - offset);
+        if (nSamples == 0UZ) {
+            output.publish(0UZ);
+            return work::Status::INSUFFICIENT_OUTPUT_ITEMS;
+        }
+
+        const auto firstSample = static_cast<Tag::signed_index_type>(_position);
+        for (; _nextTag < _tags.size() && _tags[_nextTag].index < firstSample + static_cast<Tag::signed_index_type>(nSamples); ++_nextTag) {
+            out.publishTag(_tags[_nextTag].map, std::max(_tags[_nextTag].index - firstSample, Tag::signed_index_type{ 0 }));
+        }
+        std::copy_n(_mapped + offset, nSamples, output.begin());
+        _position += nSamples;
+        n_samples_produced += nSamples;
+        output.publish(nSamples);
+        return work::Status::OK;
+    }
+
+    /// @return absolute sample index for a UTC time-stamp [ns] based on the indexed 'trigger_time' tags
+    [[nodiscard]] std::size_t
+    sampleIndexForTime(std::uint64_t timeNs) const {
+        std::optional<std::pair<Tag::signed_index_type, std::uint64_t>> reference; // latest (index, trigger_time) at or before 'timeNs'
+        for (const Tag &tag : _tags) {
+            if (auto it = tag.map.find(tag::TRIGGER_TIME.shortKey()); it != tag.map.end()) {
+                if (const auto *triggerTime = std::get_if<std::uint64_t>(&it->second); triggerTime != nullptr && *triggerTime <= timeNs) {
+                    reference = { tag.index, *triggerTime };
+                }
+            }
+        }
+        if (!reference) {
+            throw gr::exception(fmt::format("{} - no '{}' tag at or before {} ns in recording '{}'", this->name, tag::TRIGGER_TIME.shortKey(), timeNs, file_name.value));
+        }
+        float sampleRate = sample_rate; // N.B. the latest rate published up to the reference sample takes precedence
+        for (const Tag &tag : _tags) {
+            if (tag.index > reference->first) {
+                break;
+            }
+            if (auto it = tag.map.find(tag::SAMPLE_RATE.shortKey()); it != tag.map.end()) {
+                if (const auto *rate = std::get_if<float>(&it->second); rate != nullptr && *rate > 0.f) {
+                    sampleRate = *rate;
+                }
+            }
+        }
+        const double deltaSamples = static_cast<double>(timeNs - reference->second) * 1e-9 * static_cast<double>(sampleRate);
+        return static_cast<std::size_t>(reference->first) + static_cast<std::size_t>(deltaSamples);
+    }
+
+    std::optional<Message>
+    propertyCallbackSeek(std::string_view propertyName, Message message) {
+        using enum gr::message::Command;
+        assert(kSeek == propertyName);
+
+        if (message.cmd == Set) {
+            if (!message.data.has_value()) {
+                throw gr::exception(fmt::format("block {} (aka. {}) cannot set {} w/o data msg: {}", this->unique_name, this->name, propertyName, message));
+            }
+            const property_map &data = message.data.value();
+            if (auto it = data.find("time"); it != data.end()) {
+                _pendingSeek = sampleIndexForTime(std::get<std::uint64_t>(it->second));
+            } else if (auto index = data.find("sample_index"); index != data.end()) {
+                _pendingSeek = std::visit(
+                        [&]<typename TValue>(const TValue &value) -> std::size_t {
+                            if constexpr (std::is_integral_v<TValue>) {
+                                return static_cast<std::size_t>(std::max(value, TValue{ 0 }));
+                            } else {
+                                throw gr::exception(fmt::format("block {} property {}: 'sample_index' needs to be an integer, msg: {}", this->unique_name, propertyName, message));
+                            }
+                        },
+                        index->second);
+            } else {
+                throw gr::exception(fmt::format("block {} property {} requires either 'sample_index' or 'time', msg: {}", this->unique_name, propertyName, message));
+            }
+            return std::nullopt;
+        } else if (message.cmd == Get) {
+            message.data = property_map{ { "sample_index", static_cast<std::uint64_t>(_pendingSeek.value_or(_position)) }, { "n_samples", static_cast<std::uint64_t>(_nSamples) } };
+            return message;
+        }
+
+        throw gr::exception(fmt::format("block {} property {} does not implement command {}, msg: {}", this->unique_name, propertyName, message.cmd, message));
+    }
+
+private:
+    void
+    seek(std::size_t sampleIndex) {
+        _position = std::min(sampleIndex, _nSamples);
+        _nextTag  = static_cast<std::size_t>(std::distance(_tags.begin(), std::ranges::lower_bound(_tags, static_cast<Tag::signed_index_type>(_position), {}, &Tag::index)));
+    }
+
+    void
+    map(std::size_t segmentIndex) {
+        if (segmentIndex == _mappedSegment) {
+            return;
+        }
+        unmap();
+        const Segment &segment = _segments[segmentIndex];
+        if (segment.nSamples == 0UZ) {
+            _mappedSegment = segmentIndex;
+            return;
+        }
+        const int fd = ::open(segment.path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::system_category(), fmt::format("{} - failed to open '{}'", this->name, segment.path.string()));
+        }
+        _mappedBytes = segment.nSamples * sizeof(T);
+        void *data   = mmap(nullptr, _mappedBytes, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // N.B. mapping is retained
+        if (data == MAP_FAILED) {
+            throw std::system_error(errno, std::system_category(), fmt::format("{} - failed to map '{}'", this->name, segment.path.string()));
+        }
+        madvise(data, _mappedBytes, MADV_SEQUENTIAL);
+        madvise(data, _mappedBytes, MADV_WILLNEED);
+        _mapped        = static_cast<const T *>(data);
+        _mappedSegment = segmentIndex;
+    }
+
+    void
+    unmap() noexcept {
+        if (_mapped != nullptr) {
+            munmap(const_cast<T *>(_mapped), _mappedBytes);
+        }
+        _mapped        = nullptr;
+        _mappedBytes   = 0UZ;
+        _mappedSegment = std::numeric_limits<std::size_t>::max();
+    }
+};
+
+} // namespace gr::basic
+
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::basic::MmapFileSource, out, file_name, sample_rate);
+
+auto registerMmapFileSource = gr::registerBlock<gr::basic::MmapFileSource, float, double>(gr::globalBlockRegistry());
+
+#endif // GNURADIO_MMAP_FILE_SOURCE_HPP
@@ -75,6 +75,13 @@ myBlock.processBulk(ins, outs);
 // check values of outs
 }
 @endcode
+
+Performance: the 'ins'/'outs' lists and their NumPy arrays are cached and only re-pointed to the new data for each call.
+N.B. arrays retained by the script (e.g. stored in a global) are replaced by new ones and thus remain valid. For small
+chunks the Python call overhead dominates, which can be amortised by:
+  * 'min_chunk_size': minimum number of samples per input and call (except at the end of the stream),
+  * 'dedicated_thread': executing the script on a persistent interpreter thread that keeps the GIL while work is
+    queued back-to-back instead of acquiring it and switching the Python thread state for each 'work()' call.
 )"">;
     // optional shortening
     template<typename U, gr::meta::fixed_string description = "", typename... Arguments>
@@ -82,15 +89,19 @@ myBlock.processBulk(ins, outs);
     using poc_property_map = std::map<std::string, std::string, std::less<>>; // TODO: needs to be replaced with 'property_map` aka. 'pmtv::map_t'
     using tag_type         = std::string;
 
-    std::vector<PortIn<T>>                                                        inputs{};
-    std::vector<PortOut<T>>                                                       outputs{};
-    A<gr::Size_t, "n_inputs", Visible, Doc<"number of inputs">, Limits<1U, 32U>>  n_inputs     = 0U;
-    A<gr::Size_t, "n_outputs", Visible, Doc<"number of inputs">, Limits<1U, 32U>> n_outputs    = 0U;
-    std::string                                                                   pythonScript = "";
-
-    PyModuleDef        *_moduleDefinitions = myBlockPythonDefinitions<T>();
-    python::Interpreter _interpreter{ this, _moduleDefinitions };
-    std::string         _prePythonDefinition = fmt::format(R"p(import {0}
+    std::vector<PortIn<T>>                                                            inputs{};
+    std::vector<PortOut<T>>                                                           outputs{};
+    A<gr::Size_t, "n_inputs", Visible, Doc<"number of inputs">, Limits<1U, 32U>>      n_inputs         = 0U;
+    A<gr::Size_t, "n_outputs", Visible, Doc<"number of inputs">, Limits<1U, 32U>>     n_outputs        = 0U;
+    std::string                                                                       pythonScript     = "";
+    A<gr::Size_t, "min chunk size", Doc<"min. number of samples per input and call">> min_chunk_size   = 1U;
+    A<bool, "dedicated thread", Doc<"run script on a persistent interpreter thread">> dedicated_thread = false;
+
+    PyModuleDef                    *_moduleDefinitions = myBlockPythonDefinitions<T>();
+    python::Interpreter             _interpreter{ this, _moduleDefinitions };
+    python::NumPyArrayList<const T> _pyIns{}; // N.B. declared after '_interpreter' -> released while Python is still initialised
+    python::NumPyArrayList<T>       _pyOuts{};
+    std::string                     _prePythonDefinition = fmt::format(R"p(import {0}
 import warnings
 
 class WarningException(Exception):
@@ -119,10 +130,10 @@ class PythonBlockWrapper: ## helper class to make the C++ class appear as a Pyth
         {0}.setSettings(self.capsule, settings)
 
 this_block = PythonBlockWrapper(capsule))p",
-                                                           _moduleDefinitions->m_name);
-    poc_property_map    _settingsMap{ { "key1", "value1" }, { "key2", "value2" } };
-    bool                _tagAvailable = false;
-    tag_type            _tag          = "Simulated Tag";
+                                                                       _moduleDefinitions->m_name);
+    poc_property_map                _settingsMap{ { "key1", "value1" }, { "key2", "value2" } };
+    bool                            _tagAvailable = false;
+    tag_type                        _tag          = "Simulated Tag";
 
     void
     settingsChanged(const gr::property_map &old_settings, const gr::property_map &new_settings) {
@@ -141,6 +152,16 @@ this_block = PythonBlockWrapper(capsule))p",
             outputs.resize(n_outputs);
         }
 
+        if (new_settings.contains("n_inputs") || new_settings.contains("min_chunk_size")) {
+            for (auto &input : inputs) {
+                input.min_samples = min_chunk_size;
+            }
+        }
+
+        if (new_settings.contains("dedicated_thread")) {
+            _interpreter.setDedicatedThread(dedicated_thread);
+        }
+
         if (new_settings.contains("pythonScript")) {
             _interpreter.invoke(
                     [this] {
@@ -234,19 +255,7 @@ private:
     template<typename TConsumableInputSpan, typename TProducibleOutSpan>
     void
     callPythonFunction(std::span<TConsumableInputSpan> ins, std::span<TProducibleOutSpan> outs) {
-        PyObject *pIns = PyList_New(static_cast<Py_ssize_t>(ins.size()));
-        for (size_t i = 0; i < ins.size(); ++i) {
-            PyList_SetItem(pIns, Py_ssize_t(i), python::toPyArray(ins[i].data(), { ins[i].size() }));
-        }
-
-        PyObject *pOuts = PyList_New(static_cast<Py_ssize_t>(outs.size()));
-        for (size_t i = 0; i < outs.size(); ++i) {
-            PyList_SetItem(pOuts, Py_ssize_t(i), python::toPyArray(outs[i].data(), { outs[i].size() }));
-        }
-
-        python::PyObjectGuard pyArgs(PyTuple_New(2));
-        PyTuple_SetItem(pyArgs, 0, pIns);
-        PyTuple_SetItem(pyArgs, 1, pOuts);
+        python::PyObjectGuard pyArgs(PyTuple_Pack(2, _pyIns.assign(ins), _pyOuts.assign(outs))); // N.B. does not steal the (cached) list references
 
         if (python::PyObjectGuard pyValue = _interpreter.invokeFunction("process_bulk", pyArgs); !pyValue) {
             python::throwCurrentPythonError(fmt::format("{}(aka. {})::callPythonFunction(..) Python function call failed", this->unique_name, this->name), std::source_location::current(),
@@ -256,7 +265,7 @@ private:
 };
 
 } // namespace gr::basic
-ENABLE_REFLECTION_FOR_TEMPLATE(gr::basic::PythonBlock, inputs, outputs, n_inputs, n_outputs, pythonScript)
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::basic::PythonBlock, inputs, outputs, n_inputs, n_outputs, pythonScript, min_chunk_size, dedicated_thread)
 
 template<typename T>
 gr::basic::PythonBlock<T> *
@@ -252,6 +252,65 @@ toPyArray(T *arrayData, std::initializer_list<std::size_t> dimensions) {
     return npArray;
 }
 
+/**
+ * Python list of 1-D NumPy arrays that is kept between calls: the arrays are re-pointed to the new data and sizes rather than
+ * re-created for every call. Arrays (or the list) that are still referenced by the Python code after a call (e.g. stored in a
+ * global or a view thereof) are replaced by new objects so that the retained references remain valid.
+ * N.B. must be accessed/destroyed with the GIL held.
+ */
+template<typename T>
+class NumPyArrayList {
+    PyObjectGuard _list;
+
+    static void
+    repoint(PyObject *array, T *data, std::size_t size) noexcept {
+        // N.B. reinterpret cast is needed to access NumPy's unsafe C-API -- same (1-D, contiguous, aligned) layout, only data and extent change
+        auto *fields          = reinterpret_cast<PyArrayObject_fields *>(array);
+        fields->data          = reinterpret_cast<char *>(const_cast<std::remove_const_t<T> *>(data));
+        fields->dimensions[0] = static_cast<npy_intp>(size);
+    }
+
+public:
+    NumPyArrayList() = default;
+
+    ~NumPyArrayList() {
+        if (_list && Py_IsInitialized()) {
+            PyGILGuard guard;
+            _list = PyObjectGuard(nullptr);
+        }
+    }
+
+    NumPyArrayList(const NumPyArrayList &) = delete;
+    NumPyArrayList &
+    operator=(const NumPyArrayList &)
+            = delete;
+
+    template<typename TSpan>
+        requires std::convertible_to<decltype(std::declval<TSpan &>().data()), T *>
+    [[nodiscard]] PyObject *
+    assign(std::span<TSpan> spans) {
+        const auto nSpans = static_cast<Py_ssize_t>(spans.size());
+        if (!_list || Py_REFCNT(_list.get()) > 1 || PyList_Size(_list) != nSpans) {
+            _list = PyObjectGuard(PyList_New(nSpans));
+            for (Py_ssize_t i = 0; i < nSpans; ++i) {
+                const auto &span = spans[static_cast<std::size_t>(i)];
+                PyList_SetItem(_list, i, python::toPyArray(static_cast<T *>(span.data()), { span.size() })); // steals reference
+            }
+            return _list;
+        }
+        for (Py_ssize_t i = 0; i < nSpans; ++i) {
+            const auto &span  = spans[static_cast<std::size_t>(i)];
+            PyObject   *array = PyList_GetItem(_list, i); // borrowed reference
+            if (Py_REFCNT(array) > 1) {                   // retained by Python code -> leave it alone
+                PyList_SetItem(_list, i, python::toPyArray(static_cast<T *>(span.data()), { span.size() }));
+            } else {
+                repoint(array, static_cast<T *>(span.data()), span.size());
+            }
+        }
+        return _list;
+    }
+};
+
 template<typename T>
 std::string
 sanitizedPythonBlockName() {
@@ -268,22 +327,149 @@ sanitizedPythonBlockName() {
 #pragma GCC diagnostic pop
 #endif
 
+#include <chrono>
+#include <exception>
 #include <fmt/format.h>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 namespace gr::python {
 
 enum class EnforceFunction { MANDATORY, OPTIONAL };
 
+/**
+ * Persistent interpreter thread that executes tasks on behalf of (scheduler) threads. It keeps the GIL (and its Python thread
+ * state) while tasks arrive back-to-back and releases it only after being idle for 'idleTimeout'. This avoids the GIL
+ * acquire/release and thread-state switch of each `PyGILState_Ensure()` on the -- possibly changing -- calling threads.
+ * `execute(..)` is synchronous, i.e. returns once the task has been executed and re-throws its exception (if any).
+ */
+class InterpreterThread {
+    using Task = void (*)(void *);
+
+    std::chrono::nanoseconds   _idleTimeout;
+    std::mutex                 _submitMutex; // serialises concurrent callers (e.g. lifecycle vs. work() threads)
+    Task                       _task        = nullptr;
+    void                      *_taskContext = nullptr;
+    std::exception_ptr         _exception;
+    std::atomic<std::uint64_t> _nRequested{ 0U };
+    std::atomic<std::uint64_t> _nCompleted{ 0U };
+    std::atomic<bool>          _stopRequested{ false };
+    std::thread                _thread;
+
+    [[nodiscard]] bool
+    spinUntilRequested(std::uint64_t nDone) const noexcept {
+        const auto deadline = std::chrono::steady_clock::now() + _idleTimeout;
+        do {
+            if (_nRequested.load(std::memory_order_acquire) != nDone) {
+                return true;
+            }
+            std::this_thread::yield(); // N.B. keeps the GIL but not the CPU (the caller may need it to produce the next task)
+        } while (std::chrono::steady_clock::now() < deadline);
+        return false;
+    }
+
+    void
+    run() {
+        PyGILGuard    guard; // creates this thread's Python thread state
+        std::uint64_t nDone = 0U;
+        while (true) {
+            const std::uint64_t nRequested = _nRequested.load(std::memory_order_acquire);
+            if (nRequested == nDone) {
+                if (!spinUntilRequested(nDone)) { // idle -> release the GIL for other threads
+                    PyThreadState *threadState = PyEval_SaveThread();
+                    _nRequested.wait(nDone, std::memory_order_acquire);
+                    PyEval_RestoreThread(threadState);
+                }
+                continue;
+            }
+            if (_stopRequested.load(std::memory_order_acquire)) {
+                return;
+            }
+            try {
+                _task(_taskContext);
+            } catch (...) {
+                _exception = std::current_exception();
+            }
+            nDone = nRequested;
+            _nCompleted.store(nDone, std::memory_order_release);
+            _nCompleted.notify_all();
+        }
+    }
+
+public:
+    explicit InterpreterThread(std::chrono::nanoseconds idleTimeout = std::chrono::microseconds(100)) : _idleTimeout(idleTimeout), _thread([this] { run(); }) {}
+
+    /// N.B. must not be called from the interpreter thread itself (i.e. from within an executed task)
+    ~InterpreterThread() {
+        assert(id() != std::this_thread::get_id() && "InterpreterThread must not be destroyed by one of its own tasks");
+        _stopRequested.store(true, std::memory_order_release);
+        _nRequested.fetch_add(1U, std::memory_order_acq_rel);
+        _nRequested.notify_all();
+        PyThreadState *callerState = PyGILState_Check() ? PyEval_SaveThread() : nullptr; // the woken thread needs the GIL to shut down
+        _thread.join();
+        if (callerState != nullptr) {
+            PyEval_RestoreThread(callerState);
+        }
+    }
+
+    InterpreterThread(const InterpreterThread &) = delete;
+    InterpreterThread &
+    operator=(const InterpreterThread &)
+            = delete;
+
+    [[nodiscard]] std::thread::id
+    id() const noexcept {
+        return _thread.get_id();
+    }
+
+    template<NoParamNoReturn Func>
+    void
+    execute(Func &func) {
+        std::lock_guard lock(_submitMutex);
+        _task        = [](void *context) { (*static_cast<Func *>(context))(); };
+        _taskContext = &func;
+        const std::uint64_t ticket = _nRequested.fetch_add(1U, std::memory_order_acq_rel) + 1U;
+        _nRequested.notify_one();
+        for (std::uint64_t nDone = _nCompleted.load(std::memory_order_acquire); nDone < ticket; nDone = _nCompleted.load(std::memory_order_acquire)) {
+            _nCompleted.wait(nDone, std::memory_order_acquire);
+        }
+        if (_exception) {
+            std::rethrow_exception(std::exchange(_exception, nullptr));
+        }
+    }
+};
+
 class Interpreter {
-    static std::atomic<std::size_t> _nInterpreters;
-    static std::atomic<std::size_t> _nNumPyInit;
-    static PyThreadState           *_interpreterThreadState;
-    PyModuleDef                    *_moduleDefinitions;
-    PyObject                       *_pMainModule; // borrowed reference
-    PyObject                       *_pMainDict;   // borrowed reference
-    PyObjectGuard                   _pCapsule;
+    static std::atomic<std::size_t>    _nInterpreters;
+    static std::atomic<std::size_t>    _nNumPyInit;
+    static PyThreadState              *_interpreterThreadState;
+    PyModuleDef                       *_moduleDefinitions;
+    PyObject                          *_pMainModule; // borrowed reference
+    PyObject                          *_pMainDict;   // borrowed reference
+    PyObjectGuard                      _pCapsule;
+    std::unique_ptr<InterpreterThread> _thread; // optional dedicated thread executing all 'invoke(...)' calls
+
+    template<NoParamNoReturn Func>
+    void
+    invokeWithGIL(Func &func, std::string_view pythonCode, std::source_location location) {
+        assert(Py_IsInitialized());
+        PyGILGuard localGuard;
+        if (PyThreadState_GetInterpreter(PyThreadState_Get()) != PyThreadState_GetInterpreter(_interpreterThreadState)) {
+            python::throwCurrentPythonError("detected sub-interpreter change which is not supported by NumPy", location, pythonCode);
+        }
+        if (PyErr_Occurred()) {
+            python::throwCurrentPythonError("python::Interpreter::invoke() -- uncleared Python error before executing func", location, pythonCode);
+        }
+
+        func();
+
+        if (PyErr_Occurred()) {
+            python::throwCurrentPythonError("python::Interpreter::invoke() -- uncleared Python error after executing func", location, pythonCode);
+        }
+    }
 
 public:
     template<typename T>
@@ -294,19 +480,23 @@ public:
                 PyErr_Print();
             }
 
-            python::PyGILGuard guard;
-            _interpreterThreadState = PyThreadState_Get();
-            assert(_interpreterThreadState && "internal thread state is a nullptr");
-            if (_nNumPyInit.fetch_add(1UZ, std::memory_order_relaxed) == 0UZ && _import_array() < 0) {
-                // NumPy keeps internal state and does not allow to be re-initialised after 'Py_Finalize()' has been called.
-
-                // initialise NumPy -- N.B. NumPy does not support sub-interpreters (as of Python 3.12):
-                // "sys:1: UserWarning: NumPy was imported from a Python sub-interpreter but NumPy does not properly support sub-interpreters.
-                // This will likely work for most users but might cause hard to track down issues or subtle bugs.
-                // A common user of the rare sub-interpreter feature is wsgi which also allows single-interpreter mode.
-                // Improvements in the case of bugs are welcome, but is not on the NumPy roadmap, and full support may require significant effort to achieve."
-                python::throwCurrentPythonError("failed to initialize NumPy", location);
+            {
+                python::PyGILGuard guard;
+                _interpreterThreadState = PyThreadState_Get();
+                assert(_interpreterThreadState && "internal thread state is a nullptr");
+                if (_nNumPyInit.fetch_add(1UZ, std::memory_order_relaxed) == 0UZ && _import_array() < 0) {
+                    // NumPy keeps internal state and does not allow to be re-initialised after 'Py_Finalize()' has been called.
+
+                    // initialise NumPy -- N.B. NumPy does not support sub-interpreters (as of Python 3.12):
+                    // "sys:1: UserWarning: NumPy was imported from a Python sub-interpreter but NumPy does not properly support sub-interpreters.
+                    // This will likely work for most users but might cause hard to track down issues or subtle bugs.
+                    // A common user of the rare sub-interpreter feature is wsgi which also allows single-interpreter mode.
+                    // Improvements in the case of bugs are welcome, but is not on the NumPy roadmap, and full support may require significant effort to achieve."
+                    python::throwCurrentPythonError("failed to initialize NumPy", location);
+                }
             }
+            // release the GIL held since 'Py_Initialize()' so that other (e.g. scheduler or interpreter) threads may acquire it
+            _interpreterThreadState = PyEval_SaveThread();
         }
         assert(Py_IsInitialized() && "Python isn't properly initialised");
         // Ensure the Python GIL is initialized for this instance
@@ -351,7 +541,13 @@ public:
     }
 
     ~Interpreter() {
+        _thread.reset();
+        if (Py_IsInitialized()) {
+            PyGILGuard guard;
+            _pCapsule = PyObjectGuard(nullptr);
+        }
         if (_nInterpreters.fetch_sub(1UZ, std::memory_order_acq_rel) == 1UZ && Py_IsInitialized()) {
+            std::ignore = PyGILState_Ensure(); // N.B. Py_Finalize() needs to hold the GIL
             Py_Finalize();
         }
     }
@@ -376,23 +572,36 @@ public:
         return _pMainDict;
     }
 
-    template<NoParamNoReturn Func>
+    /**
+     * @brief executes all subsequent 'invoke(...)' calls on a persistent interpreter thread (true) or on the calling thread (false, default)
+     * N.B. throws if the dedicated thread is to be stopped by one of its own tasks (it cannot join itself)
+     */
     void
-    invoke(Func func, std::string_view pythonCode = "", std::source_location location = std::source_location::current()) {
-        assert(Py_IsInitialized());
-        PyGILGuard localGuard;
-        if (_interpreterThreadState != PyThreadState_Get()) {
-            python::throwCurrentPythonError("detected sub-interpreter change which is not supported by NumPy", location, pythonCode);
-        }
-        if (PyErr_Occurred()) {
-            python::throwCurrentPythonError("python::Interpreter::invoke() -- uncleared Python error before executing func", location, pythonCode);
+    setDedicatedThread(bool enable, std::source_location location = std::source_location::current()) {
+        if (enable && !_thread) {
+            _thread = std::make_unique<InterpreterThread>();
+        } else if (!enable && _thread) {
+            if (_thread->id() == std::this_thread::get_id()) {
+                throw gr::exception("python::Interpreter::setDedicatedThread(false) -- cannot stop the interpreter thread from within an invoked task", location);
+            }
+            _thread.reset();
         }
+    }
 
-        func();
+    [[nodiscard]] bool
+    hasDedicatedThread() const noexcept {
+        return _thread != nullptr;
+    }
 
-        if (PyErr_Occurred()) {
-            python::throwCurrentPythonError("python::Interpreter::invoke() -- uncleared Python error after executing func", location, pythonCode);
+    template<NoParamNoReturn Func>
+    void
+    invoke(Func func, std::string_view pythonCode = "", std::source_location location = std::source_location::current()) {
+        if (_thread && _thread->id() != std::this_thread::get_id() && !PyGILState_Check()) { // N.B. a caller holding the GIL would dead-lock the interpreter thread
+            auto task = [this, &func, pythonCode, location] { invokeWithGIL(func, pythonCode, location); };
+            _thread->execute(task);
+            return;
         }
+        invokeWithGIL(func, pythonCode, location);
     }
 
     template<EnforceFunction forced = EnforceFunction::MANDATORY>
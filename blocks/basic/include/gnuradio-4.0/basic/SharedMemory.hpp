@@ -0,0 +1,139 @@
+#ifndef GNURADIO_SHARED_MEMORY_HPP
+#define GNURADIO_SHARED_MEMORY_HPP
+
+#include <algorithm>
+#include <string>
+#include <system_error>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/SharedMemoryBuffer.hpp>
+
+namespace gr::basic {
+
+// optional shortening
+template<typename T, gr::meta::fixed_string description = "", typename... Arguments>
+using A = gr::Annotated<T, description, Arguments...>;
+using namespace gr;
+
+template<typename T>
+struct ShmSink : public Block<ShmSink<T>> {
+    using Description = Doc<R""(
+@brief writes the input stream and its tags into a named POSIX shared-memory segment
+
+Counterpart of `ShmSource<T>` which may run in another process' `Graph`. The sink creates and owns the segment
+(see `SharedMemoryBuffer<T>`) on `start()`, marks the stream as closed on `stop()` and removes it on destruction.
+Samples are copied once into the shared ring, tags are encoded with the binary codec and published ahead of the
+samples they refer to. If the reader lags behind, the sink back-pressures its upstream graph.
+)"">;
+
+    PortIn<T> in;
+
+    A<std::string, "shared memory name", Visible, Doc<"POSIX name of the segment, e.g. '/gr_stream'">> shm_name    = std::string("/gr_shm_stream");
+    A<gr::Size_t, "buffer size", Visible, Doc<"minimum number of samples in the shared ring">>         buffer_size = 65536U;
+    A<gr::Size_t, "tag slots", Doc<"maximum number of in-flight tags">>                                 n_tag_slots = static_cast<gr::Size_t>(shm::kTagSlots);
+
+private:
+    SharedMemoryBuffer<T> _buffer;
+
+public:
+    void
+    start() {
+        _buffer = {}; // N.B. releases the segment of a previous run, re-creating it would otherwise fail with 'file_exists'
+        _buffer = SharedMemoryBuffer<T>::create(shm_name, buffer_size, n_tag_slots);
+    }
+
+    void
+    stop() {
+        _buffer.close();
+    }
+
+    [[nodiscard]] work::Status
+    processBulk(ConsumableSpan auto &input) {
+        if (!_buffer.isValid()) {
+            std::ignore = input.consume(0UZ);
+            return work::Status::ERROR;
+        }
+
+        const std::size_t nSamples = std::min(input.size(), _buffer.availableForWrite());
+        if (nSamples == 0UZ) {
+            std::ignore = input.consume(0UZ);
+            return work::Status::INSUFFICIENT_OUTPUT_ITEMS;
+        }
+        if (this->input_tags_present() && !_buffer.tryPublishTag(_buffer.writePosition(), this->mergedInputTag().map)) {
+            std::ignore = input.consume(0UZ); // tag ring is full -> retry with the same chunk
+            return work::Status::INSUFFICIENT_OUTPUT_ITEMS;
+        }
+
+        std::ranges::copy(input.first(nSamples), _buffer.reserve(nSamples).begin());
+        _buffer.publish(nSamples);
+        std::ignore = input.consume(nSamples);
+        return work::Status::OK;
+    }
+};
+
+template<typename T>
+struct ShmSource : public Block<ShmSource<T>> {
+    using Description = Doc<R""(
+@brief reads a stream and its tags from a named POSIX shared-memory segment written by a `ShmSink<T>`
+
+The source attaches to the segment lazily, i.e. it may be started before the writing process. It finishes once the
+writer has closed the stream and all remaining samples have been forwarded.
+)"">;
+
+    PortOut<T> out;
+
+    A<std::string, "shared memory name", Visible, Doc<"POSIX name of the segment, e.g. '/gr_stream'">> shm_name = std::string("/gr_shm_stream");
+
+private:
+    SharedMemoryBuffer<T> _buffer;
+
+public:
+    void
+    stop() {
+        _buffer = SharedMemoryBuffer<T>();
+    }
+
+    [[nodiscard]] work::Status
+    processBulk(PublishableSpan auto &output) {
+        if (!_buffer.isValid()) {
+            try {
+                _buffer = SharedMemoryBuffer<T>::open(shm_name);
+            } catch (const std::system_error &e) {
+                if (e.code() != std::errc::no_such_file_or_directory) {
+                    throw;
+                }
+                output.publish(0UZ); // writer not (yet) available
+                return work::Status::INSUFFICIENT_INPUT_ITEMS;
+            }
+        }
+
+        const bool        isClosed = _buffer.isClosed(); // N.B. needs to be evaluated before 'available()' to not miss the last samples
+        const std::size_t nSamples = std::min(output.size(), _buffer.available());
+        if (nSamples == 0UZ) {
+            output.publish(0UZ);
+            return isClosed ? work::Status::DONE : work::Status::INSUFFICIENT_INPUT_ITEMS;
+        }
+
+        const auto readPosition = _buffer.readPosition();
+        for (auto tagIndex = _buffer.nextTagIndex(); tagIndex.has_value() && *tagIndex < readPosition + static_cast<Sequence::signed_index_type>(nSamples); tagIndex = _buffer.nextTagIndex()) {
+            const Tag tag = _buffer.consumeTag();
+            out.publishTag(tag.map, std::max(tag.index - readPosition, 0L));
+        }
+
+        std::ranges::copy(_buffer.get(nSamples), output.begin());
+        _buffer.consume(nSamples);
+        output.publish(nSamples);
+        return work::Status::OK;
+    }
+};
+
+} // namespace gr::basic
+
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::basic::ShmSink, in, shm_name, buffer_size, n_tag_slots);
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::basic::ShmSource, out, shm_name);
+
+auto registerShmSink   = gr::registerBlock<gr::basic::ShmSink, float, double>(gr::globalBlockRegistry());
+auto registerShmSource = gr::registerBlock<gr::basic::ShmSource, float, double>(gr::globalBlockRegistry());
+
+#endif // GNURADIO_SHARED_MEMORY_HPP
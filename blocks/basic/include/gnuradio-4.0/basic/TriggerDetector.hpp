@@ -0,0 +1,177 @@
+#ifndef GNURADIO_TRIGGER_DETECTOR_HPP
+#define GNURADIO_TRIGGER_DETECTOR_HPP
+
+#include <cmath>
+#include <span>
+#include <string>
+
+#include <vir/simd.h>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+namespace gr::basic {
+
+namespace trigger_detector {
+enum class Mode : int { RisingEdge, FallingEdge, Level, Window };
+using enum Mode;
+
+constexpr Mode
+parse(std::string_view name) {
+    auto mode = magic_enum::enum_cast<Mode>(name, magic_enum::case_insensitive);
+    if (!mode.has_value()) {
+        throw std::invalid_argument(fmt::format("unknown trigger detector mode '{}'", name));
+    }
+    return mode.value();
+}
+
+/**
+ * @return index of the first sample for which `pred` holds, or `data.size()` if none.
+ * `pred` is evaluated on `stdx::native_simd<T>` packs (returning a mask) and scalar samples for the remainder (returning a bool).
+ */
+template<typename T, typename Predicate>
+[[nodiscard]] constexpr std::size_t
+findFirst(std::span<const T> data, Predicate pred) noexcept {
+    using V       = vir::stdx::native_simd<T>;
+    std::size_t i = 0UZ;
+    for (; i + V::size() <= data.size(); i += V::size()) {
+        const auto mask = pred(V(&data[i], vir::stdx::element_aligned));
+        if (vir::stdx::any_of(mask)) {
+            return i + static_cast<std::size_t>(vir::stdx::find_first_set(mask));
+        }
+    }
+    for (; i < data.size(); ++i) {
+        if (pred(data[i])) {
+            return i;
+        }
+    }
+    return data.size();
+}
+
+} // namespace trigger_detector
+
+template<std::floating_point T>
+struct TriggerDetector : public gr::Block<TriggerDetector<T>> {
+    using Description = Doc<R""(
+@brief detects level, edge and window triggers directly on the sample stream and marks them with trigger tags.
+
+The samples are passed through unmodified. For each detected trigger, a tag containing `trigger_name` and
+`trigger_offset` (= 0) is published at the exact sample that fulfilled the trigger condition, so that downstream
+blocks (e.g. the triggered, multiplexed or snapshot listeners of a `DataSink`) can act upon it.
+
+All modes use a two-state (armed/triggered) hysteresis: after firing, the detector only re-arms once the signal
+crossed back beyond the threshold by more than `hysteresis`, suppressing multiple triggers due to noise:
+ * RisingEdge:  fires at x >= threshold,                 re-arms at x < threshold - hysteresis
+ * FallingEdge: fires at x <= threshold,                 re-arms at x > threshold + hysteresis
+ * Level:       fires at |x| >= threshold,               re-arms at |x| < threshold - hysteresis
+ * Window:      fires at x < window_min or x > window_max, re-arms within [window_min + hysteresis, window_max - hysteresis]
+Edge triggers require the signal to arm first, i.e. a stream starting beyond the threshold does not fire.
+
+The sample scan is vectorised (`stdx::native_simd<T>`) and skips through samples for which the state does not change.
+)"">;
+    PortIn<T>  in;
+    PortOut<T> out;
+
+    Annotated<std::string, "mode", Visible, Doc<"see trigger_detector::Mode">>                 mode         = "RisingEdge";
+    Annotated<T, "threshold", Visible, Doc<"trigger level for edge and level triggers">>       threshold    = T(0.);
+    Annotated<T, "hysteresis", Visible, Doc<"re-arm distance w.r.t. the trigger condition">>   hysteresis   = T(0.);
+    Annotated<T, "window min", Doc<"lower window limit">>                                     window_min   = T(-1.);
+    Annotated<T, "window max", Doc<"upper window limit">>                                     window_max   = T(+1.);
+    Annotated<std::string, "trigger name", Visible, Doc<"'trigger_name' of the published tags">> trigger_name = std::string("TriggerDetector");
+    gr::Size_t                                                                                 n_triggers   = 0U;
+
+private:
+    trigger_detector::Mode _mode      = trigger_detector::parse(mode);
+    bool                   _triggered = true; // edge triggers need to arm first
+    property_map           _triggerTag;
+
+public:
+    void
+    settingsChanged(const property_map & /*oldSettings*/, const property_map &newSettings) {
+        if (hysteresis < T(0.) || window_min > window_max) {
+            throw gr::exception(fmt::format("{} - invalid settings: hysteresis {} < 0 or window_min {} > window_max {}", this->name, hysteresis.value, window_min.value, window_max.value));
+        }
+        _mode = trigger_detector::parse(mode);
+        if (newSettings.contains("mode")) {
+            resetTriggerState();
+        }
+        _triggerTag = makeTriggerTag();
+    }
+
+    void
+    start() {
+        _triggerTag = makeTriggerTag();
+        resetTriggerState();
+    }
+
+    [[nodiscard]] work::Status
+    processBulk(std::span<const T> input, std::span<T> output) {
+        using enum trigger_detector::Mode;
+        std::ranges::copy(input, output.begin());
+        switch (_mode) {
+        case RisingEdge: scan(input, [t = threshold.value](const auto &x) { return x >= t; }, [r = threshold.value - hysteresis.value](const auto &x) { return x < r; }); break;
+        case FallingEdge: scan(input, [t = threshold.value](const auto &x) { return x <= t; }, [r = threshold.value + hysteresis.value](const auto &x) { return x > r; }); break;
+        case Level:
+            scan(
+                    input,
+                    [t = threshold.value](const auto &x) {
+                        using std::abs;
+                        return abs(x) >= t;
+                    },
+                    [r = threshold.value - hysteresis.value](const auto &x) {
+                        using std::abs;
+                        return abs(x) < r;
+                    });
+            break;
+        case Window:
+            scan(
+                    input, [lo = window_min.value, hi = window_max.value](const auto &x) { return x < lo || x > hi; },
+                    [lo = window_min.value + hysteresis.value, hi = window_max.value - hysteresis.value](const auto &x) { return x >= lo && x <= hi; });
+            break;
+        }
+        return work::Status::OK;
+    }
+
+private:
+    void
+    resetTriggerState() noexcept {
+        using enum trigger_detector::Mode;
+        _triggered = _mode == RisingEdge || _mode == FallingEdge;
+    }
+
+    [[nodiscard]] property_map
+    makeTriggerTag() const {
+        return { { std::string(tag::TRIGGER_NAME.shortKey()), trigger_name.value }, { std::string(tag::TRIGGER_OFFSET.shortKey()), 0.f } };
+    }
+
+    void
+    scan(std::span<const T> input, auto fire, auto rearm) {
+        std::size_t position = 0UZ;
+        while (position < input.size()) {
+            if (_triggered) {
+                position += trigger_detector::findFirst(input.subspan(position), rearm);
+                if (position < input.size()) {
+                    _triggered = false;
+                    ++position;
+                }
+            } else {
+                position += trigger_detector::findFirst(input.subspan(position), fire);
+                if (position < input.size()) {
+                    _triggered = true;
+                    out.publishTag(_triggerTag, static_cast<Tag::signed_index_type>(position));
+                    ++n_triggers;
+                    ++position;
+                }
+            }
+        }
+    }
+};
+
+} // namespace gr::basic
+
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::basic::TriggerDetector, in, out, mode, threshold, hysteresis, window_min, window_max, trigger_name, n_triggers);
+
+auto registerTriggerDetector = gr::registerBlock<gr::basic::TriggerDetector, float, double>(gr::globalBlockRegistry());
+
+#endif // GNURADIO_TRIGGER_DETECTOR_HPP
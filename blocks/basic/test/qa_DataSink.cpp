@@ -467,6 +467,53 @@ const boost::ut::suite DataSinkTests = [] {
         expect(eq(pollerWithTags->drop_count.load(), 0UZ));
     };
 
+    "DataSetPoller recycles consumed data sets"_test = [] {
+        DataSink<float>::DataSetPoller poller;
+        DataSet<float>                 tmpl;
+        tmpl.signal_names = { "test signal" };
+
+        auto first = poller.acquire(tmpl, 1024UZ);
+        expect(ge(first.signal_values.capacity(), 1024UZ));
+        first.signal_values.resize(1024UZ, 42.f);
+        first.timing_events[0].emplace_back(0, property_map{ { "key", "value" } });
+        first.meta_information.push_back(property_map{ { "key", "value" } });
+        const float *storage            = first.signal_values.data();
+        const auto  *signalNamesStorage = first.signal_names.data();
+        const auto  *timingStorage      = first.timing_events[0].data();
+        const auto  *metaStorage        = first.meta_information.data();
+        {
+            auto writeData = poller.writer.reserve(1UZ);
+            writeData[0]   = std::move(first);
+            writeData.publish(1UZ);
+        }
+        expect(poller.process([](std::span<const DataSet<float>> dataSets) {
+            expect(eq(dataSets.size(), 1UZ));
+            expect(eq(dataSets[0].signal_values.size(), 1024UZ));
+        }));
+
+        auto second = poller.acquire(tmpl, 1024UZ);
+        expect(second.signal_values.data() == storage) << "signal buffer is re-used";
+        expect(second.signal_values.empty());
+        expect(eq(second.signal_names, tmpl.signal_names));
+        expect(eq(second.timing_events.size(), 1UZ));
+        expect(second.timing_events[0].empty());
+        expect(second.signal_names.data() == signalNamesStorage) << "unchanged signal metadata is retained";
+        expect(second.timing_events[0].data() == timingStorage) << "timing events are cleared in place";
+        expect(second.meta_information.empty());
+        expect(second.meta_information.data() == metaStorage) << "meta information is cleared in place";
+
+        {
+            auto writeData = poller.writer.reserve(1UZ);
+            writeData[0]   = std::move(second);
+            writeData.publish(1UZ);
+        }
+        expect(poller.process([](std::span<const DataSet<float>>) {}));
+        tmpl.signal_names = { "renamed signal" }; // e.g. settings changed
+        auto third        = poller.acquire(tmpl, 1024UZ);
+        expect(third.signal_values.data() == storage);
+        expect(eq(third.signal_names, tmpl.signal_names)) << "changed signal metadata is updated";
+    };
+
     "blocking polling trigger mode non-overlapping"_test = [] {
         constexpr gr::Size_t kSamples = 200000;
 
@@ -902,6 +949,194 @@ const boost::ut::suite DataSinkTests = [] {
         const auto &[poller, samplesSeen] = polling.get();
         expect(eq(samplesSeen + poller->drop_count, static_cast<std::size_t>(kSamples)));
     };
+
+    "blocking pollers share one stream"_test = [] {
+        constexpr gr::Size_t  kSamples = 500'000;
+        constexpr std::size_t kPollers = 4;
+
+        gr::Graph testGraph;
+        auto     &src = testGraph.emplaceBlock<gr::testing::TagSource<float, gr::testing::ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", kSamples }, { "mark_tag", false } });
+        src.tags      = { { 0, { { "key", "value@0" } } }, { 100'000, { { "key", "value@100000" } } } };
+        auto &sink    = testGraph.emplaceBlock<DataSink<float>>({ { "name", "test_sink" } });
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(sink)));
+
+        std::vector<std::shared_ptr<DataSink<float>::Poller>>          pollers;
+        std::vector<std::future<std::pair<std::size_t, std::size_t>>> results;
+        for (std::size_t i = 0; i < kPollers; ++i) {
+            pollers.push_back(sink.getStreamingPoller(BlockingMode::Blocking));
+            results.push_back(std::async([poller = pollers.back()] {
+                std::size_t samplesSeen  = 0;
+                std::size_t keyTagsSeen  = 0;
+                bool        seenFinished = false;
+                while (!seenFinished) {
+                    seenFinished = poller->finished;
+                    while (poller->process([&samplesSeen, &keyTagsSeen](std::span<const float> data, std::span<const Tag> tags) {
+                        expect(eq(data.front(), static_cast<float>(samplesSeen)));
+                        keyTagsSeen += static_cast<std::size_t>(std::ranges::count_if(tags, [](const Tag &tag) { return tag.map.contains("key"); }));
+                        samplesSeen += data.size();
+                    })) {
+                    }
+                }
+                return std::make_pair(samplesSeen, keyTagsSeen);
+            }));
+        }
+
+        Scheduler sched{ std::move(testGraph) };
+        expect(sched.runAndWait().has_value());
+
+        for (std::size_t i = 0; i < kPollers; ++i) {
+            const auto [samplesSeen, keyTagsSeen] = results[i].get();
+            expect(eq(samplesSeen, static_cast<std::size_t>(kSamples)));
+            expect(eq(keyTagsSeen, 2UZ));
+            expect(eq(pollers[i]->drop_count.load(), 0UZ));
+            expect(eq(pollers[i]->readers->reader.buffer().n_readers(), kPollers)) << "pollers are readers of the same buffer";
+        }
+    };
+
+    "envelope poller"_test = [] {
+        constexpr gr::Size_t kSamples = 500'000;
+
+        gr::Graph testGraph;
+        auto     &src  = testGraph.emplaceBlock<gr::testing::TagSource<float, gr::testing::ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", kSamples }, { "mark_tag", false } });
+        auto     &sink = testGraph.emplaceBlock<DataSink<float>>({ { "name", "test_sink" }, { "sample_rate", 10'000.f } });
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(sink)));
+
+        auto poller = sink.getEnvelopePoller(100'000UZ);
+        expect(poller != nullptr);
+
+        auto uiThread = std::async([poller] { // mocks a UI update loop
+            std::vector<DataSink<float>::EnvelopePoller::Envelope> points(2000UZ);
+            std::size_t                                            nUpdates     = 0UZ;
+            bool                                                   seenFinished = false;
+            while (!seenFinished) {
+                seenFinished     = poller->finished;
+                const auto range = poller->envelope(points, std::chrono::seconds(5));
+                nUpdates += range.nPoints > 0UZ ? 1UZ : 0UZ;
+                for (std::size_t i = 1UZ; i < range.nPoints; ++i) {
+                    expect(le(points[i - 1UZ].max, points[i].min)) << "ramp is monotonic";
+                }
+            }
+            return nUpdates;
+        });
+
+        Scheduler sched{ std::move(testGraph) };
+        expect(sched.runAndWait().has_value());
+        expect(gt(uiThread.get(), 0UZ));
+
+        std::vector<DataSink<float>::EnvelopePoller::Envelope> points(1000UZ);
+        const auto range = poller->envelope(points, std::chrono::seconds(2)); // 2 s <-> 20k samples
+        expect(eq(range.nPoints, 1000UZ));
+        expect(eq(range.endSample, static_cast<std::uint64_t>(kSamples)));
+        expect(eq(range.endSample - range.firstSample, 20'000UZ));
+        const std::uint64_t nBuckets = (range.endSample - range.firstSample) / range.bucketSize;
+        for (std::size_t i = 0UZ; i < range.nPoints; ++i) { // ramp: min/max at the section boundaries, mean in between
+            const auto sectionBegin = range.firstSample + i * nBuckets / range.nPoints * range.bucketSize;
+            const auto sectionEnd   = range.firstSample + (i + 1UZ) * nBuckets / range.nPoints * range.bucketSize;
+            expect(eq(points[i].min, static_cast<float>(sectionBegin)));
+            expect(eq(points[i].max, static_cast<float>(sectionEnd - 1U)));
+            expect(approx(points[i].mean, 0.5f * (points[i].min + points[i].max), 1e-2f));
+        }
+    };
+
+    "listener registration while streaming"_test = [] {
+        constexpr gr::Size_t kSamples = 2'000'000;
+
+        gr::Graph testGraph;
+        auto     &src  = testGraph.emplaceBlock<gr::testing::TagSource<float, gr::testing::ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", kSamples }, { "mark_tag", false } });
+        auto     &sink = testGraph.emplaceBlock<DataSink<float>>({ { "name", "test_sink" } });
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(sink)));
+
+        auto poller  = sink.getStreamingPoller(BlockingMode::Blocking);
+        auto polling = std::async([poller] {
+            std::size_t samplesSeen  = 0;
+            bool        inOrder      = true;
+            bool        seenFinished = false;
+            while (!seenFinished) {
+                seenFinished = poller->finished;
+                while (poller->process([&samplesSeen, &inOrder](const auto &data) {
+                    inOrder = inOrder && data.front() == static_cast<float>(samplesSeen);
+                    samplesSeen += data.size();
+                })) {
+                }
+            }
+            return std::make_pair(samplesSeen, inOrder);
+        });
+
+        std::atomic<bool> stopChurn      = false;
+        std::size_t       nRegistrations = 0;
+        auto              churnThread    = std::thread([&sink, &stopChurn, &nRegistrations] {
+            while (!stopChurn) { // short-lived listeners that expire while the sink is processing
+                auto transient = sink.getStreamingPoller(BlockingMode::NonBlocking);
+                if (nRegistrations < 16UZ) {
+                    sink.registerStreamingCallback(1024UZ, [](std::span<const float>) {});
+                }
+                nRegistrations++;
+                std::this_thread::yield();
+            }
+        });
+
+        Scheduler sched{ std::move(testGraph) };
+        expect(sched.runAndWait().has_value());
+        stopChurn = true;
+        churnThread.join();
+
+        const auto &[samplesSeen, inOrder] = polling.get();
+        expect(gt(nRegistrations, 0UZ));
+        expect(eq(samplesSeen, static_cast<std::size_t>(kSamples)));
+        expect(inOrder);
+        expect(eq(poller->drop_count.load(), 0UZ));
+    };
+
+    "dropping blocking pollers while streaming"_test = [] {
+        constexpr gr::Size_t kSamples = 2'000'000;
+
+        gr::Graph testGraph;
+        auto     &src  = testGraph.emplaceBlock<gr::testing::TagSource<float, gr::testing::ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", kSamples }, { "mark_tag", false } });
+        auto     &sink = testGraph.emplaceBlock<DataSink<float>>({ { "name", "test_sink" } });
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(sink)));
+
+        auto poller  = sink.getStreamingPoller(BlockingMode::Blocking);
+        auto polling = std::async([poller] {
+            std::size_t samplesSeen  = 0;
+            bool        inOrder      = true;
+            bool        seenFinished = false;
+            while (!seenFinished) {
+                seenFinished = poller->finished;
+                while (poller->process([&samplesSeen, &inOrder](const auto &data) {
+                    inOrder = inOrder && data.front() == static_cast<float>(samplesSeen);
+                    samplesSeen += data.size();
+                })) {
+                }
+            }
+            return std::make_pair(samplesSeen, inOrder);
+        });
+
+        std::atomic<bool> stopChurn   = false;
+        std::size_t       nDropped    = 0;
+        auto              churnThread = std::thread([&sink, &stopChurn, &nDropped] {
+            while (!stopChurn) { // blocking pollers that are dropped (w/o consuming everything) while the sink writes to their stream
+                auto transient = sink.getStreamingPoller(BlockingMode::Blocking);
+                for (std::size_t nChunks = 0UZ; nChunks < 3UZ && !stopChurn;) {
+                    if (transient->process([](std::span<const float>) {})) {
+                        nChunks++;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                nDropped++;
+            }
+        });
+
+        Scheduler sched{ std::move(testGraph) };
+        expect(sched.runAndWait().has_value()) << "dropped pollers must not block the sink";
+        stopChurn = true;
+        churnThread.join();
+
+        const auto &[samplesSeen, inOrder] = polling.get();
+        expect(gt(nDropped, 0UZ));
+        expect(eq(samplesSeen, static_cast<std::size_t>(kSamples)));
+        expect(inOrder);
+    };
 };
 
 int
@@ -0,0 +1,134 @@
+#include <boost/ut.hpp>
+
+#include <filesystem>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+#include <gnuradio-4.0/basic/FileIo.hpp>
+#include <gnuradio-4.0/basic/MmapFileSource.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
+
+const boost::ut::suite FileIoTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+    using namespace gr::basic;
+    using namespace gr::testing;
+
+    static const std::filesystem::path testDirectory = std::filesystem::temp_directory_path() / "gr_qa_FileIo";
+
+    auto record = [](const std::string &fileName, gr::Size_t nSamples, std::uint64_t maxFileSize, const std::vector<Tag> &tags) {
+        Graph graph;
+        auto &src = graph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", nSamples }, { "mark_tag", false } });
+        src.tags  = tags;
+        auto &sink = graph.emplaceBlock<FileSink<float>>({ { "file_name", fileName }, { "max_file_size", maxFileSize }, { "batch_size", gr::Size_t{ 8192 } } });
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(sink)));
+        scheduler::Simple sched{ std::move(graph) };
+        expect(sched.runAndWait().has_value());
+        expect(eq(sink.n_bytes_written, static_cast<std::uint64_t>(nSamples) * sizeof(float)));
+    };
+
+    auto replay = [](const std::string &fileName, gr::Size_t nSamples) {
+        Graph graph;
+        auto &src  = graph.emplaceBlock<FileSource<float>>({ { "file_name", fileName } });
+        auto &sink = graph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_expected", nSamples } });
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(sink)));
+        scheduler::Simple sched{ std::move(graph) };
+        expect(sched.runAndWait().has_value());
+        expect(eq(src.n_samples_produced, static_cast<std::uint64_t>(nSamples)));
+        return std::pair{ sink.samples, sink.tags };
+    };
+
+    "FileSink -> FileSource round-trip"_test = [&record, &replay] {
+        std::filesystem::create_directories(testDirectory);
+        const std::string      fileName  = (testDirectory / "single.bin").string();
+        constexpr gr::Size_t   n_samples = 50'000;
+        const std::vector<Tag> tags{ { 0, { { "key", "value@0" } } }, { 1001, { { "key", "value@1001" } } }, { 40'000, { { "key", "value@40000" } } } };
+        record(fileName, n_samples, 0U, tags);
+        expect(eq(std::filesystem::file_size(fileName), static_cast<std::uintmax_t>(n_samples) * sizeof(float)));
+        expect(eq(file::readTagIndex(fileName).size(), tags.size()));
+
+        const auto [samples, receivedTags] = replay(fileName, n_samples);
+        expect(eq(samples.size(), static_cast<std::size_t>(n_samples)));
+        bool ascending = true;
+        for (std::size_t i = 0UZ; i < samples.size(); ++i) {
+            ascending = ascending && samples[i] == static_cast<float>(i);
+        }
+        expect(ascending) << "samples are replayed unaltered";
+        for (const Tag &tag : tags) {
+            expect(std::ranges::any_of(receivedTags, [&tag](const Tag &received) { return received.index == tag.index && received.map.at("key") == tag.map.at("key"); })) << fmt::format("tag at {} replayed", tag.index);
+        }
+        std::filesystem::remove_all(testDirectory);
+    };
+
+    "FileSink rotation"_test = [&record, &replay] {
+        std::filesystem::create_directories(testDirectory);
+        const std::string    fileName    = (testDirectory / "rotated.bin").string();
+        constexpr gr::Size_t n_samples   = 100'000;
+        constexpr auto       maxFileSize = std::uint64_t{ 64UZ * 1024UZ };
+        record(fileName, n_samples, maxFileSize, { { 20'000, { { "key", "value@20000" } } } });
+
+        const auto     segments = file::recordingSegments(fileName);
+        std::uintmax_t nBytes   = 0U;
+        expect(ge(segments.size(), (n_samples * sizeof(float) + maxFileSize - 1UZ) / maxFileSize));
+        for (const auto &segment : segments) {
+            expect(le(std::filesystem::file_size(segment), maxFileSize)) << segment.string();
+            nBytes += std::filesystem::file_size(segment);
+        }
+        expect(eq(nBytes, static_cast<std::uintmax_t>(n_samples) * sizeof(float)));
+
+        const auto [samples, receivedTags] = replay(fileName, n_samples);
+        expect(eq(samples.size(), static_cast<std::size_t>(n_samples)));
+        expect(std::ranges::equal(samples, std::views::iota(0UZ, static_cast<std::size_t>(n_samples)), [](float a, std::size_t b) { return a == static_cast<float>(b); }));
+        expect(std::ranges::any_of(receivedTags, [](const Tag &tag) { return tag.index == 20'000 && tag.map.contains("key"); })) << "tag in rotated segment";
+        std::filesystem::remove_all(testDirectory);
+    };
+
+    "MmapFileSource replay and seek"_test = [&record] {
+        std::filesystem::create_directories(testDirectory);
+        const std::string    fileName  = (testDirectory / "mapped.bin").string();
+        constexpr gr::Size_t n_samples = 100'000;
+        constexpr auto       t0        = std::uint64_t{ 1'000'000'000 };
+        record(fileName, n_samples, 128UZ * 1024UZ,
+               { { 0, { { std::string(tag::SAMPLE_RATE.shortKey()), 1000.f }, { std::string(tag::TRIGGER_TIME.shortKey()), t0 } } }, //
+                 { 50'000, { { std::string(tag::TRIGGER_TIME.shortKey()), t0 + 50'000'000'000UL } } } });
+
+        auto replayFrom = [&fileName](std::optional<std::int64_t> seekIndex) {
+            Graph graph;
+            auto &src  = graph.emplaceBlock<MmapFileSource<float>>({ { "file_name", fileName } });
+            auto &sink = graph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>();
+            expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(sink)));
+            if (seekIndex) {
+                Message seek;
+                seek.cmd      = message::Command::Set;
+                seek.endpoint = MmapFileSource<float>::kSeek;
+                seek.data     = property_map{ { "sample_index", *seekIndex } };
+                std::ignore   = src.propertyCallbackSeek(MmapFileSource<float>::kSeek, seek);
+            }
+            scheduler::Simple sched{ std::move(graph) };
+            expect(sched.runAndWait().has_value());
+            expect(eq(src.sampleIndexForTime(t0 + 2'000'000'000UL), 2'000UZ)) << "time-based seek w.r.t. first trigger";
+            expect(eq(src.sampleIndexForTime(t0 + 60'000'000'000UL), 60'000UZ)) << "time-based seek w.r.t. second trigger";
+            expect(throws([&src] { std::ignore = src.sampleIndexForTime(t0 - 1UL); })) << "time before first trigger";
+            return std::pair{ sink.samples, sink.tags };
+        };
+
+        const auto [samples, tags] = replayFrom(std::nullopt);
+        expect(eq(samples.size(), static_cast<std::size_t>(n_samples)));
+        expect(std::ranges::equal(samples, std::views::iota(0UZ, static_cast<std::size_t>(n_samples)), [](float a, std::size_t b) { return a == static_cast<float>(b); }));
+        expect(std::ranges::any_of(tags, [](const Tag &tag) { return tag.index == 50'000 && tag.map.contains(tag::TRIGGER_TIME.shortKey()); })) << "indexed tag re-injected";
+
+        const auto [seekedSamples, seekedTags] = replayFrom(75'000L);
+        expect(eq(seekedSamples.size(), static_cast<std::size_t>(n_samples) - 75'000UZ));
+        expect(eq(seekedSamples.front(), 75'000.f));
+        expect(std::ranges::none_of(seekedTags, [](const Tag &tag) { return tag.map.contains(tag::TRIGGER_TIME.shortKey()); })) << "tags before seek position are skipped";
+        std::filesystem::remove_all(testDirectory);
+    };
+};
+
+int
+main() { /* tests are statically executed */
+}
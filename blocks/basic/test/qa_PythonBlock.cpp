@@ -267,6 +267,82 @@ def process_bulk(ins, outs):
         expect(eq(sink.n_samples_produced, 5U)) << "sinkOne did not consume enough input samples";
         expect(eq(sink.samples, std::vector<float>{ 0.f, 2.f, 4.f, 6.f, 8.f })) << fmt::format("mismatch of vector {}", sink.samples);
     };
+
+    "cached NumPy arrays and batching settings"_test = [] {
+        std::string pythonScript = R"(retained = None
+
+def process_bulk(ins, outs):
+    global retained
+    if retained is None:
+        retained = ins[0] # keeps a reference -> must not be re-pointed to the data of the next call
+    outs[0][:] = retained + ins[0]
+)";
+
+        PythonBlock<float> myBlock({ { "n_inputs", 1U }, { "n_outputs", 1U }, { "pythonScript", pythonScript }, { "min_chunk_size", 64U }, { "dedicated_thread", true } });
+        myBlock.applyChangedSettings(); // needed for unit-test only when executed outside a Scheduler/Graph
+        expect(eq(myBlock.inputs[0].min_samples, 64UZ));
+        expect(myBlock._interpreter.hasDedicatedThread());
+
+        std::vector<float>                  data1 = { 1.f, 2.f, 3.f };
+        std::vector<float>                  data2 = { 10.f, 20.f, 30.f };
+        std::vector<float>                  out(3);
+        std::vector<std::span<float>>       outs = { out };
+        std::vector<std::span<const float>> ins  = { data1 };
+        myBlock.processBulk(std::span(ins), std::span(outs));
+        expect(eq(out, std::vector<float>{ 2.f, 4.f, 6.f }));
+
+        ins = { data2 };
+        myBlock.processBulk(std::span(ins), std::span(outs));
+        expect(eq(out, std::vector<float>{ 11.f, 22.f, 33.f })) << "retained array must still refer to the first input";
+    };
+
+    "dedicated interpreter thread shutdown"_test = [] {
+        std::string pythonScript = R"(def process_bulk(ins, outs):
+    outs[0][:] = ins[0]
+)";
+
+        PythonBlock<float> myBlock({ { "n_inputs", 1U }, { "n_outputs", 1U }, { "pythonScript", pythonScript }, { "dedicated_thread", true } });
+        myBlock.applyChangedSettings(); // needed for unit-test only when executed outside a Scheduler/Graph
+        auto &interpreter = myBlock._interpreter;
+        expect(interpreter.hasDedicatedThread());
+
+        expect(throws<gr::exception>([&interpreter] { interpreter.invoke([&interpreter] { interpreter.setDedicatedThread(false); }); })) << "thread cannot stop itself";
+        expect(interpreter.hasDedicatedThread());
+
+        {
+            gr::python::PyGILGuard guard; // N.B. a caller holding the GIL must not dead-lock the shutdown
+            interpreter.setDedicatedThread(false);
+        }
+        expect(not interpreter.hasDedicatedThread());
+    };
+
+    "Python call overhead [µs per call]"_test = [] {
+        std::string pythonScript = R"(def process_bulk(ins, outs):
+    for i in range(len(ins)):
+        outs[i][:] = ins[i] * 2
+)";
+        constexpr std::size_t nCalls = 10'000UZ;
+        for (const bool dedicatedThread : { false, true }) {
+            for (const std::size_t chunkSize : { 1UZ, 64UZ, 1024UZ }) {
+                PythonBlock<float> myBlock({ { "n_inputs", 1U }, { "n_outputs", 1U }, { "pythonScript", pythonScript }, { "dedicated_thread", dedicatedThread } });
+                myBlock.applyChangedSettings(); // needed for unit-test only when executed outside a Scheduler/Graph
+
+                std::vector<float>                  data(chunkSize, 1.f);
+                std::vector<float>                  out(chunkSize);
+                std::vector<std::span<const float>> ins  = { data };
+                std::vector<std::span<float>>       outs = { out };
+
+                const auto start = std::chrono::steady_clock::now();
+                for (std::size_t i = 0; i < nCalls; i++) {
+                    myBlock.processBulk(std::span(ins), std::span(outs));
+                }
+                const double usPerCall = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(nCalls);
+                fmt::println("PythonBlock<float> - dedicated thread: {:5} chunk size: {:4} -> {:7.3f} µs per call ({:8.4f} µs per sample)", dedicatedThread, chunkSize, usPerCall,
+                             usPerCall / static_cast<double>(chunkSize));
+                expect(eq(out.back(), 2.f));
+            }
+        }
+    };
 };
 
 int
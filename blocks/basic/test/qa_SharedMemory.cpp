@@ -0,0 +1,166 @@
+#include <boost/ut.hpp>
+
+#include <limits>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/SharedMemoryBuffer.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+#include <gnuradio-4.0/basic/SharedMemory.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
+
+const boost::ut::suite SharedMemoryBufferTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+    using namespace std::string_literals;
+
+    "SharedMemoryBuffer - open before create"_test = [] {
+        expect(throws<std::system_error>([] { std::ignore = SharedMemoryBuffer<float>::open("/gr_qa_shm_missing"); }));
+    };
+
+    "SharedMemoryBuffer - samples and tags"_test = [] {
+        auto writer = SharedMemoryBuffer<std::int32_t>::create("/gr_qa_shm_buffer", 1000UZ, 4UZ);
+        auto reader = SharedMemoryBuffer<std::int32_t>::open("/gr_qa_shm_buffer");
+        expect(writer.isOwner());
+        expect(not reader.isOwner());
+        expect(ge(writer.size(), 1000UZ));
+        expect(eq(writer.size(), reader.size()));
+        expect(throws<std::invalid_argument>([] { std::ignore = SharedMemoryBuffer<double>::open("/gr_qa_shm_buffer"); })) << "element size mismatch";
+
+        expect(throws<std::length_error>([&writer] { std::ignore = writer.tryPublishTag(0, { { "large", std::vector<double>(1024UZ) } }); })) << "tag exceeds slot";
+
+        const std::size_t capacity = writer.size();
+        std::int32_t      counter  = 0;
+        for (std::size_t iteration = 0UZ; iteration < 5UZ; ++iteration) { // cross the wrap-around several times
+            const std::size_t nSamples = capacity / 2UZ + 7UZ;
+            expect(eq(writer.availableForWrite(), capacity));
+            expect(writer.tryPublishTag(writer.writePosition(), { { "iteration", static_cast<std::int64_t>(iteration) } }));
+            std::ranges::generate(writer.reserve(nSamples), [&counter] { return counter++; });
+            writer.publish(nSamples);
+
+            expect(eq(reader.available(), nSamples));
+            const auto tagIndex = reader.nextTagIndex();
+            expect(tagIndex.has_value()) << fatal;
+            expect(eq(*tagIndex, reader.readPosition()));
+            const Tag tag = reader.consumeTag();
+            expect(eq(std::get<std::int64_t>(tag.map.at("iteration")), static_cast<std::int64_t>(iteration)));
+            expect(not reader.nextTagIndex().has_value());
+
+            const auto data = reader.get(nSamples);
+            expect(eq(data.front(), counter - static_cast<std::int32_t>(nSamples)));
+            expect(eq(data.back(), counter - 1));
+            expect(std::ranges::adjacent_find(data, [](auto a, auto b) { return b != a + 1; }) == data.end()) << "contiguous across wrap-around";
+            reader.consume(nSamples);
+        }
+
+        for (std::size_t i = 0UZ; i < 4UZ; ++i) {
+            expect(writer.tryPublishTag(writer.writePosition(), { { "index", static_cast<std::int64_t>(i) } }));
+        }
+        expect(not writer.tryPublishTag(writer.writePosition(), { { "overflow", true } })) << "tag ring full";
+
+        expect(not reader.isClosed());
+        writer.close();
+        expect(reader.isClosed());
+    };
+
+    "SharedMemoryBuffer - corrupted tag size"_test = [] {
+        const std::string name   = "/gr_qa_shm_corrupt";
+        auto              writer = SharedMemoryBuffer<float>::create(name, 1000UZ, 4UZ);
+        auto              reader = SharedMemoryBuffer<float>::open(name);
+        expect(writer.tryPublishTag(0, { { "key", "value"s } }));
+
+        const int fd = shm_open(name.c_str(), O_RDWR, 0);
+        expect(ge(fd, 0)) << fatal;
+        const std::size_t mapBytes = sizeof(shm::SegmentHeader) + shm::kTagSlotSize;
+        void             *mapped   = mmap(nullptr, mapBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        expect(mapped != MAP_FAILED) << fatal;
+        auto *slot = reinterpret_cast<shm::TagSlot *>(static_cast<std::uint8_t *>(mapped) + sizeof(shm::SegmentHeader)); // first tag slot
+        slot->size = std::numeric_limits<std::uint32_t>::max();                                                        // e.g. corrupted or malicious peer
+        munmap(mapped, mapBytes);
+        expect(throws<std::length_error>([&reader] { std::ignore = reader.consumeTag(); })) << "tag size beyond the slot is rejected";
+    };
+
+    "SharedMemoryBuffer - live and stale owners"_test = [] {
+        const std::string name = "/gr_qa_shm_owner";
+        {
+            auto owner = SharedMemoryBuffer<float>::create(name, 1000UZ);
+            expect(throws<std::system_error>([&name] { std::ignore = SharedMemoryBuffer<float>::create(name, 1000UZ); })) << "must not replace a live owner's segment";
+            auto reader = SharedMemoryBuffer<float>::open(name);
+            std::ranges::fill(owner.reserve(10UZ), 42.f);
+            owner.publish(10UZ);
+            expect(eq(reader.available(), 10UZ)) << "reader still attached to the original segment";
+        }
+
+        const pid_t child = fork();
+        if (child == 0) { // simulate a crashed owner: create the segment and exit w/o cleaning up
+            [[maybe_unused]] auto leaked = SharedMemoryBuffer<float>::create(name, 1000UZ);
+            _exit(0); // N.B. skips the destructor, i.e. the segment is not unlinked
+        }
+        expect(gt(child, 0)) << fatal;
+        int status = 0;
+        expect(eq(waitpid(child, &status, 0), child));
+        auto replacement = SharedMemoryBuffer<float>::create(name, 1000UZ);
+        expect(replacement.isOwner()) << "stale segment of a dead owner is replaced";
+    };
+
+    "ShmSink restart"_test = [] {
+        basic::ShmSink<float> sink({ { "shm_name", "/gr_qa_shm_restart"s } });
+        sink.start();
+        sink.stop();
+        expect(nothrow([&sink] { sink.start(); })) << "re-creates the segment it owned before";
+        sink.stop();
+    };
+
+    "ShmSink -> ShmSource across two graphs"_test = [] {
+        using namespace gr::testing;
+        constexpr gr::Size_t n_samples = 100'000;
+        const std::string    shmName   = "/gr_qa_shm_graph";
+
+        Graph writerGraph;
+        auto &src = writerGraph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", n_samples }, { "mark_tag", false } });
+        src.tags  = { { 0, { { "key", "value@0" } } }, { 1000, { { "key", "value@1000" } } }, { 70'000, { { "key", "value@70000" } } } };
+        auto &shmSink = writerGraph.emplaceBlock<basic::ShmSink<float>>({ { "shm_name", shmName }, { "buffer_size", gr::Size_t{ 4096 } } });
+        expect(eq(ConnectionResult::SUCCESS, writerGraph.connect<"out">(src).to<"in">(shmSink)));
+
+        Graph readerGraph;
+        auto &shmSource = readerGraph.emplaceBlock<basic::ShmSource<float>>({ { "shm_name", shmName } });
+        auto &sink      = readerGraph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_expected", n_samples } });
+        expect(eq(ConnectionResult::SUCCESS, readerGraph.connect<"out">(shmSource).to<"in">(sink)));
+
+        scheduler::Simple readerScheduler{ std::move(readerGraph) };
+        scheduler::Simple writerScheduler{ std::move(writerGraph) };
+        std::thread       readerThread([&readerScheduler] { expect(readerScheduler.runAndWait().has_value()); });
+        expect(writerScheduler.runAndWait().has_value());
+        readerThread.join();
+
+        expect(eq(sink.n_samples_produced, n_samples));
+        expect(eq(sink.samples.size(), static_cast<std::size_t>(n_samples)));
+        bool ascending = true;
+        for (std::size_t i = 0UZ; i < sink.samples.size(); ++i) {
+            ascending = ascending && sink.samples[i] == static_cast<float>(i);
+        }
+        expect(ascending) << "samples are transported in order and unaltered";
+
+        const auto received = std::ranges::count_if(sink.tags, [](const Tag &tag) { return tag.map.contains("key"); });
+        expect(eq(received, 3L));
+        for (const Tag &tag : sink.tags) {
+            if (tag.map.contains("key")) {
+                expect(eq(std::get<std::string>(tag.map.at("key")), fmt::format("value@{}", tag.index)));
+            }
+        }
+    };
+};
+
+int
+main() { /* tests are statically executed */
+}
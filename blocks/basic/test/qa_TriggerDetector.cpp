@@ -0,0 +1,154 @@
+#include <boost/ut.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+#include <gnuradio-4.0/basic/DataSink.hpp>
+#include <gnuradio-4.0/basic/TriggerDetector.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
+
+namespace {
+
+/// scalar reference of the detector state machine
+std::vector<gr::Tag::signed_index_type>
+referenceTriggers(const std::vector<float> &signal, gr::basic::trigger_detector::Mode mode, float threshold, float hysteresis, float windowMin, float windowMax) {
+    using enum gr::basic::trigger_detector::Mode;
+    std::vector<gr::Tag::signed_index_type> triggers;
+    bool                                    triggered = mode == RisingEdge || mode == FallingEdge;
+    for (std::size_t i = 0; i < signal.size(); ++i) {
+        const float x = signal[i];
+        bool        fire{};
+        bool        rearm{};
+        switch (mode) {
+        case RisingEdge: fire = x >= threshold, rearm = x < threshold - hysteresis; break;
+        case FallingEdge: fire = x <= threshold, rearm = x > threshold + hysteresis; break;
+        case Level: fire = std::abs(x) >= threshold, rearm = std::abs(x) < threshold - hysteresis; break;
+        case Window: fire = x < windowMin || x > windowMax, rearm = x >= windowMin + hysteresis && x <= windowMax - hysteresis; break;
+        }
+        if (triggered && rearm) {
+            triggered = false;
+        } else if (!triggered && fire) {
+            triggered = true;
+            triggers.push_back(static_cast<gr::Tag::signed_index_type>(i));
+        }
+    }
+    return triggers;
+}
+
+} // namespace
+
+const boost::ut::suite TriggerDetectorTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+    using namespace gr::basic;
+    using namespace gr::testing;
+    using namespace std::string_literals;
+
+    "findFirst"_test = [] {
+        std::vector<float> data(1001UZ, 0.f);
+        auto               isSet = [](const auto &x) { return x > 0.5f; };
+        expect(eq(trigger_detector::findFirst(std::span<const float>(data), isSet), data.size())) << "no match";
+        for (std::size_t index : { 0UZ, 1UZ, 7UZ, 63UZ, 777UZ, 999UZ, 1000UZ }) {
+            std::ranges::fill(data, 0.f);
+            data[index] = 1.f;
+            expect(eq(trigger_detector::findFirst(std::span<const float>(data), isSet), index));
+        }
+    };
+
+    auto runDetector = [](const std::vector<float> &signal, const property_map &settings) {
+        Graph graph;
+        auto &src      = graph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", static_cast<gr::Size_t>(signal.size()) } });
+        src.values     = signal;
+        auto &detector = graph.emplaceBlock<TriggerDetector<float>>(settings);
+        auto &sink     = graph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>();
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(detector)));
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(detector).to<"in">(sink)));
+        scheduler::Simple sched{ std::move(graph) };
+        expect(sched.runAndWait().has_value());
+        expect(eq(sink.samples, signal)) << "samples are passed through";
+
+        std::vector<Tag::signed_index_type> triggers;
+        for (const Tag &tag : sink.tags) {
+            if (tag.map.contains(tag::TRIGGER_NAME.shortKey())) {
+                triggers.push_back(tag.index);
+            }
+        }
+        expect(eq(static_cast<std::size_t>(detector.n_triggers), triggers.size()));
+        return triggers;
+    };
+
+    "hysteresis"_test = [&runDetector] {
+        std::vector<float> signal;
+        for (std::size_t period = 0; period < 100UZ; ++period) { // rising edge at 50 followed by a noise dip at 51
+            signal.insert(signal.end(), 50UZ, -1.f);
+            signal.insert(signal.end(), { 0.6f, 0.4f });
+            signal.insert(signal.end(), 48UZ, +1.f);
+        }
+        const auto withHysteresis = runDetector(signal, { { "mode", "RisingEdge" }, { "threshold", 0.5f }, { "hysteresis", 0.3f } });
+        expect(eq(withHysteresis.size(), 100UZ));
+        expect(std::ranges::all_of(withHysteresis, [](auto index) { return index % 100 == 50; }));
+
+        const auto withoutHysteresis = runDetector(signal, { { "mode", "RisingEdge" }, { "threshold", 0.5f }, { "hysteresis", 0.f } });
+        expect(eq(withoutHysteresis.size(), 200UZ)) << "noise dip re-arms the trigger";
+    };
+
+    "all modes vs. scalar reference"_test = [&runDetector] {
+        std::mt19937                    rng(42);
+        std::normal_distribution<float> noise(0.f, 0.05f);
+        std::vector<float>              signal(100'003UZ);
+        for (std::size_t i = 0; i < signal.size(); ++i) {
+            signal[i] = std::sin(2.f * std::numbers::pi_v<float> * static_cast<float>(i) / 997.f) + noise(rng);
+        }
+
+        for (const auto mode : magic_enum::enum_values<trigger_detector::Mode>()) {
+            const auto triggers = runDetector(signal, { { "mode", std::string(magic_enum::enum_name(mode)) }, { "threshold", 0.5f }, { "hysteresis", 0.2f }, { "window_min", -0.7f }, { "window_max", 0.8f } });
+            const auto expected = referenceTriggers(signal, mode, 0.5f, 0.2f, -0.7f, 0.8f);
+            expect(gt(expected.size(), 90UZ)) << magic_enum::enum_name(mode);
+            expect(eq(triggers, expected)) << magic_enum::enum_name(mode);
+        }
+    };
+
+    "TriggerDetector -> DataSink triggered acquisition"_test = [] {
+        constexpr gr::Size_t n_samples = 50'000;
+        std::vector<float>   signal(1000UZ);
+        for (std::size_t i = 0; i < signal.size(); ++i) {
+            signal[i] = static_cast<float>(i % 250UZ) / 250.f; // saw-tooth, rising edge at 0.5 every 250 samples
+        }
+
+        Graph graph;
+        auto &src      = graph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", n_samples } });
+        src.values     = signal;
+        auto &detector = graph.emplaceBlock<TriggerDetector<float>>({ { "mode", "RisingEdge" }, { "threshold", 0.5f }, { "trigger_name", "edge" } });
+        auto &sink     = graph.emplaceBlock<DataSink<float>>({ { "name", "trigger_sink" } });
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(detector)));
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(detector).to<"in">(sink)));
+
+        std::vector<DataSet<float>> dataSets;
+        auto                        isEdge = [](const Tag &tag) {
+            const auto it = tag.map.find(std::string(tag::TRIGGER_NAME.shortKey()));
+            return it != tag.map.end() && std::get<std::string>(it->second) == "edge" ? TriggerMatchResult::Matching : TriggerMatchResult::Ignore;
+        };
+        sink.registerTriggerCallback(isEdge, 3UZ, 5UZ, [&dataSets](DataSet<float> &&dataSet) { dataSets.push_back(std::move(dataSet)); });
+
+        scheduler::Simple sched{ std::move(graph) };
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(dataSets.size(), static_cast<std::size_t>(n_samples) / 250UZ)); // edges at 125 + k * 250
+        for (const auto &dataSet : dataSets) {
+            expect(eq(dataSet.signal_values.size(), 8UZ));
+            expect(eq(dataSet.signal_values[3], 0.5f)) << "trigger at the first sample >= threshold";
+            expect(lt(dataSet.signal_values[2], 0.5f));
+        }
+    };
+};
+
+int
+main() { /* tests are statically executed */
+}
@@ -3,7 +3,9 @@
 
 #include "gnuradio-4.0/BlockRegistry.hpp"
 #include <algorithm>
+#include <array>
 
+#include <gnuradio-4.0/algorithm/EnvelopePyramid.hpp>
 #include <gnuradio-4.0/algorithm/ImChart.hpp>
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
@@ -16,13 +18,17 @@ namespace gr::testing {
 template<typename T>
 struct ImChartMonitor : public Block<ImChartMonitor<T>, BlockingIO<false>, Drawable<UICategory::ChartPane, "console">> {
     using ClockSourceType = std::chrono::system_clock;
+    using Envelope        = typename gr::graphs::EnvelopePyramid<T>::Envelope;
     PortIn<T>   in;
     float       sample_rate = 1000.0f;
     std::string signal_name = "unknown signal";
 
-    HistoryBuffer<T>   _historyBufferX{ 1000 };
-    HistoryBuffer<T>   _historyBufferY{ 1000 };
-    HistoryBuffer<Tag> _historyBufferTags{ 1000 };
+    static constexpr std::size_t kChartWidth  = 130UZ;
+    static constexpr std::size_t kChartHeight = 28UZ;
+
+    gr::graphs::EnvelopePyramid<T>          _envelope{ 1000UZ };
+    HistoryBuffer<Tag>                      _historyBufferTags{ 1000 }; // N.B. indices are absolute w.r.t. '_envelope'
+    std::array<Envelope, 2UZ * kChartWidth> _points{};                  // one point per horizontal braille dot
 
     void
     start() {
@@ -35,38 +41,52 @@ struct ImChartMonitor : public Block<ImChartMonitor<T>, BlockingIO<false>, Drawa
         fmt::println("stopped sink {} aka. '{}'", this->unique_name, this->name);
     }
 
-    constexpr void
-    processOne(const T &input) noexcept {
+    work::Status
+    processBulk(std::span<const T> input) noexcept {
         in.max_samples = static_cast<std::size_t>(2.f * sample_rate / 25.f);
-        const float Ts = 1.0f / sample_rate;
-        _historyBufferX.push_back(_historyBufferX[1] + static_cast<T>(Ts));
-        _historyBufferY.push_back(input);
-
         if (this->input_tags_present()) { // received tag
-            _historyBufferTags.push_back(this->mergedInputTag());
-            _historyBufferTags[1].index = 0;
+            Tag tag   = this->mergedInputTag();
+            tag.index = static_cast<Tag::signed_index_type>(_envelope.nSamplesTotal());
+            _historyBufferTags.push_back(std::move(tag));
             this->_mergedInputTag.map.clear(); // TODO: provide proper API for clearing tags
-        } else {
-            _historyBufferTags.push_back(Tag(-1, property_map()));
         }
+        _envelope.push_back_bulk(input); // min/max envelope is decimated incrementally -> draw() is O(chart width)
+        return work::Status::OK;
     }
 
     work::Status
     draw() noexcept {
-        [[maybe_unused]] const work::Status status = this->invokeWork(); // calls work(...) -> processOne(...) (all in the same thread as this 'draw()'
-        const auto [xMin, xMax]                    = std::ranges::minmax_element(_historyBufferX);
-        const auto [yMin, yMax]                    = std::ranges::minmax_element(_historyBufferY);
-        if (_historyBufferX.empty() || *xMin == *xMax || *yMin == *yMax) {
-            return status; // buffer or axes' ranges are empty -> skip drawing
+        [[maybe_unused]] const work::Status status = this->invokeWork(); // calls work(...) -> processBulk(...) (all in the same thread as this 'draw()'
+        const auto                          range  = _envelope.envelope(_points, _envelope.capacity());
+        if (range.nPoints < 2UZ) {
+            return status; // buffer is empty -> skip drawing
+        }
+        const auto     points       = std::span(_points).first(range.nPoints);
+        const auto     samplesPoint = static_cast<double>(range.endSample - range.firstSample) / static_cast<double>(range.nPoints);
+        std::vector<T> xValues(points.size());
+        std::vector<T> yMin(points.size());
+        std::vector<T> yMax(points.size());
+        std::vector<T> yTag(points.size(), T(0));
+        for (std::size_t i = 0UZ; i < points.size(); ++i) {
+            xValues[i] = static_cast<T>((static_cast<double>(range.firstSample) + (static_cast<double>(i) + 0.5) * samplesPoint) / static_cast<double>(sample_rate));
+            yMin[i]    = points[i].min;
+            yMax[i]    = points[i].max;
+        }
+        for (const Tag &tag : _historyBufferTags) {
+            if (tag.index >= static_cast<Tag::signed_index_type>(range.firstSample) && tag.index < static_cast<Tag::signed_index_type>(range.endSample)) {
+                const auto i = static_cast<std::size_t>(static_cast<double>(static_cast<std::uint64_t>(tag.index) - range.firstSample) / samplesPoint);
+                yTag[std::min(i, points.size() - 1UZ)] = points[std::min(i, points.size() - 1UZ)].max;
+            }
+        }
+
+        const auto xMin = xValues.front();
+        const auto xMax = xValues.back();
+        const auto yLow = std::ranges::min(yMin);
+        const auto yUp  = std::ranges::max(yMax);
+        if (xMin == xMax || yLow == yUp) {
+            return status; // axes' ranges are empty -> skip drawing
         }
         fmt::println("\033[2J\033[H");
-        // create reversed copies -- draw(...) expects std::ranges::input_range ->
-        // TODO: change draw routine and/or write wrapper and/or provide direction option to HistoryBuffer
-        std::vector<T> reversedX(_historyBufferX.rbegin(), _historyBufferX.rend());
-        std::vector<T> reversedY(_historyBufferY.rbegin(), _historyBufferY.rend());
-        std::vector<T> reversedTag(_historyBufferX.size());
-        std::transform(_historyBufferTags.rbegin(), _historyBufferTags.rend(), _historyBufferY.rbegin(), reversedTag.begin(),
-                       [](const Tag &tag, const T &yValue) { return tag.index < 0 ? T(0) : yValue; });
 
         auto adjustRange = [](T min, T max) {
             min            = std::min(min, T(0));
@@ -75,11 +95,12 @@ struct ImChartMonitor : public Block<ImChartMonitor<T>, BlockingIO<false>, Drawa
             return std::pair<double, double>{ min - margin, max + margin };
         };
 
-        auto chart = gr::graphs::ImChart<130, 28>({ { *xMin, *xMax }, adjustRange(*yMin, *yMax) });
-        chart.draw(reversedX, reversedY, signal_name);
-        chart.draw<gr::graphs::Style::Marker>(reversedX, reversedTag, "Tags");
+        auto chart = gr::graphs::ImChart<kChartWidth, kChartHeight>({ { xMin, xMax }, adjustRange(yLow, yUp) });
+        chart.draw(xValues, yMax, signal_name + " max");
+        chart.draw(xValues, yMin, signal_name + " min");
+        chart.draw<gr::graphs::Style::Marker>(xValues, yTag, "Tags");
         chart.draw();
-        fmt::println("buffer has {} samples - status {:10} # graph range x = [{:2.2}, {:2.2}] y = [{:2.2}, {:2.2}]", _historyBufferX.size(), magic_enum::enum_name(status), *xMin, *xMax, *yMin, *yMax);
+        fmt::println("buffer has {} samples ({} samples/bucket) - status {:10} # graph range x = [{:2.2}, {:2.2}] y = [{:2.2}, {:2.2}]", _envelope.size(), range.bucketSize, magic_enum::enum_name(status), xMin, xMax, yLow, yUp);
         return status;
     }
 };
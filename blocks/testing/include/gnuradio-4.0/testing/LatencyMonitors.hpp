@@ -0,0 +1,290 @@
+#ifndef GNURADIO_TESTING_LATENCYMONITORS_HPP
+#define GNURADIO_TESTING_LATENCYMONITORS_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/reflection.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+namespace gr::testing {
+
+/// tag key carrying the monotonic (std::chrono::steady_clock) time-stamp [ns] at which the tagged sample passed a `LatencyStamp` block
+inline constexpr const char *kLatencyStamp = "latency_stamp";
+
+/**
+ * HDR-style (log-linear) latency histogram with a constant relative bucket resolution of 2^-(kPrecisionBits-1) (~1.6%)
+ * over the full [0, 2^64) ns range and a fixed memory footprint (no allocation while recording).
+ *
+ * Values below 2^kPrecisionBits are recorded exactly, larger values are grouped into 2^(kPrecisionBits-1) linear
+ * sub-buckets per power of two. Percentiles return the upper bound of the bucket (i.e. 'highest equivalent value').
+ */
+class LatencyHistogram {
+public:
+    static constexpr std::size_t kPrecisionBits = 7UZ;
+    static constexpr std::size_t kSubBuckets    = 1UZ << (kPrecisionBits - 1UZ);
+    static constexpr std::size_t kNBuckets      = (64UZ - kPrecisionBits + 2UZ) * kSubBuckets;
+
+private:
+    std::array<std::uint64_t, kNBuckets> _counts{};
+    std::uint64_t                        _count = 0U;
+    std::uint64_t                        _min   = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t                        _max   = 0U;
+    long double                          _sum   = 0.0L;
+
+public:
+    [[nodiscard]] static constexpr std::size_t
+    bucketIndex(std::uint64_t value) noexcept {
+        const auto msb = static_cast<std::size_t>(std::bit_width(value)); // == floor(log2(value)) + 1
+        if (msb <= kPrecisionBits) {
+            return static_cast<std::size_t>(value);
+        }
+        const std::size_t shift = msb - kPrecisionBits;
+        return shift * kSubBuckets + static_cast<std::size_t>(value >> shift);
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t
+    bucketUpperBound(std::size_t index) noexcept {
+        if (index < 2UZ * kSubBuckets) {
+            return index;
+        }
+        const std::size_t shift = index / kSubBuckets - 1UZ;
+        const std::size_t sub   = index - shift * kSubBuckets;
+        return ((static_cast<std::uint64_t>(sub) + 1U) << shift) - 1U;
+    }
+
+    constexpr void
+    record(std::uint64_t valueNs, std::uint64_t count = 1U) noexcept {
+        _counts[bucketIndex(valueNs)] += count;
+        _count += count;
+        _min = std::min(_min, valueNs);
+        _max = std::max(_max, valueNs);
+        _sum += static_cast<long double>(valueNs) * static_cast<long double>(count);
+    }
+
+    constexpr void
+    merge(const LatencyHistogram &other) noexcept {
+        for (std::size_t i = 0UZ; i < kNBuckets; i++) {
+            _counts[i] += other._counts[i];
+        }
+        _count += other._count;
+        _min = std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+        _sum += other._sum;
+    }
+
+    constexpr void
+    reset() noexcept {
+        _counts.fill(0U);
+        _count = 0U;
+        _min   = std::numeric_limits<std::uint64_t>::max();
+        _max   = 0U;
+        _sum   = 0.0L;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t
+    count() const noexcept {
+        return _count;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t
+    min() const noexcept {
+        return _count == 0U ? 0U : _min;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t
+    max() const noexcept {
+        return _max;
+    }
+
+    [[nodiscard]] constexpr double
+    mean() const noexcept {
+        return _count == 0U ? 0.0 : static_cast<double>(_sum / static_cast<long double>(_count));
+    }
+
+    /// @return latency [ns] below or at which 'quantile' (in [0, 1]) of all recorded values lie
+    [[nodiscard]] constexpr std::uint64_t
+    percentile(double quantile) const noexcept {
+        if (_count == 0U) {
+            return 0U;
+        } else if (quantile <= 0.0) {
+            return _min;
+        }
+        const double  exactRank  = std::clamp(quantile, 0.0, 1.0) * static_cast<double>(_count);
+        auto          rank       = static_cast<std::uint64_t>(exactRank);
+        rank                     = std::max<std::uint64_t>(1U, static_cast<double>(rank) < exactRank ? rank + 1U : rank); // nearest-rank method
+        std::uint64_t cumulative = 0U;
+        for (std::size_t i = 0UZ; i < kNBuckets; i++) {
+            cumulative += _counts[i];
+            if (cumulative >= rank) {
+                return std::clamp(bucketUpperBound(i), min(), _max);
+            }
+        }
+        return _max;
+    }
+
+    /// @return summary statistics [ns] and the non-empty buckets ('bucket_upper_ns', 'bucket_counts') e.g. for message-based export
+    [[nodiscard]] property_map
+    toPropertyMap() const {
+        std::vector<std::uint64_t> upper;
+        std::vector<std::uint64_t> counts;
+        for (std::size_t i = 0UZ; i < kNBuckets; i++) {
+            if (_counts[i] != 0U) {
+                upper.push_back(bucketUpperBound(i));
+                counts.push_back(_counts[i]);
+            }
+        }
+        return { { "count", _count }, { "min_ns", min() }, { "max_ns", max() }, { "mean_ns", mean() },              //
+                 { "p50_ns", percentile(0.5) }, { "p90_ns", percentile(0.9) }, { "p99_ns", percentile(0.99) },   //
+                 { "p99.9_ns", percentile(0.999) }, { "bucket_upper_ns", std::move(upper) }, { "bucket_counts", std::move(counts) } };
+    }
+};
+
+/**
+ * Pass-through block that marks every 'stamp_interval'-th sample with a `latency_stamp` tag holding the current
+ * monotonic time. It should be placed directly behind the (ADC) source whose latency is of interest.
+ */
+template<typename T>
+struct LatencyStamp : public Block<LatencyStamp<T>> {
+    using Description = Doc<R""(
+@brief stamps every 'stamp_interval'-th sample with the monotonic time [ns] at which it passed this block (tag key: 'latency_stamp')
+
+To be used together with a downstream `LatencyMonitor<T>` (in the same process) to measure the end-to-end latency of the samples.
+)"">;
+
+    PortIn<T>  in;
+    PortOut<T> out;
+
+    Annotated<gr::Size_t, "stamp interval", Visible, Doc<"number of samples between two latency stamps">, Limits<1U, std::numeric_limits<gr::Size_t>::max()>> stamp_interval = 1024U;
+    std::uint64_t                                                                                                                                   n_stamps{ 0U };
+
+private:
+    std::uint64_t _nSamples = 0U;
+
+public:
+    void
+    start() {
+        _nSamples = 0U;
+        n_stamps  = 0U;
+    }
+
+    work::Status
+    processBulk(ConsumableSpan auto &input, PublishableSpan auto &output) {
+        const std::size_t available = std::min(input.size(), output.size());
+        if (available == 0UZ) {
+            std::ignore = input.consume(0UZ);
+            output.publish(0UZ);
+            return work::Status::INSUFFICIENT_INPUT_ITEMS;
+        }
+        const std::uint64_t phase = _nSamples % stamp_interval;
+        if (phase == 0U) {
+            const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            out.publishTag({ { kLatencyStamp, static_cast<std::uint64_t>(now) } }, 0);
+            this->_outputTagsChanged = true;
+            n_stamps++;
+        }
+        const auto nSamples = std::min(available, static_cast<std::size_t>(stamp_interval - phase)); // next stamp must coincide with the start of a chunk
+        std::copy_n(input.begin(), nSamples, output.begin());
+        std::ignore = input.consume(nSamples);
+        output.publish(nSamples);
+        _nSamples += nSamples;
+        return work::Status::OK;
+    }
+};
+
+/**
+ * Pass-through block that records the latency of every `latency_stamp`-tagged sample into a `LatencyHistogram`.
+ * The histogram is accessible directly via 'histogram' or via the `Latency` message property (Get, Set{ "reset": true },
+ * Subscribe/Unsubscribe: notified every 'notify_interval' stamps and when the block stops).
+ */
+template<typename T>
+struct LatencyMonitor : public Block<LatencyMonitor<T>> {
+    using Description = Doc<R""(
+@brief records the latency between an upstream `LatencyStamp<T>` and this block for each stamped sample into an HDR-style histogram
+)"">;
+    static inline const char *kLatency = "Latency";
+
+    PortIn<T>  in;
+    PortOut<T> out;
+
+    Annotated<gr::Size_t, "notify interval", Doc<"number of stamps between two notifications of 'Latency' subscribers (0: only on stop)">> notify_interval = 1000U;
+
+    LatencyHistogram histogram;
+
+    void
+    start() {
+        histogram.reset();
+        this->propertyCallbacks.emplace(kLatency, &LatencyMonitor::propertyCallbackLatency);
+    }
+
+    void
+    stop() {
+        this->notifyListeners(kLatency, histogram.toPropertyMap());
+    }
+
+    work::Status
+    processBulk(std::span<const T> input, std::span<T> output) {
+        if (this->input_tags_present()) {
+            if (const auto it = this->mergedInputTag().map.find(kLatencyStamp); it != this->mergedInputTag().map.end() && std::holds_alternative<std::uint64_t>(it->second)) {
+                const auto now   = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+                const auto stamp = std::get<std::uint64_t>(it->second);
+                histogram.record(now > stamp ? now - stamp : 0U);
+                if (notify_interval > 0U && histogram.count() % notify_interval == 0U) {
+                    this->notifyListeners(kLatency, histogram.toPropertyMap());
+                }
+            }
+        }
+        std::ranges::copy(input, output.begin());
+        return work::Status::OK;
+    }
+
+    std::optional<Message>
+    propertyCallbackLatency(std::string_view propertyName, Message message) {
+        using enum gr::message::Command;
+        assert(kLatency == propertyName);
+
+        if (message.cmd == Set) {
+            if (!message.data.has_value()) {
+                throw gr::exception(fmt::format("block {} (aka. {}) cannot set {} w/o data msg: {}", this->unique_name, this->name, propertyName, message));
+            }
+            if (auto it = message.data->find("reset"); it != message.data->end() && std::holds_alternative<bool>(it->second) && std::get<bool>(it->second)) {
+                message.data = histogram.toPropertyMap(); // reply with the last state before the reset
+                histogram.reset();
+                return message;
+            }
+            throw gr::exception(fmt::format("block {} property {} only supports {{ \"reset\", true }}, msg: {}", this->unique_name, propertyName, message));
+        } else if (message.cmd == Get) {
+            message.data = histogram.toPropertyMap();
+            return message;
+        } else if (message.cmd == Subscribe) {
+            if (!message.clientRequestID.empty()) {
+                this->propertySubscriptions[std::string(propertyName)].insert(message.clientRequestID);
+            }
+            return std::nullopt;
+        } else if (message.cmd == Unsubscribe) {
+            this->propertySubscriptions[std::string(propertyName)].erase(message.clientRequestID);
+            return std::nullopt;
+        }
+
+        throw gr::exception(fmt::format("block {} property {} does not implement command {}, msg: {}", this->unique_name, propertyName, message.cmd, message));
+    }
+};
+
+} // namespace gr::testing
+
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::testing::LatencyStamp, in, out, stamp_interval);
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::testing::LatencyMonitor, in, out, notify_interval);
+
+auto registerLatencyStamp   = gr::registerBlock<gr::testing::LatencyStamp, float, double>(gr::globalBlockRegistry());
+auto registerLatencyMonitor = gr::registerBlock<gr::testing::LatencyMonitor, float, double>(gr::globalBlockRegistry());
+
+#endif // GNURADIO_TESTING_LATENCYMONITORS_HPP
@@ -9,6 +9,8 @@
 #include <gnuradio-4.0/Graph.hpp>
 #include <gnuradio-4.0/Tag.hpp>
 
+#include <gnuradio-4.0/testing/LatencyMonitors.hpp>
+
 inline constexpr std::size_t N_MAX = std::numeric_limits<std::size_t>::max();
 
 namespace test {
@@ -127,6 +129,25 @@ cascade(
     }
 }
 
+/**
+ * adds a `benchmark::results` row with the statistics of a (e.g. `LatencyMonitor`-recorded) latency histogram.
+ * Use a name starting with "  └─" to attach the row to the preceding benchmark.
+ * @return the added row, e.g. to attach further metrics
+ */
+inline auto &
+add_latency_result(std::string_view name, const gr::testing::LatencyHistogram &histogram) {
+    constexpr auto toSeconds  = [](std::uint64_t ns) { return 1e-9L * static_cast<long double>(ns); };
+    auto          &result_map = benchmark::results::add_result(name);
+    result_map.try_emplace("#stamps", histogram.count(), "", 0);
+    result_map.try_emplace("min", toSeconds(histogram.min()), "s", 0);
+    result_map.try_emplace("median", toSeconds(histogram.percentile(0.5)), "s", 0);
+    result_map.try_emplace("p90", toSeconds(histogram.percentile(0.9)), "s", 0);
+    result_map.try_emplace("p99", toSeconds(histogram.percentile(0.99)), "s", 0);
+    result_map.try_emplace("p99.9", toSeconds(histogram.percentile(0.999)), "s", 0);
+    result_map.try_emplace("max", toSeconds(histogram.max()), "s", 0);
+    return result_map;
+}
+
 } // namespace test
 
 ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T, std::size_t min, std::size_t count, bool use_bulk_operation), (test::source<T, min, count, use_bulk_operation>), out);
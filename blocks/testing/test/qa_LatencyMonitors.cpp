@@ -0,0 +1,144 @@
+#include <boost/ut.hpp>
+
+#include <numeric>
+#include <ranges>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/testing/LatencyMonitors.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
+
+const boost::ut::suite LatencyHistogramTests = [] {
+    using namespace boost::ut;
+    using gr::testing::LatencyHistogram;
+
+    "bucket mapping"_test = [] {
+        for (std::uint64_t value : { 0UL, 1UL, 127UL, 128UL, 129UL, 1'000UL, 123'456UL, 1'000'000'007UL, std::numeric_limits<std::uint64_t>::max() }) {
+            const auto index = LatencyHistogram::bucketIndex(value);
+            expect(lt(index, LatencyHistogram::kNBuckets));
+            expect(ge(LatencyHistogram::bucketUpperBound(index), value)) << fmt::format("value {} exceeds upper bound of bucket {}", value, index);
+            expect(index == 0UZ || LatencyHistogram::bucketUpperBound(index - 1UZ) < value) << fmt::format("value {} should be in a lower bucket than {}", value, index);
+            const auto upper = static_cast<double>(LatencyHistogram::bucketUpperBound(index));
+            expect(le((upper - static_cast<double>(value)) / std::max(1.0, static_cast<double>(value)), 1.0 / LatencyHistogram::kSubBuckets)) << "relative resolution";
+        }
+        static_assert(LatencyHistogram::bucketIndex(std::numeric_limits<std::uint64_t>::max()) == LatencyHistogram::kNBuckets - 1UZ);
+    };
+
+    "statistics and percentiles"_test = [] {
+        LatencyHistogram histogram;
+        expect(eq(histogram.count(), 0UZ));
+        expect(eq(histogram.percentile(0.5), 0UZ));
+
+        for (std::uint64_t value = 1U; value <= 10'000U; value++) {
+            histogram.record(value * 1'000U); // 1 us ... 10 ms
+        }
+        expect(eq(histogram.count(), 10'000UZ));
+        expect(eq(histogram.min(), 1'000UZ));
+        expect(eq(histogram.max(), 10'000'000UZ));
+        expect(approx(histogram.mean(), 5'000'500.0, 1.0));
+        expect(approx(static_cast<double>(histogram.percentile(0.5)), 5e6, 5e6 / LatencyHistogram::kSubBuckets));
+        expect(approx(static_cast<double>(histogram.percentile(0.99)), 9.9e6, 9.9e6 / LatencyHistogram::kSubBuckets));
+        expect(eq(histogram.percentile(0.0), histogram.min()));
+        expect(eq(histogram.percentile(1.0), histogram.max()));
+
+        LatencyHistogram other;
+        other.record(42U, 10'000U);
+        histogram.merge(other);
+        expect(eq(histogram.count(), 20'000UZ));
+        expect(eq(histogram.min(), 42UZ));
+        expect(eq(histogram.percentile(0.25), 42UZ));
+
+        const gr::property_map map = histogram.toPropertyMap();
+        expect(eq(std::get<std::uint64_t>(map.at("count")), 20'000UZ));
+        expect(eq(std::get<std::uint64_t>(map.at("min_ns")), 42UZ));
+        const auto &counts = std::get<std::vector<std::uint64_t>>(map.at("bucket_counts"));
+        expect(eq(std::accumulate(counts.begin(), counts.end(), 0UZ), 20'000UZ));
+        expect(eq(counts.size(), std::get<std::vector<std::uint64_t>>(map.at("bucket_upper_ns")).size()));
+
+        histogram.reset();
+        expect(eq(histogram.count(), 0UZ));
+        expect(eq(histogram.max(), 0UZ));
+    };
+};
+
+const boost::ut::suite LatencyMonitorTests = [] {
+    using namespace boost::ut;
+    using namespace gr::testing;
+    using namespace std::chrono_literals;
+
+    static constexpr gr::Size_t nSamples      = 100'000U;
+    static constexpr gr::Size_t stampInterval = 1'000U;
+
+    auto runGraph = []<typename TScheduler>(std::string_view schedulerName) {
+        gr::Graph graph;
+        auto     &source  = graph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", nSamples }, { "mark_tag", false } });
+        auto     &stamp   = graph.emplaceBlock<LatencyStamp<float>>({ { "stamp_interval", stampInterval } });
+        auto     &delay   = graph.emplaceBlock<TagMonitor<float, ProcessFunction::USE_PROCESS_BULK>>({ { "log_samples", false }, { "log_tags", false } });
+        auto     &monitor = graph.emplaceBlock<LatencyMonitor<float>>();
+        auto     &sink    = graph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>({ { "log_tags", false } });
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(source).to<"in">(stamp)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(stamp).to<"in">(delay)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(delay).to<"in">(monitor)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(monitor).to<"in">(sink)));
+
+        TScheduler sched(std::move(graph));
+        expect(sched.runAndWait().has_value()) << schedulerName;
+
+        expect(eq(sink.n_samples_produced, nSamples)) << schedulerName;
+        expect(eq(sink.samples.size(), static_cast<std::size_t>(nSamples))) << schedulerName;
+        expect(std::ranges::equal(sink.samples, std::views::iota(0U, nSamples) | std::views::transform([](auto i) { return static_cast<float>(i); }))) << "pass-through must not alter samples: " << schedulerName;
+        expect(eq(stamp.n_stamps, static_cast<std::uint64_t>(nSamples / stampInterval))) << schedulerName;
+        expect(eq(monitor.histogram.count(), static_cast<std::uint64_t>(nSamples / stampInterval))) << schedulerName;
+        expect(gt(monitor.histogram.max(), 0UZ)) << schedulerName;
+        expect(lt(monitor.histogram.percentile(0.5), static_cast<std::uint64_t>(std::chrono::nanoseconds(10s).count()))) << schedulerName;
+    };
+
+    "LatencyStamp -> LatencyMonitor"_test = [&runGraph] {
+        using namespace gr::scheduler;
+        runGraph.template operator()<Simple<ExecutionPolicy::singleThreaded>>("Simple");
+        runGraph.template operator()<BreadthFirst<ExecutionPolicy::singleThreaded>>("BreadthFirst");
+        runGraph.template operator()<Simple<ExecutionPolicy::multiThreaded>>("Simple (multiThreaded)");
+        runGraph.template operator()<BreadthFirst<ExecutionPolicy::multiThreaded>>("BreadthFirst (multiThreaded)");
+    };
+
+    "Latency property"_test = [] {
+        using namespace gr::message;
+        gr::MsgPortOut        toBlock;
+        LatencyMonitor<float> monitor;
+        gr::MsgPortIn         fromBlock;
+        expect(eq(gr::ConnectionResult::SUCCESS, toBlock.connect(monitor.msgIn)));
+        expect(eq(gr::ConnectionResult::SUCCESS, monitor.msgOut.connect(fromBlock)));
+
+        monitor.start(); // registers the 'Latency' property
+        monitor.histogram.record(1'000U, 3U);
+
+        auto request = [&]<Command command>(gr::property_map data) -> gr::Message {
+            gr::sendMessage<command>(toBlock, monitor.unique_name, LatencyMonitor<float>::kLatency, std::move(data));
+            expect(nothrow([&] { monitor.processScheduledMessages(); }));
+            expect(eq(fromBlock.streamReader().available(), 1UZ)) << "didn't receive reply message";
+            gr::ConsumableSpan auto span = fromBlock.streamReader().get<gr::SpanReleasePolicy::ProcessAll>(1UZ);
+            gr::Message             msg  = span[0];
+            expect(span.consume(span.size()));
+            return msg;
+        };
+
+        const gr::Message get = request.template operator()<Command::Get>({});
+        expect(get.cmd == Command::Final);
+        expect(get.data.has_value()) << boost::ut::fatal;
+        expect(eq(std::get<std::uint64_t>(get.data.value().at("count")), 3UZ));
+        expect(eq(std::get<std::uint64_t>(get.data.value().at("p50_ns")), 1'000UZ));
+
+        const gr::Message reset = request.template operator()<Command::Set>({ { "reset", true } });
+        expect(reset.data.has_value()) << boost::ut::fatal;
+        expect(eq(std::get<std::uint64_t>(reset.data.value().at("count")), 3UZ)) << "reply contains the pre-reset state";
+        expect(eq(monitor.histogram.count(), 0UZ));
+
+        const gr::Message invalid = request.template operator()<Command::Set>({ { "unknown", 1 } });
+        expect(!invalid.data.has_value()) << "unsupported Set must be replied to with an error";
+    };
+};
+
+int
+main() { /* not needed for UT */
+}
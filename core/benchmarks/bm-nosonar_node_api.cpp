@@ -6,6 +6,7 @@
 #include <vir/simd.h>
 
 #include <gnuradio-4.0/BlockTraits.hpp>
+#include <gnuradio-4.0/Channelised.hpp>
 #include <gnuradio-4.0/Graph.hpp>
 #include <gnuradio-4.0/Scheduler.hpp>
 
@@ -614,6 +615,23 @@ inline const boost::ut::suite _runtime_tests = [] {
     templated_cascaded_test_10(static_cast<int>(2.0), "runtime   src->(mult(2.0)->div(2.0)->add(-1))^10->sink - int");
 };
 
+// source that publishes at most 'chunkSize' samples per work call, used to control the (mis-)alignment of the chunk starts downstream
+template<typename T, std::size_t chunkSize>
+struct chunked_source : public gr::Block<chunked_source<T, chunkSize>> {
+    gr::PortOut<T> out;
+
+    gr::work::Status
+    processBulk(gr::PublishableSpan auto &output) noexcept {
+        const std::size_t nSamples = std::min({ output.size(), chunkSize, N_SAMPLES - test::n_samples_produced });
+        std::fill_n(output.begin(), nSamples, static_cast<T>(1));
+        test::n_samples_produced += nSamples;
+        output.publish(nSamples);
+        return test::n_samples_produced < N_SAMPLES ? gr::work::Status::OK : gr::work::Status::DONE;
+    }
+};
+
+ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T, std::size_t chunkSize), (chunked_source<T, chunkSize>), out);
+
 inline const boost::ut::suite _simd_tests = [] {
     using namespace boost::ut;
     using namespace benchmark;
@@ -678,6 +696,46 @@ inline const boost::ut::suite _simd_tests = [] {
             expect(eq(test::n_samples_consumed, N_SAMPLES)) << "did not consume enough input samples";
         };
     }
+
+    // chunks of 1024 samples start vector-aligned, chunks of 1021 samples need a scalar prologue to reach aligned SIMD loads/stores
+    constexpr auto aligned_vs_misaligned_test = []<std::size_t chunkSize>(const char *test_name) {
+        gr::Graph testGraph;
+        auto     &src  = testGraph.emplaceBlock<chunked_source<float, chunkSize>>();
+        auto     &sink = testGraph.emplaceBlock<test::sink<float>>();
+
+        std::vector<multiply<float> *> mult1;
+        std::vector<divide<float> *>   div1;
+        std::vector<add<float, -1> *>  add1;
+        for (std::size_t i = 0; i < 10; i++) {
+            mult1.emplace_back(std::addressof(testGraph.emplaceBlock<multiply<float>>({ { "factor", 2.0f }, { "name", fmt::format("mult1.{}", i) } })));
+            div1.emplace_back(std::addressof(testGraph.emplaceBlock<divide<float>>({ { "factor", 2.0f }, { "name", fmt::format("div1.{}", i) } })));
+            add1.emplace_back(std::addressof(testGraph.emplaceBlock<add<float, -1>>()));
+        }
+
+        for (std::size_t i = 0; i < add1.size(); i++) {
+            if (i == 0) {
+                expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(src).template to<"in">(*mult1[i])));
+            } else {
+                expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(*add1[i - 1]).template to<"in">(*mult1[i])));
+            }
+            expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(*mult1[i]).template to<"in">(*div1[i])));
+            expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(*div1[i]).template to<"in">(*add1[i])));
+        }
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(*add1[add1.size() - 1]).template to<"in">(sink)));
+
+        gr::scheduler::Simple sched{ std::move(testGraph) };
+
+        ::benchmark::benchmark<1LU>{ test_name }.repeat<N_ITER>(N_SAMPLES) = [&sched]() {
+            test::n_samples_produced = 0LU;
+            test::n_samples_consumed = 0LU;
+            expect(sched.runAndWait().has_value());
+            expect(sched.changeStateTo(gr::lifecycle::INITIALISED).has_value());
+            expect(eq(test::n_samples_produced, N_SAMPLES)) << "did not produce enough output samples";
+            expect(eq(test::n_samples_consumed, N_SAMPLES)) << "did not consume enough input samples";
+        };
+    };
+    aligned_vs_misaligned_test.template operator()<1024UZ>("runtime   src(N=1024)->(mult(2.0)->div(2.0)->add(-1))^10->sink - aligned chunks");
+    aligned_vs_misaligned_test.template operator()<1021UZ>("runtime   src(N=1021)->(mult(2.0)->div(2.0)->add(-1))^10->sink - misaligned chunks");
 };
 
 inline const boost::ut::suite _sample_by_sample_vs_bulk_access_tests = [] {
@@ -736,6 +794,65 @@ inline const boost::ut::suite _sample_by_sample_vs_bulk_access_tests = [] {
     templated_cascaded_test_bulk(static_cast<int>(2.0), "runtime   src->mult(2.0)->div(2.0)->add(-1)->sink - int bulk");
 };
 
+inline const boost::ut::suite _channelised_tests = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+    constexpr std::size_t kChannels = 16UZ;
+
+    { // one chain per channel, scheduled and executed separately
+        gr::Graph testGraph;
+        auto     &src  = testGraph.emplaceBlock<test::source<float>>(N_SAMPLES);
+        auto     &mult = testGraph.emplaceBlock<multiply<float>>({ { "factor", 2.f } });
+        auto     &div  = testGraph.emplaceBlock<divide<float>>({ { "factor", 2.f } });
+        auto     &add1 = testGraph.emplaceBlock<add<float, -1>>();
+        auto     &sink = testGraph.emplaceBlock<test::sink<float>>();
+
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(mult)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(mult).to<"in">(div)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(div).to<"in">(add1)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(add1).to<"in">(sink)));
+
+        gr::scheduler::Simple sched{ std::move(testGraph) };
+
+        "runtime   16 x src->mult(2.0)->div(2.0)->add(-1)->sink - separate channels"_benchmark.repeat<N_ITER>(kChannels * N_SAMPLES) = [&sched]() {
+            for (std::size_t channel = 0UZ; channel < kChannels; ++channel) {
+                test::n_samples_produced = 0LU;
+                test::n_samples_consumed = 0LU;
+                expect(sched.runAndWait().has_value());
+                expect(sched.changeStateTo(gr::lifecycle::INITIALISED).has_value());
+                expect(eq(test::n_samples_consumed, N_SAMPLES)) << "did not consume enough input samples";
+            }
+        };
+    }
+
+    { // all channels in the SIMD lanes of one chain
+        using TChannels = std::array<float, kChannels>;
+        gr::Graph testGraph;
+        auto     &src  = testGraph.emplaceBlock<test::source<TChannels>>(N_SAMPLES);
+        auto     &mult = testGraph.emplaceBlock<gr::Channelised<multiply<float>, kChannels>>();
+        auto     &div  = testGraph.emplaceBlock<gr::Channelised<divide<float>, kChannels>>();
+        auto     &add1 = testGraph.emplaceBlock<gr::Channelised<add<float, -1>, kChannels>>();
+        auto     &sink = testGraph.emplaceBlock<test::sink<TChannels>>();
+        mult.channelBlock().factor = 2.f;
+        div.channelBlock().factor  = 2.f;
+
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(mult)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(mult).to<"in">(div)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(div).to<"in">(add1)));
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(add1).to<"in">(sink)));
+
+        gr::scheduler::Simple sched{ std::move(testGraph) };
+
+        "runtime   src->mult(2.0)->div(2.0)->add(-1)->sink - 16 channelised"_benchmark.repeat<N_ITER>(kChannels * N_SAMPLES) = [&sched]() {
+            test::n_samples_produced = 0LU;
+            test::n_samples_consumed = 0LU;
+            expect(sched.runAndWait().has_value());
+            expect(sched.changeStateTo(gr::lifecycle::INITIALISED).has_value());
+            expect(eq(test::n_samples_consumed, N_SAMPLES)) << "did not consume enough input samples";
+        };
+    }
+};
+
 int
 main() { /* not needed by the UT framework */
 }
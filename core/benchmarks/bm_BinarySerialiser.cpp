@@ -0,0 +1,194 @@
+#include <benchmark.hpp>
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#pragma GCC diagnostic ignored "-Wshadow"
+#endif
+#include <yaml-cpp/yaml.h>
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+#include <gnuradio-4.0/BinarySerialiser.hpp>
+#include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+namespace {
+using namespace std::string_literals;
+
+gr::property_map
+makeTypicalPropertyMap() {
+    return { { "sample_rate", 1e6f },
+             { "signal_name", "IQ stream"s },
+             { "signal_unit", "V"s },
+             { "signal_min", -1.f },
+             { "signal_max", 1.f },
+             { "trigger_name", "CMD_BP_START"s },
+             { "trigger_time", std::uint64_t{ 1'700'000'000'000'000'000 } },
+             { "trigger_offset", 0.f },
+             { "context", "FAIR.SELECTOR.C=1:S=2:P=3"s },
+             { "coefficients", std::vector<double>{ 0.1, 0.2, 0.4, 0.2, 0.1 } } };
+}
+
+/**
+ * reference YAML path -- mirrors the `save_grc`/`load_grc` parameter serialisation
+ */
+std::string
+toYaml(const gr::property_map &map) {
+    YAML::Emitter out;
+    out << YAML::BeginMap;
+    for (const auto &[key, value] : map) {
+        out << YAML::Key << key << YAML::Value;
+        std::visit(
+                [&out]<typename T>(const T &arg) {
+                    if constexpr (std::is_same_v<T, std::string> || std::is_arithmetic_v<T>) {
+                        out << arg;
+                    } else if constexpr (gr::meta::vector_type<T> && std::is_arithmetic_v<typename T::value_type>) {
+                        out << YAML::Flow << YAML::BeginSeq;
+                        for (const auto &element : arg) {
+                            out << element;
+                        }
+                        out << YAML::EndSeq;
+                    } else {
+                        out << YAML::Null;
+                    }
+                },
+                value);
+    }
+    out << YAML::EndMap;
+    return out.c_str();
+}
+
+gr::property_map
+fromYaml(const std::string &yaml, const gr::property_map &prototype) {
+    gr::property_map result;
+    const YAML::Node tree = YAML::Load(yaml);
+    for (const auto &kv : tree) {
+        const auto key = kv.first.as<std::string>();
+        std::visit(
+                [&]<typename T>(const T &) {
+                    if constexpr (std::is_same_v<T, std::string> || std::is_arithmetic_v<T> || (gr::meta::vector_type<T> && std::is_arithmetic_v<typename T::value_type> && !std::is_same_v<typename T::value_type, bool>)) {
+                        result[key] = kv.second.template as<T>();
+                    }
+                },
+                prototype.at(key));
+    }
+    return result;
+}
+} // namespace
+
+inline const boost::ut::suite _binary_serialiser_tests = [] {
+    constexpr std::size_t n_repetitions = 10;
+    constexpr std::size_t n_messages    = 10'000;
+    using namespace benchmark;
+    using namespace gr::serialiser;
+
+    const gr::property_map map = makeTypicalPropertyMap();
+
+    "property_map - binary encode (interned keys)"_benchmark.repeat<n_repetitions>(n_messages) = [&map] {
+        BinaryWriter writer(KeyEncoding::Interned);
+        for (std::size_t i = 0; i < n_messages; i++) {
+            writer.clear();
+            encode(writer, map);
+            fake_read(writer.size());
+        }
+    };
+
+    "property_map - binary encode (inline keys)"_benchmark.repeat<n_repetitions>(n_messages) = [&map] {
+        BinaryWriter writer(KeyEncoding::Inline);
+        for (std::size_t i = 0; i < n_messages; i++) {
+            writer.clear();
+            encode(writer, map);
+            fake_read(writer.size());
+        }
+    };
+
+    const std::vector<std::uint8_t> encodedMap = serialise(map);
+    "property_map - binary decode"_benchmark.repeat<n_repetitions>(n_messages) = [&encodedMap, &map] {
+        for (std::size_t i = 0; i < n_messages; i++) {
+            const auto decoded = deserialise<gr::property_map>(encodedMap);
+            if (decoded.size() != map.size()) {
+                throw std::runtime_error(fmt::format("decoded size mismatch {} vs {}", decoded.size(), map.size()));
+            }
+        }
+    };
+
+    "property_map - YAML encode"_benchmark.repeat<n_repetitions>(n_messages) = [&map] {
+        for (std::size_t i = 0; i < n_messages; i++) {
+            const auto yaml = toYaml(map);
+            fake_read(yaml.size());
+        }
+    };
+
+    const std::string yamlMap = toYaml(map);
+    "property_map - YAML decode"_benchmark.repeat<n_repetitions>(n_messages) = [&yamlMap, &map] {
+        for (std::size_t i = 0; i < n_messages; i++) {
+            const auto decoded = fromYaml(yamlMap, map);
+            if (decoded.size() != map.size()) {
+                throw std::runtime_error(fmt::format("decoded size mismatch {} vs {}", decoded.size(), map.size()));
+            }
+        }
+    };
+    fmt::print("encoded property_map size: binary (interned) {} bytes, binary (inline) {} bytes, YAML {} bytes\n", encodedMap.size(), serialise(map, KeyEncoding::Inline).size(), yamlMap.size());
+
+    ::benchmark::results::add_separator();
+
+    const gr::Tag tag(1024, map);
+    "Tag - binary round-trip"_benchmark.repeat<n_repetitions>(n_messages) = [&tag] {
+        BinaryWriter writer;
+        for (std::size_t i = 0; i < n_messages; i++) {
+            writer.clear();
+            encode(writer, tag);
+            BinaryReader reader(writer.data());
+            const auto   decoded = decodeTag(reader);
+            if (decoded.index != tag.index) {
+                throw std::runtime_error(fmt::format("decoded index mismatch {} vs {}", decoded.index, tag.index));
+            }
+        }
+    };
+
+    ::benchmark::results::add_separator();
+
+    constexpr std::size_t n_samples = 65'536;
+    gr::DataSet<float>    dataSet;
+    dataSet.signal_names  = { "signal" };
+    dataSet.signal_units  = { "V" };
+    dataSet.extents       = { static_cast<std::int32_t>(n_samples) };
+    dataSet.signal_values = std::vector<float>(n_samples, 1.f);
+    dataSet.timing_events = { { tag } };
+
+    "DataSet<float>(64k) - binary encode"_benchmark.repeat<n_repetitions>(n_samples) = [&dataSet] {
+        BinaryWriter writer(KeyEncoding::Interned, n_samples * sizeof(float) + 1024UZ);
+        encode(writer, dataSet);
+        fake_read(writer.size());
+    };
+
+    const std::vector<std::uint8_t> encodedDataSet = serialise(dataSet);
+    "DataSet<float>(64k) - binary decode"_benchmark.repeat<n_repetitions>(n_samples) = [&encodedDataSet] {
+        const auto decoded = deserialise<gr::DataSet<float>>(encodedDataSet);
+        if (decoded.signal_values.size() != n_samples) {
+            throw std::runtime_error(fmt::format("decoded size mismatch {} vs {}", decoded.signal_values.size(), n_samples));
+        }
+    };
+
+    BinaryWriter viewWriter;
+    encode(viewWriter, pmtv::pmt(dataSet.signal_values));
+    const std::vector<std::uint8_t> encodedVector = viewWriter.release();
+    "std::vector<float>(64k) - zero-copy view"_benchmark.repeat<n_repetitions>(n_samples) = [&encodedVector] {
+        BinaryReader reader(encodedVector);
+        const auto   view = decodePmtView<float>(reader);
+        if (view.size() != n_samples) {
+            throw std::runtime_error(fmt::format("decoded size mismatch {} vs {}", view.size(), n_samples));
+        }
+    };
+};
+
+int
+main() { /* not needed by the UT framework */
+}
@@ -0,0 +1,340 @@
+#include <benchmark.hpp>
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Message.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/testing/bm_test_helper.hpp>
+#include <gnuradio-4.0/testing/LatencyMonitors.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
+
+/**
+ * Graph-level throughput and end-to-end latency benchmarks for typical flow-graph topologies.
+ *
+ * Each topology is swept over the graph size (number of stages/branches) and the number of scheduler threads.
+ * Throughput is reported via 'ops/s' (samples/s incl. graph construction) and 'samples/s' (scheduler run-time only),
+ * the end-to-end latency is measured by a `LatencyStamp` behind the source and a `LatencyMonitor` in front of the sink.
+ *
+ * Set 'BM_OUTPUT_FILE=<file>.json' (or '.csv') to export the results for tracking scheduler regressions across releases.
+ */
+
+inline constexpr std::size_t N_ITER             = 5;
+inline constexpr std::size_t N_SAMPLES          = gr::util::round_up(1'000'000, 1024);
+inline constexpr gr::Size_t  kStampInterval     = 4096U; // samples between two latency stamps
+inline constexpr gr::Size_t  kTagHeavyInterval  = 64U;   // samples between two (latency stamp) tags for the tag-heavy topology
+inline constexpr gr::Size_t  kResamplingFactor  = 4U;
+inline constexpr gr::Size_t  kFeedbackPriming   = 1024U; // samples initially circulating in each feedback loop
+inline constexpr auto        kMessageInterval   = std::chrono::microseconds(20);
+inline constexpr std::array  kGraphSizes        = { 2UZ, 8UZ };
+inline constexpr std::array  kThreadCounts      = { 1UZ, 2UZ, 4UZ };
+
+namespace bm {
+
+template<typename T>
+struct Sink : public gr::Block<Sink<T>> {
+    gr::PortIn<T> in;
+
+    benchmark::time_point *firstSample = nullptr;
+    std::size_t            nSamples    = 0UZ;
+
+    gr::work::Status
+    processBulk(std::span<const T> input) noexcept {
+        if (nSamples == 0UZ && !input.empty() && firstSample != nullptr) {
+            firstSample->now();
+        }
+        nSamples += input.size();
+        benchmark::force_to_memory(input);
+        return gr::work::Status::OK;
+    }
+};
+
+template<typename T>
+struct Scale : public gr::Block<Scale<T>> {
+    gr::PortIn<T>  in;
+    gr::PortOut<T> out;
+    T              factor = T(1);
+
+    template<gr::meta::t_or_simd<T> V>
+    [[nodiscard]] constexpr V
+    processOne(const V &a) const noexcept {
+        return a * factor;
+    }
+};
+
+template<typename T>
+struct FanIn : public gr::Block<FanIn<T>> {
+    std::vector<gr::PortIn<T>> inputs;
+    gr::PortOut<T>             out;
+    gr::Size_t                 n_inputs = 0U;
+
+    void
+    settingsChanged(const gr::property_map & /*oldSettings*/, const gr::property_map &newSettings) {
+        if (newSettings.contains("n_inputs")) {
+            inputs.resize(n_inputs);
+        }
+    }
+
+    template<gr::ConsumableSpan TInput>
+    gr::work::Status
+    processBulk(const std::span<TInput> &inSpans, gr::PublishableSpan auto &outSpan) {
+        const std::size_t available = std::min(outSpan.size(), std::ranges::min_element(inSpans, {}, [](const auto &span) { return span.size(); })->size());
+        for (std::size_t i = 0; i < available; i++) {
+            T sum{};
+            for (const auto &inSpan : inSpans) {
+                sum += inSpan[i];
+            }
+            outSpan[i] = sum;
+        }
+        outSpan.publish(available);
+        for (auto &inSpan : inSpans) {
+            std::ignore = inSpan.consume(available);
+        }
+        return gr::work::Status::OK;
+    }
+};
+
+template<typename T, gr::Size_t kInterpolation, gr::Size_t kDecimation>
+struct Resampler : public gr::Block<Resampler<T, kInterpolation, kDecimation>, gr::ResamplingRatio<kInterpolation, kDecimation, true>> {
+    gr::PortIn<T>  in;
+    gr::PortOut<T> out;
+
+    gr::work::Status
+    processBulk(std::span<const T> input, std::span<T> output) noexcept {
+        if constexpr (kInterpolation >= kDecimation) { // interpolate: repeat samples
+            for (std::size_t i = 0; i < output.size(); i++) {
+                output[i] = input[i * kDecimation / kInterpolation];
+            }
+        } else { // decimate: block average
+            for (std::size_t i = 0; i < output.size(); i++) {
+                const auto chunk = input.subspan(i * kDecimation, kDecimation);
+                output[i]        = std::accumulate(chunk.begin(), chunk.end(), T{}) / static_cast<T>(kDecimation);
+            }
+        }
+        return gr::work::Status::OK;
+    }
+};
+
+/**
+ * closes a feedback loop: initially publishes 'n_priming' zeros (in 'start()', since 'processBulk()' is only invoked once
+ * input is available) and then copies its input to its output. Tags are not forwarded to avoid re-circulating probes.
+ */
+template<typename T>
+struct FeedbackDelay : public gr::Block<FeedbackDelay<T>> {
+    constexpr static gr::TagPropagationPolicy tag_policy = gr::TagPropagationPolicy::TPP_DONT;
+    gr::PortIn<T>                             in;
+    gr::PortOut<T>                            out;
+    gr::Size_t                                n_priming = kFeedbackPriming;
+
+    void
+    start() {
+        out.streamWriter().publish([](std::span<T> output) { std::ranges::fill(output, T{}); }, n_priming);
+    }
+
+    gr::work::Status
+    processBulk(std::span<const T> input, std::span<T> output) noexcept {
+        std::ranges::copy(input, output.begin());
+        return gr::work::Status::OK;
+    }
+};
+
+} // namespace bm
+
+ENABLE_REFLECTION_FOR_TEMPLATE(bm::Sink, in);
+ENABLE_REFLECTION_FOR_TEMPLATE(bm::Scale, in, out, factor);
+ENABLE_REFLECTION_FOR_TEMPLATE(bm::FanIn, inputs, out, n_inputs);
+ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T, gr::Size_t kInterpolation, gr::Size_t kDecimation), (bm::Resampler<T, kInterpolation, kDecimation>), in, out);
+ENABLE_REFLECTION_FOR_TEMPLATE(bm::FeedbackDelay, in, out, n_priming);
+
+namespace bm {
+
+enum class Topology { FanOutFanIn, Diamond, Feedback, Resampling, TagHeavy, MessageHeavy };
+
+template<typename T>
+struct TopologyGraph {
+    gr::Graph                       graph;
+    std::vector<std::string>        scaleBlocks;       // targets for the message-heavy topology
+    gr::testing::LatencyMonitor<T> *monitor = nullptr; // N.B. owned by 'graph'
+    Sink<T>                        *sink    = nullptr;
+};
+
+template<typename T>
+[[nodiscard]] TopologyGraph<T>
+createGraph(Topology topology, std::size_t size) {
+    using namespace boost::ut;
+    using namespace gr::testing;
+    TopologyGraph<T> result;
+    gr::Graph       &graph = result.graph;
+
+    const gr::Size_t stampInterval = topology == Topology::TagHeavy ? kTagHeavyInterval : kStampInterval;
+    auto            &generator     = graph.emplaceBlock<TagSource<T, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", static_cast<gr::Size_t>(N_SAMPLES) }, { "values", std::vector<T>{ T(1) } } });
+    auto            &src           = graph.emplaceBlock<LatencyStamp<T>>({ { "stamp_interval", stampInterval } });
+    auto            &monitor       = graph.emplaceBlock<LatencyMonitor<T>>({ { "notify_interval", gr::Size_t(0) } });
+    auto            &sink          = graph.emplaceBlock<Sink<T>>();
+    result.monitor                 = std::addressof(monitor);
+    result.sink                    = std::addressof(sink);
+
+    auto connect = [&graph]<typename Source, typename Destination>(Source &source, Destination &destination) { //
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(source).template to<"in">(destination)));
+    };
+    auto connectToFanIn = [&graph](auto &source, FanIn<T> &fanIn, std::size_t index) { //
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(source, { "out", gr::meta::invalid_index }, fanIn, { "inputs", index })));
+    };
+    auto addScale = [&graph, &result](T factor = T(1)) -> Scale<T> & {
+        auto &block = graph.emplaceBlock<Scale<T>>({ { "factor", factor } });
+        result.scaleBlocks.emplace_back(block.unique_name);
+        return block;
+    };
+    connect(generator, src); // N.B. all topologies start at the stamped output 'src' and end at the 'monitor'
+    connect(monitor, sink);
+
+    switch (topology) {
+    case Topology::FanOutFanIn: { // src -> 'size' parallel branches -> fan-in -> sink
+        auto &fanIn = graph.emplaceBlock<FanIn<T>>({ { "n_inputs", static_cast<gr::Size_t>(size) } });
+        for (std::size_t i = 0; i < size; i++) {
+            auto &branch = addScale(T(1) / static_cast<T>(size));
+            connect(src, branch);
+            connectToFanIn(branch, fanIn, i);
+        }
+        connect(fanIn, monitor);
+    } break;
+    case Topology::Diamond: { // 'size' cascaded diamonds: x -> {a, b} -> fan-in
+        std::function<void(Scale<T> &)> connectTail = [&](Scale<T> &block) { connect(src, block); };
+        for (std::size_t i = 0; i < size; i++) {
+            auto &head  = addScale();
+            auto &left  = addScale(T(0.5));
+            auto &right = addScale(T(0.5));
+            auto &fanIn = graph.emplaceBlock<FanIn<T>>({ { "n_inputs", gr::Size_t(2) } });
+            connectTail(head);
+            connect(head, left);
+            connect(head, right);
+            connectToFanIn(left, fanIn, 0UZ);
+            connectToFanIn(right, fanIn, 1UZ);
+            connectTail = [&connect, previous = std::addressof(fanIn)](Scale<T> &block) { connect(*previous, block); };
+        }
+        auto &tail = addScale();
+        connectTail(tail);
+        connect(tail, monitor);
+    } break;
+    case Topology::Feedback: { // 'size' cascaded IIR-type loops: y[n] = 0.5 * (x[n] + y[n - kFeedbackPriming])
+        std::function<void(FanIn<T> &)> connectTail = [&](FanIn<T> &block) { connectToFanIn(src, block, 0UZ); };
+        Scale<T>                       *last        = nullptr;
+        for (std::size_t i = 0; i < size; i++) {
+            auto &adder = graph.emplaceBlock<FanIn<T>>({ { "n_inputs", gr::Size_t(2) } });
+            auto &gain  = addScale(T(0.5));
+            auto &delay = graph.emplaceBlock<FeedbackDelay<T>>();
+            connectTail(adder);
+            connect(adder, gain);
+            connect(gain, delay);
+            connectToFanIn(delay, adder, 1UZ);
+            connectTail = [&connectToFanIn, previous = std::addressof(gain)](FanIn<T> &block) { connectToFanIn(*previous, block, 0UZ); };
+            last        = std::addressof(gain);
+        }
+        connect(*last, monitor);
+    } break;
+    case Topology::Resampling: { // 'size' cascaded decimate-by-N -> interpolate-by-N pairs
+        auto *tail = std::addressof(addScale());
+        connect(src, *tail);
+        for (std::size_t i = 0; i < size; i++) {
+            auto &decimate    = graph.emplaceBlock<Resampler<T, 1U, kResamplingFactor>>();
+            auto &interpolate = graph.emplaceBlock<Resampler<T, kResamplingFactor, 1U>>();
+            auto &next        = addScale();
+            connect(*tail, decimate);
+            connect(decimate, interpolate);
+            connect(interpolate, next);
+            tail = std::addressof(next);
+        }
+        connect(*tail, monitor);
+    } break;
+    case Topology::TagHeavy:
+    case Topology::MessageHeavy: { // linear cascade, tag/message load is generated by the source/benchmark driver
+        auto *tail = std::addressof(addScale());
+        connect(src, *tail);
+        for (std::size_t i = 1; i < size; i++) {
+            auto &next = addScale();
+            connect(*tail, next);
+            tail = std::addressof(next);
+        }
+        connect(*tail, monitor);
+    } break;
+    }
+    return result;
+}
+
+template<typename T, typename TScheduler>
+void
+runTopology(std::string_view topologyName, Topology topology, std::size_t size, std::size_t nThreads) {
+    using namespace boost::ut;
+    using namespace benchmark;
+
+    auto pool = std::make_shared<gr::thread_pool::BasicThreadPool>("bm-graph-pool", gr::thread_pool::CPU_BOUND, nThreads, nThreads);
+
+    gr::testing::LatencyHistogram histogram; // accumulated over all iterations
+    std::vector<long double>      runTimes;
+    const std::string             name = fmt::format("{:<14} size:{:<2} threads:{}", topologyName, size, nThreads);
+    ::benchmark::benchmark<N_ITER>(name, N_SAMPLES) = [&](MarkerMap<"start", "first sample", "finish"> &marker) {
+        auto [graph, scaleBlocks, monitor, sink] = createGraph<T>(topology, size);
+        sink->firstSample                        = std::addressof(marker.at<"first sample">());
+        TScheduler     sched(std::move(graph), pool);
+        gr::MsgPortOut toScheduler;
+        expect(eq(gr::ConnectionResult::SUCCESS, toScheduler.connect(sched.msgIn)));
+
+        std::jthread messageDriver;
+        if (topology == Topology::MessageHeavy) {
+            messageDriver = std::jthread([&toScheduler, &scaleBlocks](std::stop_token stopToken) {
+                for (std::size_t i = 0UZ; !stopToken.stop_requested(); i++) {
+                    gr::sendMessage<gr::message::Command::Set>(toScheduler, scaleBlocks[i % scaleBlocks.size()], gr::block::property::kStagedSetting, { { "factor", T(1) } });
+                    std::this_thread::sleep_for(kMessageInterval);
+                }
+            });
+        }
+
+        marker.at<"start">().now();
+        expect(sched.runAndWait().has_value()) << fmt::format("scheduler failed for {}", name);
+        marker.at<"finish">().now();
+        messageDriver = {};
+
+        runTimes.push_back(1e-9l * static_cast<long double>((marker.at<"finish">() - marker.at<"start">()).count()));
+        expect(eq(sink->nSamples, N_SAMPLES)) << fmt::format("did not consume the expected number of samples for {}", name);
+        histogram.merge(monitor->histogram);
+    };
+
+    auto             &result_map = test::add_latency_result("  └─end-to-end latency", histogram);
+    const long double runTime    = std::accumulate(runTimes.begin(), runTimes.end(), 0.0l);
+    result_map.try_emplace("samples/s", static_cast<long double>(N_SAMPLES * runTimes.size()) / runTime, "", 1);
+}
+
+} // namespace bm
+
+[[maybe_unused]] inline const boost::ut::suite graph_topology_benchmarks = [] {
+    using bm::Topology;
+    using gr::scheduler::ExecutionPolicy::multiThreaded;
+    using gr::scheduler::ExecutionPolicy::singleThreaded;
+
+    constexpr std::array topologies{ std::pair{ "fan-out/fan-in", Topology::FanOutFanIn }, //
+                                     std::pair{ "diamond", Topology::Diamond },             //
+                                     std::pair{ "feedback", Topology::Feedback },           //
+                                     std::pair{ "resampling", Topology::Resampling },       //
+                                     std::pair{ "tag-heavy", Topology::TagHeavy },          //
+                                     std::pair{ "message-heavy", Topology::MessageHeavy } };
+
+    for (const auto &[topologyName, topology] : topologies) {
+        for (const std::size_t size : kGraphSizes) {
+            for (const std::size_t nThreads : kThreadCounts) {
+                if (nThreads == 1UZ) {
+                    bm::runTopology<float, gr::scheduler::BreadthFirst<singleThreaded>>(topologyName, topology, size, nThreads);
+                } else {
+                    bm::runTopology<float, gr::scheduler::BreadthFirst<multiThreaded>>(topologyName, topology, size, nThreads);
+                }
+            }
+        }
+        benchmark::results::add_separator();
+    }
+};
+
+int
+main() { /* not needed by the UT framework */
+}
@@ -0,0 +1,88 @@
+#include <benchmark.hpp>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/testing/bm_test_helper.hpp>
+#include <gnuradio-4.0/testing/LatencyMonitors.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
+
+/**
+ * End-to-end sample latency of a linear source -> LatencyStamp -> N x copy -> LatencyMonitor -> sink chain
+ * for the available scheduler/execution policies. The latency of every 'kStampInterval'-th sample is recorded
+ * into an HDR-style histogram and reported as an additional result row below the throughput figures.
+ */
+
+inline constexpr std::size_t N_ITER         = 10;
+inline constexpr gr::Size_t  N_SAMPLES      = gr::util::round_up(1'000'000, 1024);
+inline constexpr gr::Size_t  kStampInterval = 1024U;
+inline constexpr std::array  kChainLengths  = { 1UZ, 10UZ };
+
+namespace bm {
+
+template<typename T>
+struct Copy : public gr::Block<Copy<T>> {
+    gr::PortIn<T>  in;
+    gr::PortOut<T> out;
+
+    template<gr::meta::t_or_simd<T> V>
+    [[nodiscard]] constexpr V
+    processOne(const V &a) const noexcept {
+        return a;
+    }
+};
+
+} // namespace bm
+
+ENABLE_REFLECTION_FOR_TEMPLATE(bm::Copy, in, out);
+
+template<typename T, typename TScheduler>
+void
+runLatencyChain(std::string_view name, std::size_t nStages) {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using namespace gr::testing;
+
+    LatencyHistogram histogram;
+    ::benchmark::benchmark<N_ITER>(name, N_SAMPLES) = [&histogram, nStages, name] {
+        gr::Graph graph;
+        auto     &source = graph.emplaceBlock<TagSource<T, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", N_SAMPLES }, { "mark_tag", false } });
+        auto     &stamp  = graph.emplaceBlock<LatencyStamp<T>>({ { "stamp_interval", kStampInterval } });
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(source).template to<"in">(stamp)));
+
+        auto *last = &graph.emplaceBlock<bm::Copy<T>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(stamp).template to<"in">(*last)));
+        for (std::size_t i = 1UZ; i < nStages; i++) {
+            auto *next = &graph.emplaceBlock<bm::Copy<T>>();
+            expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(*last).template to<"in">(*next)));
+            last = next;
+        }
+
+        auto &monitor = graph.emplaceBlock<LatencyMonitor<T>>({ { "notify_interval", gr::Size_t(0) } });
+        auto &sink    = graph.emplaceBlock<TagSink<T, ProcessFunction::USE_PROCESS_BULK>>({ { "log_samples", false }, { "log_tags", false } });
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(*last).template to<"in">(monitor)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(monitor).template to<"in">(sink)));
+
+        TScheduler sched(std::move(graph));
+        expect(sched.runAndWait().has_value()) << name;
+        expect(eq(sink.n_samples_produced, N_SAMPLES)) << fmt::format("did not consume the expected number of samples for {}", name);
+        histogram.merge(monitor.histogram);
+    };
+    test::add_latency_result("  └─end-to-end latency", histogram);
+}
+
+[[maybe_unused]] inline const boost::ut::suite latency_benchmarks = [] {
+    using namespace gr::scheduler;
+
+    for (const std::size_t nStages : kChainLengths) {
+        runLatencyChain<float, Simple<ExecutionPolicy::singleThreaded>>(fmt::format("{:2} stages - simple scheduler", nStages), nStages);
+        runLatencyChain<float, BreadthFirst<ExecutionPolicy::singleThreaded>>(fmt::format("{:2} stages - BFS scheduler", nStages), nStages);
+        runLatencyChain<float, Simple<ExecutionPolicy::multiThreaded>>(fmt::format("{:2} stages - simple scheduler (multi-threaded)", nStages), nStages);
+        runLatencyChain<float, BreadthFirst<ExecutionPolicy::multiThreaded>>(fmt::format("{:2} stages - BFS scheduler (multi-threaded)", nStages), nStages);
+        benchmark::results::add_separator();
+    }
+};
+
+int
+main() { /* not needed by the UT framework */
+}
@@ -1,5 +1,7 @@
 #include <benchmark.hpp>
 
+#include <numeric>
+
 #include <gnuradio-4.0/Profiler.hpp>
 
 using namespace gr::profiling;
@@ -53,6 +55,9 @@ run_with_profiler(TProfiler &p) {
     Profiler prof;
     "default profiler"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&p = prof] { run_with_profiler(p); };
 
+    Profiler json_prof(Options{ .output_file = {}, .output_mode = OutputMode::File, .events_per_thread = 1UZ << 16U });
+    "JSON profiler"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&p = json_prof] { run_with_profiler(p); };
+
     null::Profiler null_prof;
     "null profiler"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&p = null_prof] { run_with_profiler(p); };
 
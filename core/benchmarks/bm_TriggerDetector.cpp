@@ -0,0 +1,82 @@
+#include <benchmark.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/basic/TriggerDetector.hpp>
+#include <gnuradio-4.0/testing/bm_test_helper.hpp>
+
+inline constexpr std::size_t N_ITER    = 10;
+inline constexpr std::size_t N_SAMPLES = gr::util::round_up(10'000'000, 1024);
+
+void
+exec_bm(auto &scheduler, const std::string &test_case) {
+    using namespace boost::ut;
+    test::n_samples_produced = 0LU;
+    test::n_samples_consumed = 0LU;
+    expect(scheduler.runAndWait().has_value());
+    expect(eq(test::n_samples_produced, N_SAMPLES)) << fmt::format("did not produce enough output samples for {}", test_case);
+    expect(ge(test::n_samples_consumed, N_SAMPLES)) << fmt::format("did not consume enough input samples for {}", test_case);
+}
+
+[[maybe_unused]] inline const boost::ut::suite _trigger_detector_bm = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using namespace gr::basic;
+
+    std::mt19937                          rng(42);
+    std::uniform_real_distribution<float> noise(-0.4f, 0.4f);
+    std::vector<float>                    data(N_SAMPLES);
+    std::ranges::generate(data, [&] { return noise(rng); });
+    data.back() = 1.f; // single trigger at the very end -> measures the raw scan rate
+    const std::span<const float> samples(data);
+
+    "threshold scan - scalar std::ranges::find_if"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&samples] {
+        const auto it = std::ranges::find_if(samples, [](float x) { return x >= 0.5f; });
+        expect(eq(static_cast<std::size_t>(std::distance(samples.begin(), it)), N_SAMPLES - 1UZ));
+    };
+
+    "threshold scan - SIMD trigger_detector::findFirst"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&samples] {
+        const auto index = trigger_detector::findFirst(samples, [](const auto &x) { return x >= 0.5f; });
+        expect(eq(index, N_SAMPLES - 1UZ));
+    };
+
+    "window scan - SIMD trigger_detector::findFirst"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&samples] {
+        const auto index = trigger_detector::findFirst(samples, [](const auto &x) { return x < -0.5f || x > 0.5f; });
+        expect(eq(index, N_SAMPLES - 1UZ));
+    };
+
+    ::benchmark::results::add_separator();
+
+    auto createGraph = [](std::optional<std::string> mode) {
+        gr::Graph graph;
+        auto     &src  = graph.emplaceBlock<test::source<float>>(N_SAMPLES);
+        auto     &sink = graph.emplaceBlock<test::sink<float>>();
+        if (mode) {
+            auto &detector = graph.emplaceBlock<TriggerDetector<float>>({ { "mode", *mode }, { "threshold", 0.5f } });
+            expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(detector)));
+            expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(detector).to<"in">(sink)));
+        } else {
+            expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(sink)));
+        }
+        return graph;
+    };
+
+    gr::scheduler::Simple sched1(createGraph(std::nullopt));
+    "runtime   src->sink"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched1]() { exec_bm(sched1, "src->sink"); };
+
+    gr::scheduler::Simple sched2(createGraph("RisingEdge"));
+    "runtime   src->TriggerDetector(RisingEdge)->sink"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched2]() { exec_bm(sched2, "src->TriggerDetector(RisingEdge)->sink"); };
+
+    gr::scheduler::Simple sched3(createGraph("Window"));
+    "runtime   src->TriggerDetector(Window)->sink"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched3]() { exec_bm(sched3, "src->TriggerDetector(Window)->sink"); };
+};
+
+int
+main() { /* not needed by the UT framework */
+}
@@ -0,0 +1,674 @@
+#ifndef GNURADIO_BINARY_SERIALISER_HPP
+#define GNURADIO_BINARY_SERIALISER_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <pmtv/pmt.hpp>
+
+#include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/Message.hpp>
+#include <gnuradio-4.0/meta/typelist.hpp>
+#include <gnuradio-4.0/meta/utils.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+namespace gr::serialiser {
+
+/**
+ * @brief Compact binary codec for `pmtv::pmt`, `property_map`, `Tag`, `Message` and `DataSet<T>`.
+ *
+ * Wire format (native byte order, i.e. little-endian on all supported targets):
+ *  - lengths and counts are unsigned LEB128 var-ints, signed integers (e.g. Tag::index) are zig-zag var-ints
+ *  - each pmt value is prefixed by one byte holding its variant index in `pmtv::pmt`
+ *  - arithmetic and complex scalars are stored as raw bytes
+ *  - vectors of arithmetic/complex values are stored as a count followed by the raw element data which is zero-padded
+ *    to `alignof(T)` w.r.t. the start of the encoded buffer. This permits zero-copy access via `BinaryReader::readSpan<T>()`
+ *    provided the receiving buffer is itself suitably aligned (e.g. `std::vector<std::uint8_t>` or shared/mapped memory)
+ *  - map keys are either stored inline (var-int 0 + string) or, if interning is enabled, as a back-reference
+ *    (var-int id + 1) to an earlier occurrence within the same buffer
+ *
+ * Usage:
+ * @code
+ * std::vector<std::uint8_t> bytes = gr::serialiser::serialise(tag);
+ * gr::Tag                   copy  = gr::serialiser::deserialise<gr::Tag>(bytes);
+ * @endcode
+ */
+enum class KeyEncoding : std::uint8_t {
+    Inline,  /// every key is written as a string
+    Interned /// repeated keys are written as back-references to the first occurrence
+};
+
+namespace detail {
+using pmt_types = meta::to_typelist<pmtv::pmt>;
+
+template<typename T>
+concept TriviallySerialisable = std::is_arithmetic_v<T> || std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>> || std::is_same_v<T, std::byte>;
+
+template<typename T>
+concept TriviallySerialisableVector = meta::vector_type<T> && TriviallySerialisable<typename T::value_type> && !std::is_same_v<typename T::value_type, bool>;
+
+template<typename T>
+concept PmtVector = meta::vector_type<T> && std::is_same_v<typename T::value_type, pmtv::pmt>;
+
+template<typename T>
+concept DataSetType = requires { typename T::value_type; } && std::is_same_v<T, DataSet<typename T::value_type>>;
+
+template<typename T>
+concept PmtMapLike = requires {
+    typename T::key_type;
+    typename T::mapped_type;
+} && std::is_same_v<typename T::key_type, std::string> && std::is_same_v<typename T::mapped_type, pmtv::pmt>;
+
+struct StringHash {
+    using is_transparent = void;
+
+    [[nodiscard]] std::size_t
+    operator()(std::string_view str) const noexcept {
+        return std::hash<std::string_view>{}(str);
+    }
+};
+
+[[nodiscard]] constexpr std::uint64_t
+zigZagEncode(std::int64_t value) noexcept {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+[[nodiscard]] constexpr std::int64_t
+zigZagDecode(std::uint64_t value) noexcept {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+} // namespace detail
+
+class BinaryWriter {
+    std::vector<std::uint8_t>                                                          _buffer;
+    KeyEncoding                                                                        _keyEncoding;
+    std::unordered_map<std::string, std::size_t, detail::StringHash, std::equal_to<>> _keyIds;
+
+public:
+    explicit BinaryWriter(KeyEncoding keyEncoding = KeyEncoding::Interned, std::size_t initialCapacity = 256UZ) : _keyEncoding(keyEncoding) { _buffer.reserve(initialCapacity); }
+
+    [[nodiscard]] std::span<const std::uint8_t>
+    data() const noexcept {
+        return _buffer;
+    }
+
+    [[nodiscard]] std::size_t
+    size() const noexcept {
+        return _buffer.size();
+    }
+
+    [[nodiscard]] std::vector<std::uint8_t>
+    release() noexcept {
+        _keyIds.clear();
+        return std::exchange(_buffer, {});
+    }
+
+    void
+    clear() noexcept {
+        _buffer.clear();
+        _keyIds.clear();
+    }
+
+    void
+    writeVarInt(std::uint64_t value) {
+        while (value >= 0x80) {
+            _buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        _buffer.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    void
+    writeSignedVarInt(std::int64_t value) {
+        writeVarInt(detail::zigZagEncode(value));
+    }
+
+    template<detail::TriviallySerialisable T>
+    void
+    write(const T &value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            _buffer.push_back(static_cast<std::uint8_t>(value));
+        } else {
+            const auto offset = _buffer.size();
+            _buffer.resize(offset + sizeof(T));
+            std::memcpy(_buffer.data() + offset, &value, sizeof(T));
+        }
+    }
+
+    void
+    writeString(std::string_view str) {
+        writeVarInt(str.size());
+        _buffer.insert(_buffer.end(), str.begin(), str.end());
+    }
+
+    void
+    writeKey(std::string_view key) {
+        if (_keyEncoding == KeyEncoding::Interned) {
+            if (auto it = _keyIds.find(key); it != _keyIds.end()) {
+                writeVarInt(it->second + 1UZ);
+                return;
+            }
+            _keyIds.emplace(std::string(key), _keyIds.size());
+        }
+        writeVarInt(0UZ);
+        writeString(key);
+    }
+
+    template<detail::TriviallySerialisable T>
+        requires(!std::is_same_v<T, bool>)
+    void
+    writeSpan(std::span<const T> values) {
+        writeVarInt(values.size());
+        const auto padding = (alignof(T) - _buffer.size() % alignof(T)) % alignof(T);
+        const auto offset  = _buffer.size() + padding;
+        _buffer.resize(offset + values.size_bytes(), std::uint8_t{ 0 });
+        if (!values.empty()) {
+            std::memcpy(_buffer.data() + offset, values.data(), values.size_bytes());
+        }
+    }
+};
+
+class BinaryReader {
+    std::span<const std::uint8_t> _data;
+    std::size_t                   _position = 0UZ;
+    std::vector<std::string_view> _keys; // N.B. views into _data
+
+    void
+    require(std::size_t nBytes) const {
+        if (nBytes > _data.size() - _position) {
+            throw gr::exception(fmt::format("BinaryReader: truncated input - requested {} bytes at position {} of {}", nBytes, _position, _data.size()));
+        }
+    }
+
+public:
+    explicit BinaryReader(std::span<const std::uint8_t> data) noexcept : _data(data) {}
+
+    [[nodiscard]] std::size_t
+    position() const noexcept {
+        return _position;
+    }
+
+    [[nodiscard]] std::size_t
+    available() const noexcept {
+        return _data.size() - _position;
+    }
+
+    [[nodiscard]] std::uint64_t
+    readVarInt() {
+        std::uint64_t result = 0;
+        for (std::size_t shift = 0UZ; shift < 64UZ; shift += 7UZ) {
+            require(1UZ);
+            const std::uint8_t byte = _data[_position++];
+            result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return result;
+            }
+        }
+        throw gr::exception(fmt::format("BinaryReader: malformed var-int at position {}", _position));
+    }
+
+    /**
+     * @brief reads an element count and validates it against the remaining input -- to be used before sizing containers
+     * @param minElementBytes minimum number of bytes a single encoded element occupies
+     */
+    [[nodiscard]] std::size_t
+    readCount(std::size_t minElementBytes = 1UZ) {
+        const auto position = _position;
+        const auto count    = readVarInt();
+        if (count > available() / std::max(minElementBytes, 1UZ)) {
+            throw gr::exception(fmt::format("BinaryReader: invalid element count {} at position {} - exceeds the remaining {} bytes", count, position, available()));
+        }
+        return static_cast<std::size_t>(count);
+    }
+
+    [[nodiscard]] std::int64_t
+    readSignedVarInt() {
+        return detail::zigZagDecode(readVarInt());
+    }
+
+    template<detail::TriviallySerialisable T>
+    [[nodiscard]] T
+    read() {
+        require(sizeof(T));
+        if constexpr (std::is_same_v<T, bool>) {
+            return _data[_position++] != 0U;
+        } else {
+            T value;
+            std::memcpy(&value, _data.data() + _position, sizeof(T));
+            _position += sizeof(T);
+            return value;
+        }
+    }
+
+    /**
+     * @brief returns a view to the string payload within the underlying buffer (zero-copy)
+     */
+    [[nodiscard]] std::string_view
+    readStringView() {
+        const auto length = static_cast<std::size_t>(readVarInt());
+        require(length);
+        std::string_view result(reinterpret_cast<const char *>(_data.data() + _position), length);
+        _position += length;
+        return result;
+    }
+
+    [[nodiscard]] std::string
+    readString() {
+        return std::string(readStringView());
+    }
+
+    [[nodiscard]] std::string_view
+    readKey() {
+        const auto id = static_cast<std::size_t>(readVarInt());
+        if (id == 0UZ) {
+            return _keys.emplace_back(readStringView());
+        }
+        if (id > _keys.size()) {
+            throw gr::exception(fmt::format("BinaryReader: unknown interned key id {} (known: {})", id - 1UZ, _keys.size()));
+        }
+        return _keys[id - 1UZ];
+    }
+
+    /**
+     * @brief returns a view to a vector payload within the underlying buffer (zero-copy).
+     * N.B. requires the underlying buffer to be aligned to at least `alignof(T)`.
+     */
+    template<detail::TriviallySerialisable T>
+        requires(!std::is_same_v<T, bool>)
+    [[nodiscard]] std::span<const T>
+    readSpan() {
+        const auto count   = static_cast<std::size_t>(readVarInt());
+        const auto padding = (alignof(T) - _position % alignof(T)) % alignof(T);
+        if (count > (std::numeric_limits<std::size_t>::max() - padding) / sizeof(T)) {
+            throw gr::exception(fmt::format("BinaryReader: invalid vector size {} at position {}", count, _position));
+        }
+        require(padding + count * sizeof(T));
+        _position += padding;
+        const std::uint8_t *begin = _data.data() + _position;
+        if (reinterpret_cast<std::uintptr_t>(begin) % alignof(T) != 0) {
+            throw gr::exception(fmt::format("BinaryReader: buffer not aligned to {} bytes for zero-copy access of '{}'", alignof(T), gr::meta::type_name<T>()));
+        }
+        _position += count * sizeof(T);
+        return { reinterpret_cast<const T *>(begin), count };
+    }
+
+    template<detail::TriviallySerialisable T>
+        requires(!std::is_same_v<T, bool>)
+    [[nodiscard]] std::vector<T>
+    readVector() {
+        const auto count   = static_cast<std::size_t>(readVarInt());
+        const auto padding = (alignof(T) - _position % alignof(T)) % alignof(T);
+        if (count > (std::numeric_limits<std::size_t>::max() - padding) / sizeof(T)) {
+            throw gr::exception(fmt::format("BinaryReader: invalid vector size {} at position {}", count, _position));
+        }
+        require(padding + count * sizeof(T));
+        _position += padding;
+        std::vector<T> result(count);
+        if (count > 0UZ) {
+            std::memcpy(result.data(), _data.data() + _position, count * sizeof(T));
+        }
+        _position += count * sizeof(T);
+        return result;
+    }
+
+    [[nodiscard]] std::uint8_t
+    peekTypeIndex() const {
+        require(1UZ);
+        return _data[_position];
+    }
+};
+
+inline void
+encode(BinaryWriter &writer, const pmtv::pmt &value);
+
+inline constexpr std::size_t kMaxNestingDepth = 64UZ; // of nested maps and pmt vectors, bounds the decoder's recursion on untrusted input
+
+[[nodiscard]] inline pmtv::pmt
+decodePmt(BinaryReader &reader, std::size_t depth = 0UZ);
+
+template<detail::PmtMapLike TMap>
+void
+encode(BinaryWriter &writer, const TMap &map) {
+    writer.writeVarInt(map.size());
+    for (const auto &[key, value] : map) {
+        writer.writeKey(key);
+        encode(writer, value);
+    }
+}
+
+template<detail::PmtMapLike TMap = property_map>
+[[nodiscard]] TMap
+decodeMap(BinaryReader &reader, std::size_t depth = 0UZ) {
+    TMap       result;
+    const auto count = reader.readCount(2UZ); // N.B. key id + pmt type index
+    for (std::size_t i = 0UZ; i < count; ++i) {
+        const auto key = reader.readKey();
+        result.insert_or_assign(std::string(key), decodePmt(reader, depth + 1UZ));
+    }
+    return result;
+}
+
+namespace detail {
+template<typename T>
+void
+encodeValue(BinaryWriter &writer, const T &value) {
+    if constexpr (std::is_same_v<T, std::monostate>) {
+        // no payload
+    } else if constexpr (TriviallySerialisable<T>) {
+        writer.write(value);
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        writer.writeString(value);
+    } else if constexpr (std::is_same_v<T, std::vector<bool>>) {
+        writer.writeVarInt(value.size());
+        for (bool bit : value) {
+            writer.write(bit);
+        }
+    } else if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+        writer.writeVarInt(value.size());
+        for (const auto &str : value) {
+            writer.writeString(str);
+        }
+    } else if constexpr (TriviallySerialisableVector<T>) {
+        writer.writeSpan(std::span<const typename T::value_type>(value));
+    } else if constexpr (PmtVector<T>) {
+        writer.writeVarInt(value.size());
+        for (const auto &element : value) {
+            encode(writer, element);
+        }
+    } else if constexpr (PmtMapLike<T>) {
+        encode(writer, value);
+    } else {
+        throw gr::exception(fmt::format("BinaryWriter: unsupported pmt type '{}'", gr::meta::type_name<T>()));
+    }
+}
+
+template<typename T>
+[[nodiscard]] pmtv::pmt
+decodeValue(BinaryReader &reader, [[maybe_unused]] std::size_t depth) {
+    if constexpr (std::is_same_v<T, std::monostate>) {
+        return pmtv::pmt{};
+    } else if constexpr (TriviallySerialisable<T>) {
+        return reader.read<T>();
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return reader.readString();
+    } else if constexpr (std::is_same_v<T, std::vector<bool>>) {
+        std::vector<bool> result(reader.readCount());
+        for (std::size_t i = 0UZ; i < result.size(); ++i) {
+            result[i] = reader.read<bool>();
+        }
+        return result;
+    } else if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+        std::vector<std::string> result(reader.readCount()); // N.B. one length byte per string
+        for (auto &str : result) {
+            str = reader.readString();
+        }
+        return result;
+    } else if constexpr (TriviallySerialisableVector<T>) {
+        return reader.readVector<typename T::value_type>();
+    } else if constexpr (PmtVector<T>) {
+        T          result;
+        const auto count = reader.readCount(); // N.B. one type index byte per element
+        result.reserve(count);
+        for (std::size_t i = 0UZ; i < count; ++i) {
+            result.emplace_back(decodePmt(reader, depth + 1UZ));
+        }
+        return result;
+    } else if constexpr (PmtMapLike<T>) {
+        return decodeMap<T>(reader, depth);
+    } else {
+        throw gr::exception(fmt::format("BinaryReader: unsupported pmt type '{}'", gr::meta::type_name<T>()));
+    }
+}
+
+template<std::size_t... Is>
+[[nodiscard]] constexpr auto
+makePmtDecoders(std::index_sequence<Is...>) {
+    return std::array<pmtv::pmt (*)(BinaryReader &, std::size_t), sizeof...(Is)>{ &decodeValue<typename pmt_types::template at<Is>>... };
+}
+
+inline constexpr auto kPmtDecoders = makePmtDecoders(std::make_index_sequence<pmt_types::size>());
+} // namespace detail
+
+inline void
+encode(BinaryWriter &writer, const pmtv::pmt &value) {
+    writer.write(static_cast<std::uint8_t>(value.index()));
+    std::visit([&writer](const auto &arg) { detail::encodeValue(writer, arg); }, value);
+}
+
+[[nodiscard]] inline pmtv::pmt
+decodePmt(BinaryReader &reader, std::size_t depth) {
+    if (depth > kMaxNestingDepth) {
+        throw gr::exception(fmt::format("BinaryReader: pmt nesting exceeds the maximum depth of {} at position {}", kMaxNestingDepth, reader.position()));
+    }
+    const auto typeIndex = reader.read<std::uint8_t>();
+    if (typeIndex >= detail::kPmtDecoders.size()) {
+        throw gr::exception(fmt::format("BinaryReader: invalid pmt type index {}", typeIndex));
+    }
+    return detail::kPmtDecoders[typeIndex](reader, depth);
+}
+
+/**
+ * @brief zero-copy access to a pmt-encoded `std::vector<T>` value
+ */
+template<detail::TriviallySerialisable T>
+[[nodiscard]] std::span<const T>
+decodePmtView(BinaryReader &reader) {
+    constexpr auto expectedIndex = detail::pmt_types::index_of<std::vector<T>>();
+    static_assert(expectedIndex != static_cast<std::size_t>(-1), "std::vector<T> is not a pmt type");
+    if (const auto typeIndex = reader.read<std::uint8_t>(); typeIndex != expectedIndex) {
+        throw gr::exception(fmt::format("BinaryReader: type index {} does not match expected std::vector<{}> index {}", typeIndex, gr::meta::type_name<T>(), expectedIndex));
+    }
+    return reader.readSpan<T>();
+}
+
+inline void
+encode(BinaryWriter &writer, const Tag &tag) {
+    writer.writeSignedVarInt(tag.index);
+    encode(writer, tag.map);
+}
+
+[[nodiscard]] inline Tag
+decodeTag(BinaryReader &reader) {
+    const auto index = static_cast<Tag::signed_index_type>(reader.readSignedVarInt());
+    return Tag(index, decodeMap(reader));
+}
+
+/**
+ * N.B. the `Error::sourceLocation` refers to the sender's code and cannot be reconstructed on the receiving side.
+ * Only the error message and time-stamp are transmitted.
+ */
+inline void
+encode(BinaryWriter &writer, const Message &message) {
+    writer.writeString(message.protocol);
+    writer.write(static_cast<std::uint8_t>(message.cmd));
+    writer.writeString(message.serviceName);
+    writer.writeString(message.clientRequestID);
+    writer.writeString(message.endpoint);
+    writer.writeString(message.rbac);
+    writer.write(message.data.has_value());
+    if (message.data.has_value()) {
+        encode(writer, message.data.value());
+    } else {
+        const Error &error = message.data.error();
+        writer.writeString(error.message);
+        writer.writeSignedVarInt(std::chrono::duration_cast<std::chrono::nanoseconds>(error.errorTime.time_since_epoch()).count());
+    }
+}
+
+[[nodiscard]] inline Message
+decodeMessage(BinaryReader &reader) {
+    Message message;
+    message.protocol   = reader.readString();
+    const auto command = reader.read<std::uint8_t>();
+    if (!magic_enum::enum_contains<message::Command>(command)) {
+        throw gr::exception(fmt::format("BinaryReader: invalid message command {:#04x}", command));
+    }
+    message.cmd             = static_cast<message::Command>(command);
+    message.serviceName     = reader.readString();
+    message.clientRequestID = reader.readString();
+    message.endpoint        = reader.readString();
+    message.rbac            = reader.readString();
+    if (reader.read<bool>()) {
+        message.data = decodeMap(reader);
+    } else {
+        const auto errorMessage = reader.readStringView();
+        const auto errorTime    = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(reader.readSignedVarInt())));
+        message.data            = std::unexpected(Error(errorMessage, std::source_location::current(), errorTime));
+    }
+    return message;
+}
+
+namespace detail {
+inline void
+encodeStrings(BinaryWriter &writer, const std::vector<std::string> &strings) {
+    writer.writeVarInt(strings.size());
+    for (const auto &str : strings) {
+        writer.writeString(str);
+    }
+}
+
+[[nodiscard]] inline std::vector<std::string>
+decodeStrings(BinaryReader &reader) {
+    std::vector<std::string> result(reader.readCount());
+    for (auto &str : result) {
+        str = reader.readString();
+    }
+    return result;
+}
+
+template<typename T>
+void
+encodeNested(BinaryWriter &writer, const std::vector<std::vector<T>> &values) {
+    writer.writeVarInt(values.size());
+    for (const auto &inner : values) {
+        writer.writeSpan(std::span<const T>(inner));
+    }
+}
+
+template<typename T>
+[[nodiscard]] std::vector<std::vector<T>>
+decodeNested(BinaryReader &reader) {
+    std::vector<std::vector<T>> result(reader.readCount()); // N.B. one count byte per inner vector
+    for (auto &inner : result) {
+        inner = reader.readVector<T>();
+    }
+    return result;
+}
+} // namespace detail
+
+template<detail::TriviallySerialisable T>
+void
+encode(BinaryWriter &writer, const DataSet<T> &dataSet) {
+    writer.writeSignedVarInt(dataSet.timestamp);
+    detail::encodeStrings(writer, dataSet.axis_names);
+    detail::encodeStrings(writer, dataSet.axis_units);
+    detail::encodeNested(writer, dataSet.axis_values);
+    writer.writeSpan(std::span<const std::int32_t>(dataSet.extents));
+    writer.write(static_cast<std::uint8_t>(dataSet.layout.index()));
+    if (const auto *customLayout = std::get_if<std::string>(&dataSet.layout)) {
+        writer.writeString(*customLayout);
+    }
+    detail::encodeStrings(writer, dataSet.signal_names);
+    detail::encodeStrings(writer, dataSet.signal_units);
+    writer.writeSpan(std::span<const T>(dataSet.signal_values));
+    writer.writeSpan(std::span<const T>(dataSet.signal_errors));
+    detail::encodeNested(writer, dataSet.signal_ranges);
+    writer.writeVarInt(dataSet.meta_information.size());
+    for (const auto &map : dataSet.meta_information) {
+        encode(writer, map);
+    }
+    writer.writeVarInt(dataSet.timing_events.size());
+    for (const auto &tags : dataSet.timing_events) {
+        writer.writeVarInt(tags.size());
+        for (const auto &tag : tags) {
+            encode(writer, tag);
+        }
+    }
+}
+
+template<detail::TriviallySerialisable T>
+[[nodiscard]] DataSet<T>
+decodeDataSet(BinaryReader &reader) {
+    DataSet<T> dataSet;
+    dataSet.timestamp   = reader.readSignedVarInt();
+    dataSet.axis_names  = detail::decodeStrings(reader);
+    dataSet.axis_units  = detail::decodeStrings(reader);
+    dataSet.axis_values = detail::decodeNested<T>(reader);
+    dataSet.extents     = reader.readVector<std::int32_t>();
+    switch (reader.read<std::uint8_t>()) {
+    case 0: dataSet.layout = LayoutRight{}; break;
+    case 1: dataSet.layout = LayoutLeft{}; break;
+    case 2: dataSet.layout = reader.readString(); break;
+    default: throw gr::exception("BinaryReader: invalid DataSet layout index");
+    }
+    dataSet.signal_names  = detail::decodeStrings(reader);
+    dataSet.signal_units  = detail::decodeStrings(reader);
+    dataSet.signal_values = reader.readVector<T>();
+    dataSet.signal_errors = reader.readVector<T>();
+    dataSet.signal_ranges = detail::decodeNested<T>(reader);
+    dataSet.meta_information.resize(reader.readCount());
+    for (auto &map : dataSet.meta_information) {
+        map = decodeMap<typename DataSet<T>::pmt_map>(reader);
+    }
+    dataSet.timing_events.resize(reader.readCount());
+    for (auto &tags : dataSet.timing_events) {
+        tags.resize(reader.readCount(2UZ)); // N.B. index + map size
+        for (auto &tag : tags) {
+            tag = decodeTag(reader);
+        }
+    }
+    return dataSet;
+}
+
+template<typename T>
+[[nodiscard]] T
+decode(BinaryReader &reader) {
+    if constexpr (std::is_same_v<T, pmtv::pmt>) {
+        return decodePmt(reader);
+    } else if constexpr (detail::PmtMapLike<T>) {
+        return decodeMap<T>(reader);
+    } else if constexpr (std::is_same_v<T, Tag>) {
+        return decodeTag(reader);
+    } else if constexpr (std::is_same_v<T, Message>) {
+        return decodeMessage(reader);
+    } else if constexpr (detail::DataSetType<T>) {
+        return decodeDataSet<typename T::value_type>(reader);
+    } else {
+        static_assert(meta::always_false<T>, "unsupported type");
+    }
+}
+
+template<typename T>
+[[nodiscard]] std::vector<std::uint8_t>
+serialise(const T &value, KeyEncoding keyEncoding = KeyEncoding::Interned) {
+    BinaryWriter writer(keyEncoding);
+    encode(writer, value);
+    return writer.release();
+}
+
+template<typename T>
+[[nodiscard]] T
+deserialise(std::span<const std::uint8_t> data) {
+    BinaryReader reader(data);
+    return decode<T>(reader);
+}
+
+} // namespace gr::serialiser
+
+#endif // GNURADIO_BINARY_SERIALISER_HPP
@@ -1,6 +1,8 @@
 #ifndef GNURADIO_BLOCK_HPP
 #define GNURADIO_BLOCK_HPP
 
+#include <atomic>
+#include <chrono>
 #include <limits>
 #include <map>
 #include <source_location>
@@ -49,6 +51,35 @@ simdize_tuple_load_and_apply(auto width, const std::tuple<Ts...> &rngs, auto off
     }(std::make_index_sequence<sizeof...(Ts)>());
 }
 
+/**
+ * @return number of samples to advance from 'offset' until 'range' is aligned for native-width vector loads/stores
+ * (0 if already aligned or if the data cannot be aligned at all, e.g. for element sizes that do not divide the alignment).
+ * N.B. deliberately not the alignment of the (up to 4x native) processing width, which would peel up to 4x more samples
+ */
+template<std::ranges::contiguous_range R>
+std::size_t
+simd_alignment_offset(const R &range, std::size_t offset) noexcept {
+    using T                         = std::ranges::range_value_t<R>;
+    constexpr std::size_t alignment = stdx::memory_alignment_v<stdx::native_simd<T>>;
+    const auto            address   = reinterpret_cast<std::uintptr_t>(std::ranges::data(range) + offset);
+    if constexpr (alignment % sizeof(T) != 0) {
+        return 0UZ;
+    } else {
+        return address % sizeof(T) == 0 ? ((alignment - address % alignment) % alignment) / sizeof(T) : 0UZ;
+    }
+}
+
+/**
+ * @return true if all ranges are aligned for 'width'-wide vector loads/stores at 'offset'
+ */
+template<std::ranges::contiguous_range... Ts>
+bool
+is_simd_aligned(auto width, const std::tuple<Ts...> &rngs, std::size_t offset) noexcept {
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        return (true && ... && (reinterpret_cast<std::uintptr_t>(std::ranges::data(std::get<Is>(rngs)) + offset) % stdx::memory_alignment_v<meta::simdize<std::ranges::range_value_t<Ts>, decltype(width)::value>> == 0));
+    }(std::make_index_sequence<sizeof...(Ts)>());
+}
+
 template<typename T, typename... Us>
 auto
 invokeProcessOneWithOrWithoutOffset(T &node, std::size_t offset, const Us &...inputs) {
@@ -175,6 +206,98 @@ struct Result {
     std::size_t performed_work = 0;
     Status      status         = Status::OK;
 };
+
+/**
+ * always-on per-block work statistics, @see block::property::kPerformanceCounters
+ *
+ * N.B. single writer (the thread executing the block's work function), counters are incremented using relaxed
+ * load/store pairs rather than read-modify-write operations and may be read concurrently from any other thread.
+ * 'blocked on input/output' is the wall-time from the first INSUFFICIENT_INPUT/OUTPUT_ITEMS return until the next call
+ * that returns any other status.
+ */
+class PerformanceCounters {
+    using clock = std::chrono::steady_clock;
+
+    std::atomic<std::uint64_t> _nCalls{ 0U };
+    std::atomic<std::uint64_t> _nSamplesIn{ 0U };
+    std::atomic<std::uint64_t> _nSamplesOut{ 0U };
+    std::atomic<std::uint64_t> _nTags{ 0U };
+    std::atomic<std::uint64_t> _workTimeNs{ 0U };
+    std::atomic<std::uint64_t> _blockedOnInputNs{ 0U };
+    std::atomic<std::uint64_t> _blockedOnOutputNs{ 0U };
+    std::atomic<std::uint64_t> _nInsufficientInput{ 0U };
+    std::atomic<std::uint64_t> _nInsufficientOutput{ 0U };
+    Status                     _blockedStatus = Status::OK; // writer-only
+    clock::time_point          _blockedSince{};             // writer-only
+
+    static void
+    add(std::atomic<std::uint64_t> &counter, std::uint64_t value) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    static std::uint64_t
+    toNs(clock::duration duration) noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+public:
+    [[nodiscard]] static clock::time_point
+    now() noexcept {
+        return clock::now();
+    }
+
+    void
+    addSamplesOut(std::size_t nSamples) noexcept {
+        add(_nSamplesOut, nSamples);
+    }
+
+    void
+    addTags(std::size_t nTags) noexcept {
+        add(_nTags, nTags);
+    }
+
+    void
+    update(const Result &result, clock::time_point start, clock::time_point stop) noexcept {
+        add(_nCalls, 1U);
+        add(_nSamplesIn, result.performed_work);
+        add(_workTimeNs, toNs(stop - start));
+
+        if (result.status == Status::INSUFFICIENT_INPUT_ITEMS) {
+            add(_nInsufficientInput, 1U);
+        } else if (result.status == Status::INSUFFICIENT_OUTPUT_ITEMS) {
+            add(_nInsufficientOutput, 1U);
+        }
+        if (result.status == _blockedStatus) {
+            return;
+        }
+        if (_blockedStatus != Status::OK) { // close the pending blocked interval
+            add(_blockedStatus == Status::INSUFFICIENT_INPUT_ITEMS ? _blockedOnInputNs : _blockedOnOutputNs, toNs(start - _blockedSince));
+        }
+        const bool blocked = result.status == Status::INSUFFICIENT_INPUT_ITEMS || result.status == Status::INSUFFICIENT_OUTPUT_ITEMS;
+        _blockedStatus     = blocked ? result.status : Status::OK;
+        _blockedSince      = start;
+    }
+
+    void
+    reset() noexcept {
+        for (auto *counter : { &_nCalls, &_nSamplesIn, &_nSamplesOut, &_nTags, &_workTimeNs, &_blockedOnInputNs, &_blockedOnOutputNs, &_nInsufficientInput, &_nInsufficientOutput }) {
+            counter->store(0U, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] property_map
+    get() const {
+        return { { "calls", _nCalls.load(std::memory_order_relaxed) },                           //
+                 { "samples_in", _nSamplesIn.load(std::memory_order_relaxed) },                  //
+                 { "samples_out", _nSamplesOut.load(std::memory_order_relaxed) },                //
+                 { "tags", _nTags.load(std::memory_order_relaxed) },                             //
+                 { "work_time_ns", _workTimeNs.load(std::memory_order_relaxed) },                //
+                 { "blocked_on_input_ns", _blockedOnInputNs.load(std::memory_order_relaxed) },   //
+                 { "blocked_on_output_ns", _blockedOnOutputNs.load(std::memory_order_relaxed) }, //
+                 { "insufficient_input", _nInsufficientInput.load(std::memory_order_relaxed) },  //
+                 { "insufficient_output", _nInsufficientOutput.load(std::memory_order_relaxed) } };
+    }
+};
 } // namespace work
 
 template<typename T>
@@ -235,6 +358,8 @@ inline static const char *kStagedSetting = "StagedSettings";  ///< asynchronous
 
 inline static const char *kStoreDefaults = "StoreDefaults"; ///< store present settings as default, for counterpart @see kResetDefaults
 inline static const char *kResetDefaults = "ResetDefaults"; ///< retrieve and reset to default setting, for counterpart @see kStoreDefaults
+
+inline static const char *kPerformanceCounters = "PerformanceCounters"; ///< always-on work statistics (calls, samples, timing, ...), 'Set' w/ { "reset", true } resets the counters
 } // namespace block::property
 
 /**
@@ -347,6 +472,7 @@ inline static const char *kResetDefaults = "ResetDefaults"; ///< retrieve and re
  * - `kLifeCycleState`: Manages and reports the block's lifecycle state.
  * - `kSetting` & `kStagedSetting`: Handle real-time and non-real-time configuration adjustments.
  * - `kStoreDefaults` & `kResetDefaults`: Facilitate storing and reverting to default settings.
+ * - `kPerformanceCounters`: Reports the block's always-on work statistics, @see work::PerformanceCounters.
  *
  * These properties can be interacted with through messages, supporting operations like setting values, querying states, and subscribing to updates.
  * This model provides a flexible interface for blocks to adapt their processing based on runtime conditions and external inputs.
@@ -404,7 +530,8 @@ public:
     using StrideControl              = ArgumentsTypeList::template find_or_default<is_stride, Stride<0UL, true>>;
     using AllowIncompleteFinalUpdate = ArgumentsTypeList::template find_or_default<is_incompleteFinalUpdatePolicy, IncompleteFinalUpdatePolicy<IncompleteFinalUpdateEnum::DROP>>;
     using DrawableControl            = ArgumentsTypeList::template find_or_default<is_drawable, Drawable<UICategory::None, "">>;
-    constexpr static bool blockingIO = std::disjunction_v<std::is_same<BlockingIO<true>, Arguments>...> || std::disjunction_v<std::is_same<BlockingIO<false>, Arguments>...>;
+    constexpr static bool blockingIO      = std::disjunction_v<std::is_same<BlockingIO<true>, Arguments>...> || std::disjunction_v<std::is_same<BlockingIO<false>, Arguments>...>;
+    constexpr static bool chunkAcrossTags = std::disjunction_v<std::is_same<ChunkAcrossTags, Arguments>...>;
 
     template<typename T>
     auto &
@@ -423,9 +550,9 @@ public:
     alignas(hardware_destructive_interference_size) work::Counter ioWorkDone{};
     alignas(hardware_destructive_interference_size) std::atomic<work::Status> ioLastWorkStatus{ work::Status::OK };
     alignas(hardware_destructive_interference_size) std::shared_ptr<gr::Sequence> progress                         = std::make_shared<gr::Sequence>();
-    alignas(hardware_destructive_interference_size) std::shared_ptr<gr::thread_pool::BasicThreadPool> ioThreadPool = std::make_shared<gr::thread_pool::BasicThreadPool>(
-            "block_thread_pool", gr::thread_pool::TaskType::IO_BOUND, 2UZ, std::numeric_limits<uint32_t>::max());
+    alignas(hardware_destructive_interference_size) std::shared_ptr<gr::thread_pool::BasicThreadPool> ioThreadPool; // provided by the graph via 'init(...)' or lazily created by BlockingIO blocks
     alignas(hardware_destructive_interference_size) std::atomic<bool> ioThreadRunning{ false };
+    alignas(hardware_destructive_interference_size) work::PerformanceCounters performanceCounters{};
 
     constexpr static TagPropagationPolicy tag_policy = TagPropagationPolicy::TPP_ALL_TO_ALL;
 
@@ -486,6 +613,7 @@ public:
         { block::property::kStagedSetting, &Block::propertyCallbackStagedSettings },  //
         { block::property::kStoreDefaults, &Block::propertyCallbackStoreDefaults },   //
         { block::property::kResetDefaults, &Block::propertyCallbackResetDefaults },   //
+        { block::property::kPerformanceCounters, &Block::propertyCallbackPerformanceCounters }, //
     };
     std::map<std::string, std::set<std::string>> propertySubscriptions;
 
@@ -900,6 +1028,9 @@ public:
                     };
 
                     const Tag mergedPortTags = input_port.getTag(static_cast<gr::Tag::signed_index_type>(untilOffset));
+                    if (!mergedPortTags.map.empty()) {
+                        performanceCounters.addTags(1UZ);
+                    }
                     mergeSrcMapInto(mergedPortTags.map, _mergedInputTag.map);
                 },
                 inputPorts<PortType::STREAM>(&self()));
@@ -915,17 +1046,57 @@ public:
         }
     }
 
+    /**
+     * Collects and consumes the tags on the input ports up to (and incl.) the sample 'offset' w.r.t. the present read
+     * position (i.e. inside the chunk being processed), applies them as settings and, if requested, forwards them at the
+     * same offset to the output ports. Used for `ChunkAcrossTags` blocks only.
+     */
+    void
+    updateInputAndOutputTagsWithinChunk(std::size_t offset) {
+        _mergedInputTag.map.clear();
+        for_each_port(
+                [offset, this]<typename Port>(Port &inputPort) noexcept {
+                    if constexpr (std::remove_cvref_t<Port>::kIsSynch) {
+                        const auto                    readPosition = inputPort.streamReader().position();
+                        const gr::ConsumableSpan auto tags         = inputPort.tagReader().get();
+                        std::size_t                   nTags        = 0UZ;
+                        for (const Tag &tag : tags) {
+                            if (tag.index >= 0 && tag.index - readPosition > static_cast<Tag::signed_index_type>(offset)) {
+                                break;
+                            }
+                            for (const auto &[key, value] : tag.map) { // N.B. wildcard tags (index == -1) are applied at the next tag position
+                                _mergedInputTag.map.insert_or_assign(key, value);
+                            }
+                            nTags++;
+                        }
+                        if (nTags > 0UZ) {
+                            performanceCounters.addTags(1UZ);
+                        }
+                        std::ignore = tags.consume(nTags);
+                    }
+                },
+                inputPorts<PortType::STREAM>(&self()));
+
+        if (!mergedInputTag().map.empty()) {
+            settings().autoUpdate(mergedInputTag().map);
+            if constexpr (Derived::tag_policy == TagPropagationPolicy::TPP_ALL_TO_ALL) {
+                publishTag(mergedInputTag().map, static_cast<Tag::signed_index_type>(offset));
+            }
+        }
+        applyChangedSettings(static_cast<Tag::signed_index_type>(offset));
+    }
+
     void
-    applyChangedSettings() {
+    applyChangedSettings(Tag::signed_index_type forwardTagOffset = 0) {
         if (!settings().changed()) {
             return;
         }
-        invokeUserProvidedFunction("applyChangedSettings()", [this] noexcept(false) {
+        invokeUserProvidedFunction("applyChangedSettings()", [this, forwardTagOffset] noexcept(false) {
             auto applyResult = settings().applyStagedParameters();
             checkBlockParameterConsistency();
 
             if (!applyResult.forwardParameters.empty()) {
-                publishTag(applyResult.forwardParameters, 0);
+                publishTag(applyResult.forwardParameters, forwardTagOffset);
             }
 
             settings()._changed.store(false);
@@ -990,6 +1161,9 @@ public:
         using namespace std::chrono;
         const std::uint64_t nanoseconds_count = static_cast<uint64_t>(duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count());
         notifyListeners(block::property::kHeartbeat, { { "heartbeat", nanoseconds_count } });
+        if (const auto it = propertySubscriptions.find(block::property::kPerformanceCounters); it != propertySubscriptions.end() && !it->second.empty()) {
+            notifyListeners(block::property::kPerformanceCounters, performanceCounters.get());
+        }
 
         auto processPort = [this]<PortLike TPort>(TPort &inPort) {
             const auto available = inPort.streamReader().available();
@@ -1185,6 +1359,31 @@ protected:
         throw gr::exception(fmt::format("block {} property {} does not implement command {}, msg: {}", unique_name, propertyName, message.cmd, message));
     }
 
+    std::optional<Message>
+    propertyCallbackPerformanceCounters(std::string_view propertyName, Message message) {
+        using enum gr::message::Command;
+        assert(propertyName == block::property::kPerformanceCounters);
+
+        if (message.cmd == Set || message.cmd == Get) {
+            property_map counters = performanceCounters.get();
+            if (message.cmd == Set && message.data.has_value() && message.data->contains("reset") && std::holds_alternative<bool>(message.data->at("reset")) && std::get<bool>(message.data->at("reset"))) {
+                performanceCounters.reset();
+            }
+            message.data = std::move(counters);
+            return message;
+        } else if (message.cmd == Subscribe) {
+            if (!message.clientRequestID.empty()) {
+                propertySubscriptions[std::string(propertyName)].insert(message.clientRequestID);
+            }
+            return std::nullopt;
+        } else if (message.cmd == Unsubscribe) {
+            propertySubscriptions[std::string(propertyName)].erase(message.clientRequestID);
+            return std::nullopt;
+        }
+
+        throw gr::exception(fmt::format("block {} property {} does not implement command {}, msg: {}", unique_name, propertyName, message.cmd, message));
+    }
+
 protected:
     /***
      * Aggregate the amount of samples that can be consumed/produced from a range of ports.
@@ -1368,25 +1567,51 @@ protected:
     }
 
     work::Status
-    invokeProcessOneSimd(auto &inputSpans, auto &outputSpans, auto width, std::size_t nSamplesToProcess) {
-        std::size_t i = 0;
-        for (; i + width <= nSamplesToProcess; i += width) {
-            const auto &results = simdize_tuple_load_and_apply(width, inputSpans, i, [&](const auto &...input_simds) { return invoke_processOne_simd(i, width, input_simds...); });
-            meta::tuple_for_each([i](auto &output_range, const auto &result) { result.copy_to(output_range.data() + i, stdx::element_aligned); }, outputSpans, results);
+    invokeProcessOneSimd(auto &inputSpans, auto &outputSpans, auto width, std::size_t beginSample, std::size_t endSample) {
+        std::size_t i               = beginSample;
+        auto        processOneChunk = [&](auto w, auto flag) { // processes the samples [i, i + w) and advances 'i'
+            const auto &results = simdize_tuple_load_and_apply(w, inputSpans, i, [&](const auto &...input_simds) { return invoke_processOne_simd(i, w, input_simds...); }, flag);
+            meta::tuple_for_each([i, flag](auto &output_range, const auto &result) { result.copy_to(output_range.data() + i, flag); }, outputSpans, results);
+            i += w;
+        };
+
+        // the buffers are page-aligned but chunks may start at any sample -> peel the head until the (first) output, or input for sinks,
+        // is aligned for native-width vectors and use aligned loads/stores if all ports also meet the alignment of the 'width'-wide
+        // vectors at the same sample (i.e. the common lock-step case), otherwise the (native-aligned) element_aligned loads/stores
+        std::size_t nPeel = 0UZ;
+        if constexpr (std::tuple_size_v<std::remove_cvref_t<decltype(outputSpans)>> > 0UZ) {
+            nPeel = simd_alignment_offset(std::get<0>(outputSpans), beginSample);
+        } else if constexpr (std::tuple_size_v<std::remove_cvref_t<decltype(inputSpans)>> > 0UZ) {
+            nPeel = simd_alignment_offset(std::get<0>(inputSpans), beginSample);
+        }
+        bool isAligned = false;
+        if (endSample - beginSample >= nPeel + width) {
+            for (std::size_t peeled = 0UZ; peeled < nPeel; ++peeled) {
+                processOneChunk(std::integral_constant<std::size_t, 1UZ>{}, stdx::element_aligned);
+            }
+            isAligned = is_simd_aligned(width, inputSpans, i) && is_simd_aligned(width, outputSpans, i);
+        }
+
+        if (isAligned) {
+            while (i + width <= endSample) {
+                processOneChunk(width, stdx::vector_aligned);
+            }
+        } else {
+            while (i + width <= endSample) {
+                processOneChunk(width, stdx::element_aligned);
+            }
         }
         simd_epilogue(width, [&](auto w) {
-            if (i + w <= nSamplesToProcess) {
-                const auto results = simdize_tuple_load_and_apply(w, inputSpans, i, [&](auto &&...input_simds) { return invoke_processOne_simd(i, w, input_simds...); });
-                meta::tuple_for_each([i](auto &output_range, auto &result) { result.copy_to(output_range.data() + i, stdx::element_aligned); }, outputSpans, results);
-                i += w;
+            if (i + w <= endSample) {
+                processOneChunk(w, stdx::element_aligned);
             }
         });
         return work::Status::OK;
     }
 
     work::Status
-    invokeProcessOnePure(auto &inputSpans, auto &outputSpans, std::size_t nSamplesToProcess) {
-        for (std::size_t i = 0; i < nSamplesToProcess; ++i) {
+    invokeProcessOnePure(auto &inputSpans, auto &outputSpans, std::size_t beginSample, std::size_t endSample) {
+        for (std::size_t i = beginSample; i < endSample; ++i) {
             auto results = std::apply([this, i](auto &...inputs) { return this->invoke_processOne(i, inputs[i]...); }, inputSpans);
             meta::tuple_for_each([i]<typename R>(auto &output_range, R &&result) { output_range[i] = std::forward<R>(result); }, outputSpans, results);
         }
@@ -1394,7 +1619,7 @@ protected:
     }
 
     auto
-    invokeProcessOneNonConst(auto &inputSpans, auto &outputSpans, std::size_t nSamplesToProcess) {
+    invokeProcessOneNonConst(auto &inputSpans, auto &outputSpans, std::size_t beginSample, std::size_t endSample) {
         using enum work::Status;
 
         struct ProcessOneResult {
@@ -1404,7 +1629,7 @@ protected:
         };
 
         std::size_t nOutSamplesBeforeRequestedStop = 0;
-        for (std::size_t i = 0; i < nSamplesToProcess; ++i) {
+        for (std::size_t i = beginSample; i < endSample; ++i) {
             auto results = std::apply([this, i](auto &...inputs) { return this->invoke_processOne(i, inputs[i]...); }, inputSpans);
             meta::tuple_for_each(
                     [i]<typename R>(auto &output_range, R &&result) {
@@ -1424,9 +1649,9 @@ protected:
             }
         }
         if (nOutSamplesBeforeRequestedStop > 0) {
-            return ProcessOneResult{ OK, nOutSamplesBeforeRequestedStop, nOutSamplesBeforeRequestedStop };
+            return ProcessOneResult{ OK, beginSample + nOutSamplesBeforeRequestedStop, beginSample + nOutSamplesBeforeRequestedStop };
         }
-        return ProcessOneResult{ OK, nSamplesToProcess, nSamplesToProcess };
+        return ProcessOneResult{ OK, endSample, endSample };
     }
 
     void
@@ -1498,6 +1723,8 @@ protected:
         using enum gr::work::Status;
         using TInputTypes  = traits::block::stream_input_port_types<Derived>;
         using TOutputTypes = traits::block::stream_output_port_types<Derived>;
+        // processOne chunks may span several tags that are applied at their exact offset in between sub-ranges of the chunk
+        constexpr bool kChunkAcrossTags = chunkAcrossTags && !HasProcessBulkFunction<Derived> && HasProcessOneFunction<Derived>;
 
         applyChangedSettings(); // apply settings even if the block is already stopped
 
@@ -1517,7 +1744,8 @@ protected:
         auto [hasTag, nextTag, nextEosTag, asyncEoS]                          = getNextTagAndEosPosition();
         auto       maxChunk                                                   = getMergedBlockLimit(); // handle special cases for merged blocks. TODO: evaluate if/how we can get rid of these
         const auto inputSkipBefore                                            = inputSamplesToSkipBeforeNextChunk(std::min({ maxSyncAvailableIn, nextTag, nextEosTag }));
-        const auto availableToProcess          = std::min({ maxSyncIn, maxChunk, (maxSyncAvailableIn - inputSkipBefore), (nextTag - inputSkipBefore), (nextEosTag - inputSkipBefore) });
+        const auto chunkLimitByTag                                            = kChunkAcrossTags ? std::numeric_limits<std::size_t>::max() : (nextTag - inputSkipBefore);
+        const auto availableToProcess          = std::min({ maxSyncIn, maxChunk, (maxSyncAvailableIn - inputSkipBefore), chunkLimitByTag, (nextEosTag - inputSkipBefore) });
         const auto availableToPublish          = std::min({ maxSyncOut, maxSyncAvailableOut });
         const auto [resampledIn, resampledOut] = computeResampling(minSyncIn, availableToProcess, minSyncOut, availableToPublish);
 
@@ -1551,7 +1779,7 @@ protected:
         // TODO: handle tag propagation to next or previous chunk if there are multiple tags inside min samples, special case EOS -> additional parameter for kAllowIncompleteFinalUpdate
 
         // for non-bulk processing, the processed span has to be limited to the first sample if it contains a tag s.t. the tag is not applied to every sample
-        const bool limitByFirstTag = (!HasProcessBulkFunction<Derived> && HasProcessOneFunction<Derived>) && hasTag;
+        const bool limitByFirstTag = (!HasProcessBulkFunction<Derived> && HasProcessOneFunction<Derived>) && !kChunkAcrossTags && hasTag;
 
         // call the block implementation's work function
         work::Status ret;
@@ -1578,22 +1806,54 @@ protected:
                 constexpr std::size_t                          simd_size             = input_types_simd_size == 0 ? max_simd_double_size : std::min(max_simd_double_size, input_types_simd_size * 4);
                 std::integral_constant<std::size_t, simd_size> width{};
 
-                if constexpr ((meta::simdize_size_v<output_simd_types> != 0) and ((requires(Derived &d) {
-                                                                                      { d.processOne_simd(simd_size) };
-                                                                                  }) or (meta::simdize_size_v<input_simd_types> != 0 and traits::block::can_processOne_simd<Derived>))) { // SIMD loop
-                    invokeUserProvidedFunction("invokeProcessOneSimd", [&ret, &inputSpans, &outputSpans, &width, &processedIn, this] noexcept(HasNoexceptProcessOneFunction<Derived>) {
-                        ret = invokeProcessOneSimd(inputSpans, outputSpans, width, processedIn);
-                    });
-                } else {                                                 // Non-SIMD loop
-                    if constexpr (HasConstProcessOneFunction<Derived>) { // processOne is const -> can process whole batch similar to SIMD-ised call
-                        invokeUserProvidedFunction("invokeProcessOnePure",
-                                                   [&ret, &inputSpans, &outputSpans, &processedIn, this] noexcept(HasNoexceptProcessOneFunction<Derived>) { ret = invokeProcessOnePure(inputSpans, outputSpans, processedIn); });
-                    } else { // processOne isn't const i.e. not a pure function w/o side effects -> need to evaluate state after each sample
-                        const auto result = invokeProcessOneNonConst(inputSpans, outputSpans, processedIn);
-                        ret               = result.status;
-                        processedIn       = result.processedIn;
-                        processedOut      = result.processedOut;
+                // processes the samples [beginSample, endSample) of the chunk, returns the end of the actually processed range
+                auto processRange = [&](std::size_t beginSample, std::size_t endSample) -> std::size_t {
+                    if constexpr ((meta::simdize_size_v<output_simd_types> != 0) and ((requires(Derived &d) {
+                                                                                          { d.processOne_simd(simd_size) };
+                                                                                      }) or (meta::simdize_size_v<input_simd_types> != 0 and traits::block::can_processOne_simd<Derived>))) { // SIMD loop
+                        invokeUserProvidedFunction("invokeProcessOneSimd", [&ret, &inputSpans, &outputSpans, &width, beginSample, endSample, this] noexcept(HasNoexceptProcessOneFunction<Derived>) {
+                            ret = invokeProcessOneSimd(inputSpans, outputSpans, width, beginSample, endSample);
+                        });
+                        return endSample;
+                    } else {                                                 // Non-SIMD loop
+                        if constexpr (HasConstProcessOneFunction<Derived>) { // processOne is const -> can process whole batch similar to SIMD-ised call
+                            invokeUserProvidedFunction("invokeProcessOnePure", [&ret, &inputSpans, &outputSpans, beginSample, endSample, this] noexcept(HasNoexceptProcessOneFunction<Derived>) {
+                                ret = invokeProcessOnePure(inputSpans, outputSpans, beginSample, endSample);
+                            });
+                            return endSample;
+                        } else { // processOne isn't const i.e. not a pure function w/o side effects -> need to evaluate state after each sample
+                            const auto result = invokeProcessOneNonConst(inputSpans, outputSpans, beginSample, endSample);
+                            ret               = result.status;
+                            return result.processedIn;
+                        }
+                    }
+                };
+
+                if constexpr (kChunkAcrossTags) {
+                    std::size_t beginSample = 0UZ;
+                    while (true) {
+                        std::size_t endSample = processedIn; // next tag position within the chunk (if any)
+                        for_each_port(
+                                [&endSample, beginSample]<PortLike Port>(Port &port) {
+                                    if constexpr (std::remove_cvref_t<Port>::kIsSynch) {
+                                        endSample = std::min(endSample, nSamplesUntilNextTag(port, static_cast<Tag::signed_index_type>(beginSample + 1UZ)).value_or(std::numeric_limits<std::size_t>::max()));
+                                    }
+                                },
+                                inputPorts<PortType::STREAM>(&self()));
+                        const std::size_t processedEnd = processRange(beginSample, endSample);
+                        if (processedEnd != endSample || endSample == processedIn || ret != work::Status::OK || lifecycle::isShuttingDown(this->state())) {
+                            processedIn  = processedEnd;
+                            processedOut = processedEnd;
+                            break;
+                        }
+                        forwardTags();
+                        updateInputAndOutputTagsWithinChunk(endSample);
+                        beginSample = endSample;
                     }
+                } else {
+                    const std::size_t processedEnd = processRange(0UZ, processedIn);
+                    processedIn                    = processedEnd;
+                    processedOut                   = processedEnd;
                 }
             }
         } else { // block does not define any valid processing function
@@ -1609,6 +1869,7 @@ protected:
         }
         // publish/consume
         publishSamples(processedOut, outputSpans);
+        performanceCounters.addSamplesOut(processedOut);
         const auto inputSamplesToConsume = inputSamplesToConsumeAdjustedWithStride(resampledIn);
         bool       success;
         if (inputSamplesToConsume > 0) {
@@ -1625,12 +1886,20 @@ protected:
         return { requested_work, processedIn, success ? ret : work::Status::ERROR };
     } // end: work_return_t workInternal() noexcept { ..}
 
+    work::Result
+    countedWorkInternal(std::size_t requested_work) {
+        const auto         start  = work::PerformanceCounters::now();
+        const work::Result result = workInternal(requested_work);
+        performanceCounters.update(result, start, work::PerformanceCounters::now());
+        return result;
+    }
+
 public:
     work::Status
     invokeWork()
         requires(blockingIO)
     {
-        auto [work_requested, work_done, last_status] = workInternal(std::atomic_load_explicit(&ioRequestedWork, std::memory_order_acquire));
+        auto [work_requested, work_done, last_status] = countedWorkInternal(std::atomic_load_explicit(&ioRequestedWork, std::memory_order_acquire));
         ioWorkDone.increment(work_requested, work_done);
         ioLastWorkStatus.exchange(last_status, std::memory_order_relaxed);
 
@@ -1656,6 +1925,9 @@ public:
             bool expectedThreadState = false;
             if (lifecycle::isActive(this->state()) && this->ioThreadRunning.compare_exchange_strong(expectedThreadState, true, std::memory_order_acq_rel)) {
                 if constexpr (useIoThread) { // use graph-provided ioThreadPool
+                    if (!ioThreadPool) { // stand-alone block -> N.B. not created in the constructor to avoid spawning threads for every block instance
+                        ioThreadPool = std::make_shared<gr::thread_pool::BasicThreadPool>("block_thread_pool", gr::thread_pool::TaskType::IO_BOUND, 2UZ, std::numeric_limits<uint32_t>::max());
+                    }
                     ioThreadPool->execute([this]() {
                         assert(lifecycle::isActive(this->state()));
 
@@ -1693,7 +1965,7 @@ public:
 #endif
             return { accumulatedRequestedWork, performedWork, ioLastWorkStatus.load() };
         } else {
-            return workInternal(requested_work);
+            return countedWorkInternal(requested_work);
         }
     }
 
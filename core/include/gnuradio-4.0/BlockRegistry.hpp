@@ -1,9 +1,11 @@
 #ifndef BLOCK_REGISTRY_HPP
 #define BLOCK_REGISTRY_HPP
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include <gnuradio-4.0/Graph.hpp>
 #include <gnuradio-4.0/meta/utils.hpp>
@@ -13,11 +15,28 @@ namespace gr {
 using namespace std::string_literals;
 using namespace std::string_view_literals;
 
+namespace detail {
+struct StringHash { // enables heterogeneous (i.e. allocation-free) look-ups using std::string_view keys
+    using is_transparent = void;
+
+    [[nodiscard]] std::size_t
+    operator()(std::string_view str) const noexcept {
+        return std::hash<std::string_view>{}(str);
+    }
+};
+
+template<typename TValue>
+using StringMap = std::unordered_map<std::string, TValue, StringHash, std::equal_to<>>;
+} // namespace detail
+
 class BlockRegistry {
+public:
+    using BlockFactory = std::function<std::unique_ptr<gr::BlockModel>(const property_map &)>;
+
 private:
     using block_type_handler = std::function<void(std::unique_ptr<gr::BlockModel> &, const property_map &)>;
-    std::vector<std::string>                                                             _block_types;
-    std::unordered_map<std::string, std::unordered_map<std::string, block_type_handler>> _block_type_handlers;
+    std::vector<std::string>                                 _block_types;
+    detail::StringMap<detail::StringMap<block_type_handler>> _block_type_handlers;
 
     template<typename TBlock>
     static auto
@@ -40,6 +59,15 @@ private:
         return createHandler<TBlock<TBlockParameters...>>();
     }
 
+    [[nodiscard]] const block_type_handler *
+    findHandler(std::string_view name, std::string_view type) const {
+        auto block_it = _block_type_handlers.find(name);
+        if (block_it == _block_type_handlers.end()) return nullptr;
+
+        auto handler_it = block_it->second.find(type);
+        return handler_it == block_it->second.end() ? nullptr : &handler_it->second;
+    }
+
     auto &
     findBlock_type_handlers_map(const std::string &blockType) {
         if (auto it = _block_type_handlers.find(blockType); it != _block_type_handlers.end()) {
@@ -66,17 +94,29 @@ public:
     std::unique_ptr<gr::BlockModel>
     createBlock(std::string_view name, std::string_view type, const property_map &params) {
         std::unique_ptr<gr::BlockModel> result;
-        auto                            block_it = _block_type_handlers.find(std::string(name));
-        if (block_it == _block_type_handlers.end()) return nullptr;
-
-        auto &block_handlers = block_it->second;
-        auto  handler_it     = block_handlers.find(std::string(type));
-        if (handler_it == block_handlers.end()) return nullptr;
-
-        handler_it->second(result, params);
+        if (const block_type_handler *handler = findHandler(name, type)) {
+            (*handler)(result, params);
+        }
         return result;
     }
 
+    /**
+     * @return factory for the given block name and type (empty if unknown) that can be invoked concurrently and w/o repeating the look-up,
+     * N.B. remains valid as long as no block types are added to the registry
+     */
+    [[nodiscard]] BlockFactory
+    blockFactory(std::string_view name, std::string_view type) const {
+        const block_type_handler *handler = findHandler(name, type);
+        if (handler == nullptr) {
+            return {};
+        }
+        return [handler](const property_map &params) {
+            std::unique_ptr<gr::BlockModel> result;
+            (*handler)(result, params);
+            return result;
+        };
+    }
+
     auto
     knownBlocks() const {
         return _block_types;
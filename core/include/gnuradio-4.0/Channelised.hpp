@@ -0,0 +1,177 @@
+#ifndef GNURADIO_CHANNELISED_HPP
+#define GNURADIO_CHANNELISED_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockTraits.hpp>
+#include <gnuradio-4.0/Port.hpp>
+
+namespace gr {
+
+/**
+ * A block can be channelised if it has at least one input, only (non-collection) stream ports, and a `const` `processOne(...)`
+ * without sample offset (i.e. the output depends only on the current input sample(s) and the block's settings).
+ */
+template<typename TBlock>
+concept ChannelisableBlock = traits::block::stream_input_ports<TBlock>::template all_of<traits::port::is_port> and traits::block::stream_output_ports<TBlock>::template all_of<traits::port::is_port>
+                         and traits::block::stream_input_port_types<TBlock>::size() > 0 and not traits::block::can_processOne_with_offset<TBlock>
+                         and requires(const TBlock &block, const traits::block::stream_input_port_types_tuple<TBlock> &inputs) {
+                                 {
+                                     traits::block::detail::can_processOne_invoke_test(block, inputs, std::make_index_sequence<traits::block::stream_input_ports<TBlock>::size()>())
+                                 } -> std::same_as<traits::block::stream_return_type<TBlock>>;
+                             };
+
+template<ChannelisableBlock TBlock, std::size_t nChannels>
+    requires(nChannels > 0UZ)
+class Channelised;
+
+namespace detail {
+template<std::size_t nChannels>
+struct channelised_port {
+    // N.B. drops the port attributes (incl. the reflection descriptor of member-variable ports) -> default buffers and sample limits
+    template<typename TPort>
+    using type = Port<std::array<typename TPort::value_type, nChannels>, TPort::Name, TPort::kPortType, TPort::kDirection>;
+};
+
+template<typename TBlock, std::size_t nChannels>
+struct channelised_base {
+    using ports = meta::concat<typename traits::block::stream_input_ports<TBlock>::template transform<channelised_port<nChannels>::template type>,
+                               typename traits::block::stream_output_ports<TBlock>::template transform<channelised_port<nChannels>::template type>>;
+
+    template<typename... Ports>
+    using block_with_ports = Block<Channelised<TBlock, nChannels>, Ports...>;
+
+    using type = typename ports::template apply<block_with_ports>;
+};
+} // namespace detail
+
+/**
+ * @brief executes 'nChannels' identical instances of a `processOne(...)`-type block as one block whose ports carry one sample of each
+ * channel (i.e. `std::array<T, nChannels>`, channels interleaved). For SIMD-capable blocks, the channels are mapped onto the SIMD lanes
+ * (`meta::simdize<T, kLaneWidth>`, i.e. up to `stdx::simd_abi::max_fixed_size` channels per `processOne(...)` call), otherwise the block
+ * is called per channel.
+ *
+ * This pays the per-block scheduling, `work()`, and tag-handling overhead once for all channels rather than once per channel.
+ * Port names are identical to those of 'TBlock' so that channelised blocks can be connected like the original ones, e.g.:
+ * @code
+ * auto &scale = graph.emplaceBlock<Channelised<Scale<float>, 64>>(); // ports: PortIn<std::array<float, 64>> in, PortOut<...> out
+ * std::ignore = scale.channelBlock().settings().set({ { "factor", 2.f } }); // common settings for all channels
+ * graph.connect<"out">(src).to<"in">(scale); // 'src' produces std::array<float, 64>
+ * @endcode
+ * All channels share the same 'TBlock' instance, its settings, and the stream tags. Staged settings of the channel block are applied
+ * on `start()`. Blocks with per-sample state (non-const `processOne`) cannot be channelised since their state would be shared.
+ */
+template<ChannelisableBlock TBlock, std::size_t nChannels>
+    requires(nChannels > 0UZ)
+class Channelised : public detail::channelised_base<TBlock, nChannels>::type {
+    using base = typename detail::channelised_base<TBlock, nChannels>::type;
+    friend base;
+
+    TBlock _block;
+
+public:
+    using TInputPortTypes = typename traits::block::stream_input_port_types<base>;
+    using TReturnType     = typename traits::block::stream_return_type<base>;
+    using Description     = Doc<R""(@brief executes N identical 'processOne' blocks as one vectorised instance with one SIMD lane per channel)"">;
+
+    static constexpr std::size_t kLaneWidth = std::min(nChannels, static_cast<std::size_t>(stdx::simd_abi::max_fixed_size<double>)); // channels processed per 'processOne' call
+    static constexpr bool        kUseSimdLanes
+            = traits::block::can_processOne_simd<TBlock> and requires(const TBlock &block, const meta::simdize<traits::block::stream_input_port_types_tuple<TBlock>, kLaneWidth> &lanes) {
+                  traits::block::detail::can_processOne_invoke_test(block, lanes, std::make_index_sequence<traits::block::stream_input_ports<TBlock>::size()>());
+              };
+
+    [[nodiscard]] constexpr TBlock &
+    channelBlock() noexcept {
+        return _block;
+    }
+
+    [[nodiscard]] constexpr const TBlock &
+    channelBlock() const noexcept {
+        return _block;
+    }
+
+    [[nodiscard]] static constexpr std::size_t
+    channels() noexcept {
+        return nChannels;
+    }
+
+    void
+    start() {
+        std::ignore = _block.settings().applyStagedParameters();
+        if constexpr (requires(TBlock &block) { block.start(); }) {
+            _block.start();
+        }
+    }
+
+    void
+    stop() {
+        if constexpr (requires(TBlock &block) { block.stop(); }) {
+            _block.stop();
+        }
+    }
+
+    template<typename... Ts>
+        requires(TInputPortTypes::template are_equal<std::remove_cvref_t<Ts>...>)
+    constexpr TReturnType
+    processOne(const Ts &...inputs) const {
+        if constexpr (kUseSimdLanes) {
+            auto processLanes = [&](auto width, std::size_t channel) { // channels [channel, channel + width) in one call
+                return _block.processOne(meta::simdize<typename Ts::value_type, width>(inputs.data() + channel, stdx::element_aligned)...);
+            };
+            if constexpr (std::is_void_v<TReturnType>) {
+                forEachLaneGroup(processLanes);
+            } else {
+                TReturnType outputs;
+                forEachLaneGroup([&](auto width, std::size_t channel) {
+                    if constexpr (traits::block::stream_output_port_types<TBlock>::size == 1) {
+                        processLanes(width, channel).copy_to(outputs.data() + channel, stdx::element_aligned);
+                    } else {
+                        const auto lanes = processLanes(width, channel);
+                        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                            (std::get<Is>(lanes).copy_to(std::get<Is>(outputs).data() + channel, stdx::element_aligned), ...);
+                        }(std::make_index_sequence<std::tuple_size_v<TReturnType>>());
+                    }
+                });
+                return outputs;
+            }
+        } else if constexpr (std::is_void_v<TReturnType>) {
+            for (std::size_t channel = 0UZ; channel < nChannels; ++channel) {
+                _block.processOne(inputs[channel]...);
+            }
+        } else if constexpr (traits::block::stream_output_port_types<TBlock>::size == 1) {
+            TReturnType outputs;
+            for (std::size_t channel = 0UZ; channel < nChannels; ++channel) {
+                outputs[channel] = _block.processOne(inputs[channel]...);
+            }
+            return outputs;
+        } else {
+            TReturnType outputs;
+            for (std::size_t channel = 0UZ; channel < nChannels; ++channel) {
+                const auto result = _block.processOne(inputs[channel]...);
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) { ((std::get<Is>(outputs)[channel] = std::get<Is>(result)), ...); }(std::make_index_sequence<std::tuple_size_v<TReturnType>>());
+            }
+            return outputs;
+        }
+    }
+
+private:
+    static constexpr void
+    forEachLaneGroup(auto &&processLanes) {
+        constexpr std::size_t nRemainder = nChannels % kLaneWidth;
+        for (std::size_t channel = 0UZ; channel + kLaneWidth <= nChannels; channel += kLaneWidth) {
+            processLanes(std::integral_constant<std::size_t, kLaneWidth>{}, channel);
+        }
+        if constexpr (nRemainder > 0UZ) {
+            processLanes(std::integral_constant<std::size_t, nRemainder>{}, nChannels - nRemainder);
+        }
+    }
+};
+
+} // namespace gr
+
+#endif // GNURADIO_CHANNELISED_HPP
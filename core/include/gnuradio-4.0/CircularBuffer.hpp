@@ -98,7 +98,7 @@ class double_mapped_memory_resource : public std::pmr::memory_resource {
         }
         const std::size_t size_half = size/2;
 
-        static std::size_t _counter;
+        static std::atomic_size_t _counter;
         const auto buffer_name = fmt::format("/double_mapped_memory_resource-{}-{}-{}", getpid(), size, _counter++);
         const auto memfd_create = [name = buffer_name.c_str()](unsigned int flags) {
             return syscall(__NR_memfd_create, name, flags);
@@ -121,20 +121,11 @@ class double_mapped_memory_resource : public std::pmr::memory_resource {
             throw std::system_error(errorCode, fmt::format("{} - failed munmap for first half {}: {}",  buffer_name, errno, strerror(errno)));
         }
 
-        // unmap the 2nd half
-        if (munmap(static_cast<char*>(first_copy) + size_half, size_half) == -1) {
-            std::error_code errorCode(errno, std::system_category());
-            close(shm_fd);
-            throw std::system_error(errorCode, fmt::format("{} - failed munmap for second half {}: {}",  buffer_name, errno, strerror(errno)));
-        }
-
-        // Map the first half into the now available hole.
-        // Note that the second_copy_addr mmap argument is only a hint and mmap might place the
-        // mapping somewhere else: "If addr is not NULL, then the kernel takes it as  a hint about
-        // where to place the mapping". The returned pointer therefore must equal second_copy_addr
-        // for our contiguous mapping to work as intended.
+        // Map the first half over the 2nd half of the above mapping.
+        // N.B. MAP_FIXED atomically replaces the pages we already own, i.e. unlike an 'munmap' followed by an address-hinted 'mmap'
+        // there is no window in which a concurrent allocation (e.g. parallel graph construction) could claim the hole.
         void* second_copy_addr = static_cast<char*> (first_copy) + size_half;
-        if (const void* result = mmap(second_copy_addr, size_half, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, static_cast<off_t> (0)); result != second_copy_addr) {
+        if (const void* result = mmap(second_copy_addr, size_half, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, shm_fd, static_cast<off_t> (0)); result != second_copy_addr) {
             std::error_code errorCode(errno, std::system_category());
             close(shm_fd);
             if (result == MAP_FAILED) {
@@ -787,6 +778,11 @@ class CircularBuffer
             const auto last = _buffer->_claimStrategy.getHighestPublishedSequence(_readIndexCached + 1, _buffer->_cursor.value());
             return static_cast<std::size_t>(last - _readIndexCached);
         }
+
+        /// number of not yet consumed samples derived from the shared cursor and read sequences -- may be called from any thread (e.g. for telemetry) but may include claimed, not yet published samples
+        [[nodiscard]] std::size_t nSamplesPending() const noexcept {
+            return static_cast<std::size_t>(std::max(_buffer->_cursor.value() - _readIndex->value(), signed_index_type{ 0 }));
+        }
     }; // class buffer_reader
 
     //static_assert(BufferReader<buffer_reader<T>>);
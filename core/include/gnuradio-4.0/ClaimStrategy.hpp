@@ -76,7 +76,9 @@ public:
             SpinWait     spinWait;
             signed_index_type minSequence;
             while (wrapPoint > (minSequence = detail::getMinimumSequence(dependents, _nextValue))) {
-                if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
+                if constexpr (hasSignalAllWhenBlockingOnCursor<WAIT_STRATEGY>) {
+                    _waitStrategy.signalAllWhenBlocking(_cursor);
+                } else if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
                     _waitStrategy.signalAllWhenBlocking();
                 }
                 spinWait.spinOnce();
@@ -112,7 +114,9 @@ public:
         const auto sequence = offset + static_cast<signed_index_type>(n_slots_to_claim);
         _cursor.setValue(sequence);
         _nextValue = sequence;
-        if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
+        if constexpr (hasSignalAllWhenBlockingOnCursor<WAIT_STRATEGY>) {
+            _waitStrategy.signalAllWhenBlocking(_cursor);
+        } else if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
             _waitStrategy.signalAllWhenBlocking();
         }
     }
@@ -237,7 +241,9 @@ public:
                 signed_index_type gatingSequence = detail::getMinimumSequence(dependents, current);
 
                 if (wrapPoint > gatingSequence) {
-                    if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
+                    if constexpr (hasSignalAllWhenBlockingOnCursor<WAIT_STRATEGY>) {
+                        _waitStrategy.signalAllWhenBlocking(_cursor);
+                    } else if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
                         _waitStrategy.signalAllWhenBlocking();
                     }
                     spinWait.spinOnce();
@@ -282,7 +288,9 @@ public:
         for (std::size_t i = 0; i < n_slots_to_claim; i++) {
             setAvailable(offset + static_cast<signed_index_type>(i) + 1);
         }
-        if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
+        if constexpr (hasSignalAllWhenBlockingOnCursor<WAIT_STRATEGY>) {
+            _waitStrategy.signalAllWhenBlocking(_cursor);
+        } else if constexpr (hasSignalAllWhenBlocking<WAIT_STRATEGY>) {
             _waitStrategy.signalAllWhenBlocking();
         }
     }
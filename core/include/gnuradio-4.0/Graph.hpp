@@ -14,9 +14,13 @@
 #include <complex>
 #include <iostream>
 #include <map>
+#include <queue>
 #include <ranges>
+#include <set>
 #include <tuple>
+#include <unordered_map>
 #include <variant>
+#include <vector>
 
 #if !__has_include(<source_location>)
 #define HAVE_SOURCE_LOCATION 0
@@ -507,6 +511,29 @@ struct PortIndexDefinition {
     constexpr PortIndexDefinition(T _topLevel, std::size_t _subIndex = meta::invalid_index) : topLevel(std::move(_topLevel)), subIndex(_subIndex) {}
 };
 
+/**
+ * sampled buffer occupancy and back-pressure statistics of an Edge, @see Edge::sampleBufferTelemetry()
+ * N.B. stalls and starvations are counted per sample (i.e. nWriterStalls/nSamples is the fraction of time the edge was the back-pressure point)
+ */
+struct EdgeTelemetry {
+    std::string   label;                   // "<source unique name>.<port> -> <destination unique name>.<port>"
+    std::size_t   capacity           = 0UZ; // buffer size [samples]
+    std::size_t   fillLevel          = 0UZ; // last sampled number of pending samples
+    std::size_t   highWaterMark      = 0UZ; // maximum sampled fill level
+    std::uint64_t nSamples           = 0U;  // number of taken samples
+    std::uint64_t nWriterStalls      = 0U;  // samples with less free space than the writer's 'min_samples' (i.e. buffer full)
+    std::uint64_t nReaderStarvations = 0U;  // samples with fewer pending samples than the reader's 'min_samples' (i.e. buffer empty)
+
+    [[nodiscard]] property_map
+    get() const {
+        return { { "capacity", static_cast<std::uint64_t>(capacity) },                //
+                 { "fill_level", static_cast<std::uint64_t>(fillLevel) },              //
+                 { "high_water_mark", static_cast<std::uint64_t>(highWaterMark) },     //
+                 { "samples", nSamples }, { "writer_stalls", nWriterStalls },          //
+                 { "reader_starvations", nReaderStarvations } };
+    }
+};
+
 class Edge {
 public: // TODO: consider making this private and to use accessors (that can be safely used by users)
     using PortDirection::INPUT;
@@ -519,6 +546,10 @@ public: // TODO: consider making this private and to use accessors (that can be
     std::int32_t                     _weight;
     std::string                      _name; // custom edge name
     bool                             _connected;
+    EdgeTelemetry                    _telemetry{};
+    DynamicPort                     *_telemetrySourcePort      = nullptr; // lazily resolved by sampleBufferTelemetry()
+    DynamicPort                     *_telemetryDestinationPort = nullptr;
+    bool                             _telemetryUnavailable     = false;
 
 public:
     Edge() = delete;
@@ -584,6 +615,48 @@ public:
     is_connected() const noexcept {
         return _connected;
     }
+
+    [[nodiscard]] constexpr const EdgeTelemetry &
+    bufferTelemetry() const noexcept {
+        return _telemetry;
+    }
+
+    /**
+     * samples the edge's buffer occupancy from the shared writer/reader sequences, i.e. w/o touching the blocks' hot path
+     * N.B. to be called periodically from a single (e.g. scheduler) thread, edges w/o stream buffer (e.g. message ports) are ignored
+     * @return true if the edge could be sampled
+     */
+    bool
+    sampleBufferTelemetry() noexcept {
+        if (_telemetryUnavailable) {
+            return false;
+        }
+        if (_telemetryDestinationPort == nullptr) {
+            try {
+                _telemetrySourcePort      = &_sourceBlock->dynamicOutputPort(_sourcePortDefinition.topLevel, _sourcePortDefinition.subIndex);
+                _telemetryDestinationPort = &_destinationBlock->dynamicInputPort(_destinationPortDefinition.topLevel, _destinationPortDefinition.subIndex);
+                _telemetry.label          = fmt::format("{}.{} -> {}.{}", _sourceBlock->uniqueName(), _telemetrySourcePort->name, _destinationBlock->uniqueName(), _telemetryDestinationPort->name);
+            } catch (...) {
+                _telemetryUnavailable = true;
+                return false;
+            }
+        }
+        const auto [capacity, fillLevel] = _telemetryDestinationPort->bufferOccupancy();
+        if (capacity == 0UZ) {
+            return false;
+        }
+        _telemetry.capacity      = capacity;
+        _telemetry.fillLevel     = std::min(fillLevel, capacity);
+        _telemetry.highWaterMark = std::max(_telemetry.highWaterMark, _telemetry.fillLevel);
+        _telemetry.nSamples++;
+        if (capacity - _telemetry.fillLevel < std::clamp(_telemetrySourcePort->min_samples, 1UZ, capacity)) {
+            _telemetry.nWriterStalls++;
+        }
+        if (_telemetry.fillLevel < std::clamp(_telemetryDestinationPort->min_samples, 1UZ, capacity)) {
+            _telemetry.nReaderStarvations++;
+        }
+        return true;
+    }
 };
 
 class Graph : public gr::Block<Graph> {
@@ -887,6 +960,117 @@ public:
                        edgeName);
     }
 
+    /**
+     * disconnects and removes the edge between the given ports. The destination's input port falls back to its own (unconnected)
+     * buffer, while the reader on the source buffer is released so that the source no longer waits on it.
+     * N.B. not thread-safe w.r.t. executing blocks: releasing the reader swaps the reader list of the source buffer, which its writer
+     * iterates without a snapshot -- use the scheduler's 'removeEdge(...)', which parks the source and destination, for running graphs
+     * @return true if such an edge existed
+     */
+    template<typename Source, typename Destination>
+        requires(!std::is_pointer_v<std::remove_cvref_t<Source>> && !std::is_pointer_v<std::remove_cvref_t<Destination>>)
+    bool
+    removeEdge(Source &sourceBlockRaw, PortIndexDefinition<std::size_t> sourcePortDefinition, Destination &destinationBlockRaw, PortIndexDefinition<std::size_t> destinationPortDefinition) {
+        const BlockModel *sourceBlock      = findBlock(sourceBlockRaw).get();
+        const BlockModel *destinationBlock = findBlock(destinationBlockRaw).get();
+        const auto        it               = std::ranges::find_if(_edges, [&](const Edge &edge) {
+            return edge._sourceBlock == sourceBlock && edge._destinationBlock == destinationBlock                                                               //
+                && edge._sourcePortDefinition.topLevel == sourcePortDefinition.topLevel && edge._sourcePortDefinition.subIndex == sourcePortDefinition.subIndex //
+                && edge._destinationPortDefinition.topLevel == destinationPortDefinition.topLevel && edge._destinationPortDefinition.subIndex == destinationPortDefinition.subIndex;
+        });
+        if (it == _edges.end()) {
+            return false;
+        }
+        std::ignore = it->_destinationBlock->dynamicInputPort(destinationPortDefinition.topLevel, destinationPortDefinition.subIndex).disconnect();
+        _edges.erase(it);
+        return true;
+    }
+
+    template<typename Source, typename Destination>
+        requires(!std::is_pointer_v<std::remove_cvref_t<Source>> && !std::is_pointer_v<std::remove_cvref_t<Destination>>)
+    bool
+    removeEdge(Source &sourceBlockRaw, PortIndexDefinition<std::string> sourcePortDefinition, Destination &destinationBlockRaw, PortIndexDefinition<std::string> destinationPortDefinition) {
+        auto sourcePortIndex      = this->findBlock(sourceBlockRaw)->dynamicOutputPortIndex(sourcePortDefinition.topLevel);
+        auto destinationPortIndex = this->findBlock(destinationBlockRaw)->dynamicInputPortIndex(destinationPortDefinition.topLevel);
+        return removeEdge(sourceBlockRaw, { sourcePortIndex, sourcePortDefinition.subIndex }, destinationBlockRaw, { destinationPortIndex, destinationPortDefinition.subIndex });
+    }
+
+    /**
+     * removes (and destroys) the block together with all its edges. Input ports that were fed by the block fall back to their own
+     * (unconnected) buffers, readers of the block's inputs are released from the upstream buffers.
+     * N.B. not thread-safe w.r.t. executing blocks: the upstream writers iterate their reader lists without a snapshot -- use the
+     * scheduler's 'removeBlock(...)', which parks the block, its upstream sources and downstream destinations, for running graphs
+     */
+    template<typename TBlock>
+        requires(!std::is_pointer_v<std::remove_cvref_t<TBlock>>)
+    void
+    removeBlock(TBlock &blockRaw) {
+        const BlockModel *block = findBlock(blockRaw).get();
+        for (Edge &edge : _edges) {
+            if (edge._sourceBlock == block && edge._destinationBlock != block) {
+                std::ignore = edge._destinationBlock->dynamicInputPort(edge._destinationPortDefinition.topLevel, edge._destinationPortDefinition.subIndex).disconnect();
+            }
+        }
+        std::erase_if(_edges, [block](const Edge &edge) { return edge._sourceBlock == block || edge._destinationBlock == block; });
+        std::erase_if(_blocks, [block](const auto &blockPtr) { return blockPtr.get() == block; });
+    }
+
+    struct BlockConnection { // connection between two blocks that are already owned by this graph (see 'connectAll(...)')
+        BlockModel                      *source;
+        PortIndexDefinition<std::size_t> sourcePort;
+        BlockModel                      *destination;
+        PortIndexDefinition<std::size_t> destinationPort;
+        std::size_t                      minBufferSize = 65536UZ;
+        std::int32_t                     weight        = 0;
+        std::string                      name          = "unnamed edge";
+    };
+
+    /**
+     * establishes a batch of connections between blocks owned by this graph (N.B. unlike 'connect(...)' w/o the linear ownership look-up).
+     * If a 'pool' is provided, the port connections (i.e. reader registrations on the source buffers) are performed in parallel, with the
+     * tasks being partitioned by destination block so that every input port is only modified by a single thread.
+     * The edges are recorded in the order of 'connections' independent of the execution order.
+     * @return the result of each connection
+     */
+    std::vector<ConnectionResult>
+    connectAll(std::span<const BlockConnection> connections, thread_pool::BasicThreadPool *pool = nullptr) {
+        std::vector<ConnectionResult> results(connections.size(), ConnectionResult::FAILED);
+        auto                          connectOne = [&connections, &results](std::size_t index) {
+            const BlockConnection &connection      = connections[index];
+            DynamicPort           &sourcePort      = connection.source->dynamicOutputPort(connection.sourcePort.topLevel, connection.sourcePort.subIndex);
+            DynamicPort           &destinationPort = connection.destination->dynamicInputPort(connection.destinationPort.topLevel, connection.destinationPort.subIndex);
+            results[index]                         = sourcePort.connect(destinationPort);
+        };
+
+        if (pool == nullptr) {
+            for (std::size_t index = 0UZ; index < connections.size(); ++index) {
+                connectOne(index);
+            }
+        } else {
+            std::unordered_map<const BlockModel *, std::size_t> groupOfDestination;
+            std::vector<std::vector<std::size_t>>               groups;
+            for (std::size_t index = 0UZ; index < connections.size(); ++index) {
+                connections[index].source->initDynamicPorts(); // N.B. lazy port initialisation is not thread-safe
+                connections[index].destination->initDynamicPorts();
+                auto [it, inserted] = groupOfDestination.try_emplace(connections[index].destination, groups.size());
+                if (inserted) {
+                    groups.emplace_back();
+                }
+                groups[it->second].push_back(index);
+            }
+            thread_pool::parallelFor(*pool, groups.size(), [&groups, &connectOne](std::size_t group) { std::ranges::for_each(groups[group], connectOne); });
+        }
+
+        _edges.reserve(_edges.size() + connections.size());
+        for (std::size_t index = 0UZ; index < connections.size(); ++index) {
+            if (results[index] == ConnectionResult::SUCCESS) {
+                const BlockConnection &connection = connections[index];
+                _edges.emplace_back(connection.source, connection.sourcePort, connection.destination, connection.destinationPort, connection.minBufferSize, connection.weight, connection.name);
+            }
+        }
+        return results;
+    }
+
     template<typename Anything>
     void
     processMessages(MsgPortInNamed<"__FromChildren"> & /*port*/, std::span<const Anything> /*input*/) {
@@ -918,6 +1102,51 @@ public:
 
 static_assert(BlockLike<Graph>);
 
+/**
+ * @return the blocks reachable from the graph's source blocks (i.e. blocks with outgoing but w/o incoming edges) in breadth-first order
+ * N.B. blocks without edges are not included
+ */
+[[nodiscard]] inline std::vector<BlockModel *>
+breadthFirstOrder(const Graph &graph) {
+    using block_t = BlockModel *;
+    // compute the adjacency list
+    std::map<block_t, std::vector<block_t>> adjacencyList{};
+    std::vector<block_t>                    sourceBlocks{};
+    std::set<block_t>                       blockReached;
+    graph.forEachEdge([&](const Edge &e) {
+        adjacencyList[e._sourceBlock].push_back(e._destinationBlock);
+        sourceBlocks.push_back(e._sourceBlock);
+        blockReached.insert(e._destinationBlock);
+    });
+    sourceBlocks.erase(std::remove_if(sourceBlocks.begin(), sourceBlocks.end(), [&blockReached](auto currentBlock) { return blockReached.contains(currentBlock); }), sourceBlocks.end());
+    // traverse graph
+    std::vector<block_t> blocklist;
+    std::queue<block_t>  queue{};
+    std::set<block_t>    reached;
+    // add all source blocks to queue
+    for (block_t sourceBlock : sourceBlocks) {
+        if (!reached.contains(sourceBlock)) {
+            queue.push(sourceBlock);
+        }
+        reached.insert(sourceBlock);
+    }
+    // process all blocks, adding all unvisited child blocks to the queue
+    while (!queue.empty()) {
+        block_t currentBlock = queue.front();
+        queue.pop();
+        blocklist.push_back(currentBlock);
+        if (adjacencyList.contains(currentBlock)) { // node has outgoing edges
+            for (auto &dst : adjacencyList.at(currentBlock)) {
+                if (!reached.contains(dst)) { // detect cycles. this could be removed if we guarantee cycle free graphs earlier
+                    queue.push(dst);
+                    reached.insert(dst);
+                }
+            }
+        }
+    }
+    return blocklist;
+}
+
 /*******************************************************************************************************/
 /**************************** begin of SIMD-Merged Graph Implementation ********************************/
 /*******************************************************************************************************/
@@ -0,0 +1,385 @@
+#ifndef GNURADIO_GRAPH_IMAGE_HPP
+#define GNURADIO_GRAPH_IMAGE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#if defined __has_include && not __EMSCRIPTEN__
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<unistd.h>)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HAS_POSIX_MAP_INTERFACE
+#endif
+#endif
+
+#include <gnuradio-4.0/BinarySerialiser.hpp>
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Graph_yaml_importer.hpp>
+#include <gnuradio-4.0/PluginLoader.hpp>
+
+namespace gr {
+
+/**
+ * @brief binary 'graph image', i.e. a pre-resolved cache of a (YAML-authored) flow-graph that can be loaded w/o YAML parsing
+ * and w/o the per-setting type conversions of 'load_grc(...)'.
+ *
+ * Layout (native byte order, see 'gr::serialiser' for the var-int and map encodings):
+ *  - header: magic 'GRIM' (u32), format version (u32), hash of the YAML source the image has been generated from (u64), hash of
+ *    the block set known to the plugin loader at that time (u64)
+ *  - blocks: var-int count, followed per block by id, type parameter(s), name, the explicitly set settings (map) and the
+ *    meta-information (map). The blocks are stored in execution order, i.e. breadth-first from the source blocks followed by
+ *    the unconnected blocks. The schedulers derive their per-thread job lists from this order.
+ *  - edges: var-int count, followed per edge by the source block index, port index and sub-index, the destination block index,
+ *    port index and sub-index, the minimum buffer size, the (signed) weight, and the edge name
+ *
+ * YAML remains the authoring format: 'load_grc_cached(...)' transparently (re-)generates the image whenever the hash of the
+ * YAML source or of the known block set changes.
+ */
+namespace detail {
+inline constexpr std::uint32_t kGraphImageMagic   = 0x4D495247U; // "GRIM"
+inline constexpr std::uint32_t kGraphImageVersion = 2U;
+
+struct GraphImageHeader {
+    std::uint32_t magic      = 0U;
+    std::uint32_t version    = 0U;
+    std::uint64_t sourceHash   = 0U;
+    std::uint64_t blockSetHash = 0U;
+};
+
+inline constexpr std::size_t kMinBlockImageBytes = 5UZ; // id, type parameter(s), name (var-int length each), settings and meta-information (var-int count each)
+inline constexpr std::size_t kMinEdgeImageBytes  = 9UZ; // 8 var-ints, edge name (var-int length)
+
+[[nodiscard]] inline GraphImageHeader
+readGraphImageHeader(serialiser::BinaryReader &reader) {
+    GraphImageHeader header;
+    header.magic   = reader.read<std::uint32_t>();
+    header.version = reader.read<std::uint32_t>();
+    if (header.magic != kGraphImageMagic) {
+        throw fmt::format("Invalid graph image (magic {:#010x})", header.magic);
+    }
+    if (header.version != kGraphImageVersion) {
+        throw fmt::format("Unsupported graph image version {} (expected {})", header.version, kGraphImageVersion);
+    }
+    header.sourceHash   = reader.read<std::uint64_t>();
+    header.blockSetHash = reader.read<std::uint64_t>();
+    return header;
+}
+
+[[nodiscard]] inline std::string
+blockTypeParameters(std::string_view typeName) { // e.g. "builtin_counter<double>" -> "double"
+    const auto first = typeName.find('<');
+    const auto last  = typeName.rfind('>');
+    if (first == std::string_view::npos || last == std::string_view::npos || last <= first) {
+        return "double"; // N.B. same default as 'load_grc(...)'
+    }
+    std::string result;
+    for (char c : typeName.substr(first + 1UZ, last - first - 1UZ)) {
+        if (c != ' ') {
+            result.push_back(c);
+        }
+    }
+    return result;
+}
+
+#ifdef HAS_POSIX_MAP_INTERFACE
+class MappedFile { // read-only mapping of a whole file, invalid if the file does not exist or is empty
+    void       *_data = MAP_FAILED;
+    std::size_t _size = 0UZ;
+
+public:
+    explicit MappedFile(const std::filesystem::path &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return;
+        }
+        struct stat fileStatus {};
+        if (::fstat(fd, &fileStatus) == 0 && fileStatus.st_size > 0) {
+            _size = static_cast<std::size_t>(fileStatus.st_size);
+            _data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        ::close(fd); // N.B. the mapping remains valid
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &
+    operator=(const MappedFile &)
+            = delete;
+
+    ~MappedFile() {
+        if (valid()) {
+            ::munmap(_data, _size);
+        }
+    }
+
+    [[nodiscard]] bool
+    valid() const noexcept {
+        return _data != MAP_FAILED;
+    }
+
+    [[nodiscard]] std::span<const std::uint8_t>
+    data() const noexcept {
+        return valid() ? std::span<const std::uint8_t>(static_cast<const std::uint8_t *>(_data), _size) : std::span<const std::uint8_t>{};
+    }
+};
+#else
+class MappedFile { // fallback: reads the whole file
+    std::vector<std::uint8_t> _data;
+
+public:
+    explicit MappedFile(const std::filesystem::path &path) {
+        std::ifstream file(path, std::ios::binary);
+        _data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    [[nodiscard]] bool
+    valid() const noexcept {
+        return !_data.empty();
+    }
+
+    [[nodiscard]] std::span<const std::uint8_t>
+    data() const noexcept {
+        return _data;
+    }
+};
+#endif
+} // namespace detail
+
+/**
+ * @return FNV-1a hash of the (YAML) graph source, used to detect stale graph images
+ */
+[[nodiscard]] constexpr std::uint64_t
+graph_source_hash(std::string_view source) noexcept {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (char c : source) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/**
+ * @return hash of the (sorted) names of the blocks known to 'loader', used to detect graph images that have been generated with a
+ * different set of registered blocks or plugins
+ */
+[[nodiscard]] inline std::uint64_t
+graph_block_set_hash(const PluginLoader &loader) {
+    auto blockNames = loader.knownBlocks();
+    std::ranges::sort(blockNames);
+    std::string joined;
+    for (const auto &name : blockNames) {
+        joined.append(name).push_back('\n');
+    }
+    return graph_source_hash(joined);
+}
+
+/**
+ * @return the binary graph image of 'graph' (see above), 'sourceHash' identifies the YAML source the graph has been loaded from and
+ * 'blockSetHash' the blocks known at that time (see 'graph_block_set_hash(...)')
+ */
+[[nodiscard]] inline std::vector<std::uint8_t>
+save_graph_image(const gr::Graph &graph, std::uint64_t sourceHash = 0U, std::uint64_t blockSetHash = 0U) {
+    const auto                                          breadthFirst = breadthFirstOrder(graph);
+    std::vector<const BlockModel *>                     executionOrder(breadthFirst.begin(), breadthFirst.end());
+    std::unordered_map<const BlockModel *, std::size_t> indexOfBlock;
+    for (std::size_t index = 0UZ; index < executionOrder.size(); ++index) {
+        indexOfBlock.emplace(executionOrder[index], index);
+    }
+    graph.forEachBlock([&](const BlockModel &block) {
+        if (indexOfBlock.try_emplace(&block, executionOrder.size()).second) { // unconnected block
+            executionOrder.push_back(&block);
+        }
+    });
+
+    serialiser::BinaryWriter writer(serialiser::KeyEncoding::Interned, 4096UZ);
+    writer.write<std::uint32_t>(detail::kGraphImageMagic);
+    writer.write<std::uint32_t>(detail::kGraphImageVersion);
+    writer.write<std::uint64_t>(sourceHash);
+    writer.write<std::uint64_t>(blockSetHash);
+
+    writer.writeVarInt(executionOrder.size());
+    for (const BlockModel *block : executionOrder) {
+        const auto   &typeName   = block->typeName();
+        const auto    id         = std::string_view(typeName).substr(0UZ, typeName.find('<'));
+        SettingsBase &settings   = block->settings();
+        const auto   &autoUpdate = settings.autoUpdateParameters();
+        property_map  explicitSettings;
+        for (auto &[key, value] : settings.get()) {
+            if (!autoUpdate.contains(key)) { // N.B. not-yet set parameters keep their default and auto-update behaviour
+                explicitSettings.insert_or_assign(key, std::move(value));
+            }
+        }
+        for (const auto &[key, value] : settings.stagedParameters()) {
+            explicitSettings.insert_or_assign(key, value);
+        }
+
+        writer.writeString(id);
+        writer.writeString(detail::blockTypeParameters(typeName));
+        writer.writeString(block->name());
+        serialiser::encode(writer, explicitSettings);
+        serialiser::encode(writer, block->metaInformation());
+    }
+
+    std::vector<const Edge *> edges;
+    graph.forEachEdge([&edges](const Edge &edge) { edges.push_back(&edge); });
+    writer.writeVarInt(edges.size());
+    for (const Edge *edge : edges) {
+        writer.writeVarInt(indexOfBlock.at(edge->_sourceBlock));
+        writer.writeVarInt(edge->sourcePortDefinition().topLevel);
+        writer.writeVarInt(edge->sourcePortDefinition().subIndex);
+        writer.writeVarInt(indexOfBlock.at(edge->_destinationBlock));
+        writer.writeVarInt(edge->destinationPortDefinition().topLevel);
+        writer.writeVarInt(edge->destinationPortDefinition().subIndex);
+        writer.writeVarInt(edge->minBufferSize());
+        writer.writeSignedVarInt(edge->weight());
+        writer.writeString(edge->name());
+    }
+    return writer.release();
+}
+
+/**
+ * loads a graph from its binary image in a single linear pass, followed by the (parallel) construction and connection phases
+ * of 'load_grc(...)'. The blocks are added to the graph in the stored execution order.
+ */
+inline gr::Graph
+load_graph_image(PluginLoader &loader, std::span<const std::uint8_t> image, GraphLoadStats *stats = nullptr) {
+    detail::LoadPhaseTimer   timer(stats);
+    Graph                    graph;
+    serialiser::BinaryReader reader(image);
+    std::ignore = detail::readGraphImageHeader(reader);
+
+    struct EdgeDefinition {
+        std::size_t                      sourceIndex;
+        PortIndexDefinition<std::size_t> sourcePort;
+        std::size_t                      destinationIndex;
+        PortIndexDefinition<std::size_t> destinationPort;
+        std::size_t                      minBufferSize;
+        std::int32_t                     weight;
+        std::string                      name;
+    };
+
+    const auto                           nBlocks = reader.readCount(detail::kMinBlockImageBytes); // N.B. validated before reserving
+    std::vector<detail::BlockDefinition> blockDefinitions;
+    std::vector<property_map>            blockSettings;
+    std::vector<property_map>            blockMetaInformation;
+    blockDefinitions.reserve(nBlocks);
+    blockSettings.reserve(nBlocks);
+    blockMetaInformation.reserve(nBlocks);
+    for (std::size_t index = 0UZ; index < nBlocks; ++index) {
+        auto id   = reader.readString();
+        auto type = reader.readString();
+        auto name = reader.readString();
+        blockDefinitions.push_back({ .name = std::move(name), .id = std::move(id), .type = std::move(type) });
+        blockSettings.push_back(serialiser::decodeMap(reader));
+        blockMetaInformation.push_back(serialiser::decodeMap(reader));
+    }
+
+    const auto                  nEdges = reader.readCount(detail::kMinEdgeImageBytes);
+    std::vector<EdgeDefinition> edgeDefinitions;
+    edgeDefinitions.reserve(nEdges);
+    for (std::size_t index = 0UZ; index < nEdges; ++index) {
+        const auto sourceIndex         = static_cast<std::size_t>(reader.readVarInt());
+        const auto sourceTopLevel      = static_cast<std::size_t>(reader.readVarInt());
+        const auto sourceSubIndex      = static_cast<std::size_t>(reader.readVarInt());
+        const auto destinationIndex    = static_cast<std::size_t>(reader.readVarInt());
+        const auto destinationTopLevel = static_cast<std::size_t>(reader.readVarInt());
+        const auto destinationSubIndex = static_cast<std::size_t>(reader.readVarInt());
+        const auto minBufferSize       = static_cast<std::size_t>(reader.readVarInt());
+        const auto weight              = static_cast<std::int32_t>(reader.readSignedVarInt());
+        auto       name                = reader.readString();
+        if (sourceIndex >= nBlocks || destinationIndex >= nBlocks) {
+            throw fmt::format("Invalid graph image: edge '{}' refers to block {}/{} of {}", name, sourceIndex, destinationIndex, nBlocks);
+        }
+        edgeDefinitions.push_back({ sourceIndex, { sourceTopLevel, sourceSubIndex }, destinationIndex, { destinationTopLevel, destinationSubIndex }, minBufferSize, weight, std::move(name) });
+    }
+    timer.endPhase(&GraphLoadStats::parse);
+
+    auto       pool   = detail::makeLoadPool(nBlocks);
+    const auto blocks = detail::instantiateBlocks(loader, graph, blockDefinitions, pool.get(), timer, [&](std::size_t index, BlockModel &block) {
+        std::ignore = block.settings().set(blockSettings[index]);
+        for (auto &[key, value] : blockMetaInformation[index]) {
+            block.metaInformation().insert_or_assign(key, std::move(value));
+        }
+    });
+
+    std::vector<Graph::BlockConnection> connections;
+    connections.reserve(edgeDefinitions.size());
+    for (auto &edge : edgeDefinitions) {
+        connections.push_back({ .source          = blocks[edge.sourceIndex],
+                                .sourcePort      = edge.sourcePort,
+                                .destination     = blocks[edge.destinationIndex],
+                                .destinationPort = edge.destinationPort,
+                                .minBufferSize   = edge.minBufferSize,
+                                .weight          = edge.weight,
+                                .name            = std::move(edge.name) });
+    }
+    std::ignore = graph.connectAll(connections, pool.get());
+    timer.endPhase(&GraphLoadStats::connect);
+
+    detail::updateLoadStats(stats, graph, pool.get());
+    if (stats != nullptr) {
+        stats->fromImage = true;
+    }
+    return graph;
+}
+
+/**
+ * loads the YAML 'yaml_source' using the graph image at 'imagePath' as a cache: the image is used if it has been generated from the
+ * same YAML source and block set (see 'graph_source_hash(...)' and 'graph_block_set_hash(...)'), otherwise (or if it cannot be loaded) the graph is loaded from YAML and the image is
+ * (re-)written. N.B. the image is first written to a temporary file and then renamed so that concurrent readers never see a partial image.
+ */
+inline gr::Graph
+load_grc_cached(PluginLoader &loader, const std::string &yaml_source, const std::filesystem::path &imagePath, GraphLoadStats *stats = nullptr) {
+    const std::uint64_t sourceHash   = graph_source_hash(yaml_source);
+    const std::uint64_t blockSetHash = graph_block_set_hash(loader);
+    {
+        const detail::MappedFile image(imagePath);
+        if (image.valid()) {
+            try {
+                serialiser::BinaryReader reader(image.data());
+                if (const auto header = detail::readGraphImageHeader(reader); header.sourceHash == sourceHash && header.blockSetHash == blockSetHash) {
+                    return load_graph_image(loader, image.data(), stats);
+                }
+            } catch (...) {
+                // stale, incompatible or corrupt image -> regenerate from YAML
+            }
+        }
+    }
+
+    if (stats != nullptr) {
+        *stats = GraphLoadStats{};
+    }
+    Graph      graph     = load_grc(loader, yaml_source, stats);
+    const auto imageData = save_graph_image(graph, sourceHash, blockSetHash);
+
+    const std::filesystem::path temporaryPath = detail::temporaryPathFor(imagePath); // N.B. unique per process and call
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(imageData.data()), static_cast<std::streamsize>(imageData.size()));
+        if (!file) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(temporaryPath, ec);
+            return graph; // N.B. the image is only a cache -> not being able to write it is not an error
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporaryPath, imagePath, ec);
+    if (ec) {
+        std::filesystem::remove(temporaryPath, ec);
+    }
+    return graph;
+}
+
+} // namespace gr
+
+#endif // GNURADIO_GRAPH_IMAGE_HPP
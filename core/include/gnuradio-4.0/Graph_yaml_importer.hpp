@@ -2,6 +2,8 @@
 #define GNURADIO_GRAPH_YAML_IMPORTER_H
 
 #include <charconv>
+#include <chrono>
+#include <map>
 
 #ifdef __GNUC__
 #pragma GCC diagnostic push
@@ -92,142 +94,315 @@ parseIndex(std::string_view str) {
 
 } // namespace detail
 
-inline gr::Graph
-load_grc(PluginLoader &loader, const std::string &yaml_source) {
-    Graph testGraph;
-
-    std::map<std::string, BlockModel *> createdBlocks;
-
-    YAML::Node tree   = YAML::Load(yaml_source);
-    auto       blocks = tree["blocks"];
-    for (const auto &grc_block : blocks) {
-        auto name = grc_block["name"].as<std::string>();
-        auto id   = grc_block["id"].as<std::string>();
-
-        // TODO: Discuss how GRC should store the node types, how we should
-        // in general handle nodes that are parametrised by more than one type
-        auto currentBlock = loader.instantiate(id, "double");
-        if (!currentBlock) {
-            throw fmt::format("Unable to create block of type '{}'", id);
-        }
+/**
+ * wall-clock durations of the 'load_grc(...)' phases, e.g. to monitor the (re-)start time of large flow-graphs
+ */
+struct GraphLoadStats {
+    std::chrono::nanoseconds parse{};     // YAML parsing or graph image decoding
+    std::chrono::nanoseconds resolve{};   // block factory look-up (once per distinct block id)
+    std::chrono::nanoseconds construct{}; // block construction (incl. port buffer allocation) and settings conversion
+    std::chrono::nanoseconds add{};       // transfer of the block ownership to the graph
+    std::chrono::nanoseconds connect{};   // port connections and edge book-keeping
+    std::size_t              nBlocks   = 0UZ;
+    std::size_t              nEdges    = 0UZ;
+    std::size_t              nThreads  = 1UZ;   // number of tasks used for the parallel phases
+    bool                     fromImage = false; // graph has been loaded from a binary graph image rather than YAML
+
+    [[nodiscard]] std::chrono::nanoseconds
+    total() const noexcept {
+        return parse + resolve + construct + add + connect;
+    }
+};
 
-        currentBlock->setName(name);
-        property_map new_properties;
+namespace detail {
 
-        auto parameters = grc_block["parameters"];
-        if (parameters && parameters.IsMap()) {
-            // TODO this applyStagedParameters is a workaround to make sure that currentBlock_settings is not empty
-            // but contains the default values of the block (needed to covert the parameter values to the right type)
-            // should this be based on metadata/reflection?
-            std::ignore                = currentBlock->settings().applyStagedParameters();
-            auto currentBlock_settings = currentBlock->settings().get();
-            for (const auto &kv : parameters) {
-                const auto &key = kv.first.as<std::string>();
-
-                if (auto it = currentBlock_settings.find(key); it != currentBlock_settings.end()) {
-                    using variant_type_list     = meta::to_typelist<pmtv::pmt>;
-                    const YAML::Node &grc_value = kv.second;
-
-                    // This is a known property of this node
-                    auto try_type = [&]<typename T>() {
-                        if (it->second.index() == variant_type_list::index_of<T>()) {
-                            const auto &value   = grc_value.template as<T>();
-                            new_properties[key] = value;
-                            return true;
-                        }
+inline constexpr std::size_t kParallelLoadMinBlocks = 32UZ; // smaller graphs are loaded in the calling thread
+
+inline void
+applyGrcParameters(BlockModel &block, const YAML::Node &parameters) {
+    property_map new_properties;
+
+    if (parameters && parameters.IsMap()) {
+        // TODO this applyStagedParameters is a workaround to make sure that currentBlock_settings is not empty
+        // but contains the default values of the block (needed to covert the parameter values to the right type)
+        // should this be based on metadata/reflection?
+        std::ignore                = block.settings().applyStagedParameters();
+        auto currentBlock_settings = block.settings().get();
+        for (const auto &kv : parameters) {
+            const auto &key = kv.first.as<std::string>();
+
+            if (auto it = currentBlock_settings.find(key); it != currentBlock_settings.end()) {
+                using variant_type_list     = meta::to_typelist<pmtv::pmt>;
+                const YAML::Node &grc_value = kv.second;
+
+                // This is a known property of this node
+                auto try_type = [&]<typename T>() {
+                    if (it->second.index() == variant_type_list::index_of<T>()) {
+                        const auto &value   = grc_value.template as<T>();
+                        new_properties[key] = value;
+                        return true;
+                    }
 
-                        if (it->second.index() == variant_type_list::index_of<std::vector<T>>()) {
+                    if (it->second.index() == variant_type_list::index_of<std::vector<T>>()) {
 #if (defined __clang__) && (!defined __EMSCRIPTEN__)
-                            if constexpr (std::is_same_v<T, bool>) {
-                                // gcc-stdlibc++/clang-libc++ have different implementations for std::vector<bool>
-                                // see https://en.cppreference.com/w/cpp/container/vector_bool for details
-                                const auto       &value = grc_value.template as<std::vector<int>>(); // need intermediary vector
-                                std::vector<bool> boolVector;
-                                for (int intValue : value) {
-                                    boolVector.push_back(intValue != 0);
-                                }
-                                new_properties[key] = boolVector;
-                                return true;
+                        if constexpr (std::is_same_v<T, bool>) {
+                            // gcc-stdlibc++/clang-libc++ have different implementations for std::vector<bool>
+                            // see https://en.cppreference.com/w/cpp/container/vector_bool for details
+                            const auto       &value = grc_value.template as<std::vector<int>>(); // need intermediary vector
+                            std::vector<bool> boolVector;
+                            for (int intValue : value) {
+                                boolVector.push_back(intValue != 0);
                             }
-#endif
-                            const auto &value   = grc_value.template as<std::vector<T>>();
-                            new_properties[key] = value;
+                            new_properties[key] = boolVector;
                             return true;
                         }
-
-                        return false;
-                    };
-
-                    // clang-format off
-                    try_type.operator()<std::int8_t>() ||
-                    try_type.operator()<std::int16_t>() ||
-                    try_type.operator()<std::int32_t>() ||
-                    try_type.operator()<std::int64_t>() ||
-                    try_type.operator()<std::uint8_t>() ||
-                    try_type.operator()<std::uint16_t>() ||
-                    try_type.operator()<std::uint32_t>() ||
-                    try_type.operator()<std::uint64_t>() ||
-                    try_type.operator()<bool>() ||
-                    try_type.operator()<float>() ||
-                    try_type.operator()<double>() ||
-                    try_type.operator()<std::string>() ||
-                    [&] {
-                        // Fallback to string, and non-defined property
-                        const auto& value = grc_value.template as<std::string>();
-                        currentBlock->metaInformation()[key] = value;
+#endif
+                        const auto &value   = grc_value.template as<std::vector<T>>();
+                        new_properties[key] = value;
                         return true;
-                    }();
-                    // clang-format on
+                    }
+
+                    return false;
+                };
+
+                // clang-format off
+                try_type.operator()<std::int8_t>() ||
+                try_type.operator()<std::int16_t>() ||
+                try_type.operator()<std::int32_t>() ||
+                try_type.operator()<std::int64_t>() ||
+                try_type.operator()<std::uint8_t>() ||
+                try_type.operator()<std::uint16_t>() ||
+                try_type.operator()<std::uint32_t>() ||
+                try_type.operator()<std::uint64_t>() ||
+                try_type.operator()<bool>() ||
+                try_type.operator()<float>() ||
+                try_type.operator()<double>() ||
+                try_type.operator()<std::string>() ||
+                [&] {
+                    // Fallback to string, and non-defined property
+                    const auto& value = grc_value.template as<std::string>();
+                    block.metaInformation()[key] = value;
+                    return true;
+                }();
+                // clang-format on
 
-                } else {
-                    const auto &value                   = kv.second.as<std::string>();
-                    currentBlock->metaInformation()[key] = value;
-                }
+            } else {
+                const auto &value            = kv.second.as<std::string>();
+                block.metaInformation()[key] = value;
+            }
+        }
+    }
+
+    std::ignore = block.settings().set(new_properties);
+}
+
+class LoadPhaseTimer {
+    using clock = std::chrono::steady_clock;
+    GraphLoadStats   *_stats;
+    clock::time_point _phaseStart = clock::now();
+
+public:
+    explicit LoadPhaseTimer(GraphLoadStats *stats) noexcept : _stats(stats) {}
+
+    void
+    endPhase(std::chrono::nanoseconds GraphLoadStats::*phase) noexcept {
+        const auto now = clock::now();
+        if (_stats != nullptr) {
+            _stats->*phase = now - _phaseStart;
+        }
+        _phaseStart = now;
+    }
+};
+
+struct BlockDefinition {
+    std::string                  name;
+    std::string                  id;
+    std::string                  type    = "double";
+    BlockRegistry::BlockFactory *factory = nullptr;
+};
+
+[[nodiscard]] inline std::unique_ptr<thread_pool::BasicThreadPool>
+makeLoadPool(std::size_t nBlocks) {
+    if (nBlocks < kParallelLoadMinBlocks) {
+        return nullptr;
+    }
+    return std::make_unique<thread_pool::BasicThreadPool>("grc_loader_pool", thread_pool::TaskType::CPU_BOUND);
+}
+
+/**
+ * Parallel construction draws the per-type 'unique_id's in scheduling order. This hands out the (not yet configured, i.e.
+ * interchangeable) blocks of each type in ascending id order to the definitions in document order, so that the
+ * 'unique_name's ("<type>#<id>") do not depend on the thread scheduling.
+ */
+inline void
+orderByUniqueId(std::vector<std::unique_ptr<BlockModel>> &blocks) {
+    constexpr auto split = [](std::string_view uniqueName) {
+        const auto  separator = uniqueName.rfind('#');
+        std::size_t id        = 0UZ;
+        if (separator != std::string_view::npos) {
+            std::ignore = std::from_chars(uniqueName.data() + separator + 1UZ, uniqueName.data() + uniqueName.size(), id);
+        }
+        return std::pair{ uniqueName.substr(0UZ, separator), id };
+    };
+    std::map<std::string_view, std::vector<std::size_t>> indicesByType; // N.B. indices in document order
+    for (std::size_t index = 0UZ; index < blocks.size(); ++index) {
+        indicesByType[split(blocks[index]->uniqueName()).first].push_back(index);
+    }
+    for (const auto &indices : indicesByType | std::views::values) {
+        std::vector<std::unique_ptr<BlockModel>> group;
+        group.reserve(indices.size());
+        for (const std::size_t index : indices) {
+            group.push_back(std::move(blocks[index]));
+        }
+        std::ranges::sort(group, {}, [&split](const auto &block) { return split(block->uniqueName()).second; });
+        for (std::size_t i = 0UZ; i < indices.size(); ++i) {
+            blocks[indices[i]] = std::move(group[i]);
+        }
+    }
+}
+
+/**
+ * resolves the factories (once per distinct block id and type), constructs the blocks (in parallel if a 'pool' is given) and
+ * adds them to 'graph' in the order of 'definitions'. N.B. 'configure(index, block)' is invoked concurrently for different blocks.
+ * @return the blocks in the order of 'definitions'
+ */
+template<typename Configure>
+std::vector<BlockModel *>
+instantiateBlocks(PluginLoader &loader, Graph &graph, std::span<BlockDefinition> definitions, thread_pool::BasicThreadPool *pool, LoadPhaseTimer &timer, Configure &&configure) {
+    StringMap<BlockRegistry::BlockFactory> factories;
+    for (auto &definition : definitions) {
+        const auto key = fmt::format("{}<{}>", definition.id, definition.type);
+        auto       it  = factories.find(key);
+        if (it == factories.end()) {
+            it = factories.emplace(key, loader.blockFactory(definition.id, definition.type)).first;
+        }
+        if (!it->second) {
+            throw fmt::format("Unable to create block of type '{}'", definition.id);
+        }
+        definition.factory = &it->second;
+    }
+    timer.endPhase(&GraphLoadStats::resolve);
+
+    auto forEachDefinition = [pool, nDefinitions = definitions.size()](auto &&func) {
+        if (pool != nullptr) {
+            thread_pool::parallelFor(*pool, nDefinitions, func);
+        } else {
+            for (std::size_t index = 0UZ; index < nDefinitions; ++index) {
+                func(index);
             }
         }
+    };
 
-        std::ignore         = currentBlock->settings().set(new_properties);
-        createdBlocks[name] = &testGraph.addBlock(std::move(currentBlock));
+    std::vector<std::unique_ptr<BlockModel>> createdBlocks(definitions.size());
+    forEachDefinition([&definitions, &createdBlocks](std::size_t index) {
+        createdBlocks[index] = (*definitions[index].factory)({});
+        if (!createdBlocks[index]) {
+            throw fmt::format("Unable to create block of type '{}'", definitions[index].id);
+        }
+    });
+    if (pool != nullptr) {
+        orderByUniqueId(createdBlocks);
+    }
+    forEachDefinition([&definitions, &createdBlocks, &configure](std::size_t index) {
+        BlockModel &block = *createdBlocks[index];
+        block.setName(definitions[index].name);
+        configure(index, block);
+        block.initDynamicPorts(); // N.B. lazy port initialisation is not thread-safe -> done here rather than during the connection phase
+    });
+    timer.endPhase(&GraphLoadStats::construct);
+
+    std::vector<BlockModel *> blocks;
+    blocks.reserve(createdBlocks.size());
+    for (auto &block : createdBlocks) {
+        blocks.push_back(&graph.addBlock(std::move(block)));
+    }
+    timer.endPhase(&GraphLoadStats::add);
+    return blocks;
+}
+
+inline void
+updateLoadStats(GraphLoadStats *stats, Graph &graph, const thread_pool::BasicThreadPool *pool) {
+    if (stats != nullptr) {
+        stats->nBlocks  = graph.blocks().size();
+        stats->nEdges   = graph.edges().size();
+        stats->nThreads = pool != nullptr ? static_cast<std::size_t>(pool->maxThreads()) : 1UZ;
+    }
+}
+
+} // namespace detail
+
+/**
+ * loads a GRC/YAML flow-graph in stages: the YAML is parsed once, the block factories are resolved once per distinct block id,
+ * the blocks are constructed (incl. their port buffers) and configured in parallel, added to the graph in the YAML order,
+ * and finally connected in parallel (see 'Graph::connectAll(...)'). Graphs with fewer than 'detail::kParallelLoadMinBlocks'
+ * blocks are loaded in the calling thread. The optional 'stats' receive the duration of the individual phases.
+ */
+inline gr::Graph
+load_grc(PluginLoader &loader, const std::string &yaml_source, GraphLoadStats *stats = nullptr) {
+    detail::LoadPhaseTimer timer(stats);
+    Graph                  testGraph;
+
+    // parse
+    // TODO: Discuss how GRC should store the node types, how we should
+    // in general handle nodes that are parametrised by more than one type
+    std::vector<detail::BlockDefinition> blockDefinitions;
+    std::vector<YAML::Node>              blockParameters; // N.B. deep copies since YAML nodes of the same tree must not be accessed concurrently
+    YAML::Node                           tree   = YAML::Load(yaml_source);
+    auto                                 blocks = tree["blocks"];
+    blockDefinitions.reserve(blocks.size());
+    blockParameters.reserve(blocks.size());
+    for (const auto &grc_block : blocks) {
+        blockDefinitions.push_back({ .name = grc_block["name"].as<std::string>(), .id = grc_block["id"].as<std::string>() });
+        auto parameters = grc_block["parameters"];
+        blockParameters.push_back(parameters ? YAML::Clone(parameters) : YAML::Node{});
+    }
+    timer.endPhase(&GraphLoadStats::parse);
+
+    // resolve, construct and add
+    auto       pool          = detail::makeLoadPool(blockDefinitions.size());
+    const auto createdBlocks = detail::instantiateBlocks(loader, testGraph, blockDefinitions, pool.get(), timer,
+                                                         [&blockParameters](std::size_t index, BlockModel &block) { detail::applyGrcParameters(block, blockParameters[index]); });
+    detail::StringMap<BlockModel *> blockForName;
+    blockForName.reserve(createdBlocks.size());
+    for (std::size_t index = 0UZ; index < createdBlocks.size(); ++index) {
+        blockForName[blockDefinitions[index].name] = createdBlocks[index];
     }
 
+    // connect
+    std::vector<Graph::BlockConnection> connections;
     for (const auto &connection : tree["connections"]) {
         if (connection.size() != 4) {
             throw fmt::format("Unable to parse connection ({} instead of 4 elements)", connection.size());
         }
 
-        auto parseBlock_port = [&](const auto &blockField, const auto &portField) {
+        auto parseBlock_port = [&](const auto &blockField, const auto &portField) -> std::pair<BlockModel *, PortIndexDefinition<std::size_t>> {
             auto blockName = blockField.template as<std::string>();
-            auto node      = createdBlocks.find(blockName);
-            if (node == createdBlocks.end()) {
+            auto node      = blockForName.find(blockName);
+            if (node == blockForName.end()) {
                 throw fmt::format("Unknown node '{}'", blockName);
             }
 
-            struct result {
-                decltype(node)                   block_it;
-                PortIndexDefinition<std::size_t> port_definition;
-            };
-
             if (portField.IsSequence()) {
                 if (portField.size() != 2) {
                     throw fmt::format("Port definition has invalid length ({} instead of 2)", portField.size());
                 }
                 const auto indexStr    = portField[0].template as<std::string>();
                 const auto subIndexStr = portField[1].template as<std::string>();
-                return result{ node, { detail::parseIndex(indexStr), detail::parseIndex(subIndexStr) } };
+                return { node->second, { detail::parseIndex(indexStr), detail::parseIndex(subIndexStr) } };
             } else {
                 const auto indexStr = portField.template as<std::string>();
-                return result{ node, { detail::parseIndex(indexStr) } };
+                return { node->second, { detail::parseIndex(indexStr) } };
             }
         };
 
-        if (connection.size() == 4) {
-            auto src = parseBlock_port(connection[0], connection[1]);
-            auto dst = parseBlock_port(connection[2], connection[3]);
-            testGraph.connect(*src.block_it->second, src.port_definition, *dst.block_it->second, dst.port_definition);
-        } else {
-        }
+        auto [sourceBlock, sourcePort]           = parseBlock_port(connection[0], connection[1]);
+        auto [destinationBlock, destinationPort] = parseBlock_port(connection[2], connection[3]);
+        connections.push_back({ .source = sourceBlock, .sourcePort = sourcePort, .destination = destinationBlock, .destinationPort = destinationPort });
     }
+    std::ignore = testGraph.connectAll(connections, pool.get());
+    timer.endPhase(&GraphLoadStats::connect);
 
+    detail::updateLoadStats(stats, testGraph, pool.get());
     return testGraph;
 }
 
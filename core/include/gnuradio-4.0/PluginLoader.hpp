@@ -2,15 +2,22 @@
 #define GNURADIO_PLUGIN_LOADER_H
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <map>
 #include <span>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <unistd.h>
+
 #include "BlockRegistry.hpp"
 #include "Graph.hpp"
 
@@ -25,6 +32,20 @@ namespace gr {
 using namespace std::string_literals;
 using namespace std::string_view_literals;
 
+namespace detail {
+/**
+ * @return process-unique sibling of 'path' to write to before atomically renaming it to 'path' (N.B. a fixed name would be
+ * truncated and written concurrently by processes starting at the same time)
+ */
+[[nodiscard]] inline std::filesystem::path
+temporaryPathFor(const std::filesystem::path &path) {
+    static std::atomic<std::uint64_t> counter = 0U;
+    std::filesystem::path             result  = path;
+    result += fmt::format(".{}.{}.tmp", ::getpid(), counter++);
+    return result;
+}
+} // namespace detail
+
 #ifndef __EMSCRIPTEN__
 // Plugins are not supported on WASM
 
@@ -130,18 +151,109 @@ public:
     }
 };
 
+namespace detail {
+struct PluginIndexEntry {
+    std::uintmax_t           fileSize      = 0U;
+    std::int64_t             lastWriteTime = 0; // N.B. file clock ticks, only compared for equality
+    std::vector<std::string> blocks;
+};
+
+using PluginIndex = std::map<std::string, PluginIndexEntry, std::less<>>; // plugin file -> provided blocks
+
+inline constexpr std::string_view kPluginIndexHeader = "# gnuradio-4.0 plugin index v2";
+
+/**
+ * plugin index (text) format, one record per line:
+ * @code
+ * # gnuradio-4.0 plugin index v2
+ * plugin<TAB><file size><TAB><last write time><TAB><number of blocks><TAB><plugin file path>
+ * block<TAB><block name provided by the preceding plugin>
+ * end<TAB><number of plugins>
+ * @endcode
+ * @return the parsed index, or an empty index if the file does not exist, has an unknown format, or is incomplete (i.e. block
+ * counts or the trailer do not match, e.g. due to a truncated file)
+ */
+[[nodiscard]] inline PluginIndex
+readPluginIndex(const std::filesystem::path &indexFile) {
+    PluginIndex   index;
+    std::ifstream file(indexFile);
+    std::string   line;
+    if (!std::getline(file, line) || line != kPluginIndexHeader) {
+        return {};
+    }
+    PluginIndexEntry *current        = nullptr;
+    std::size_t       expectedBlocks = 0UZ;
+    while (std::getline(file, line)) {
+        if (current != nullptr && !line.starts_with("block\t") && current->blocks.size() != expectedBlocks) {
+            return {}; // incomplete plugin record -> rescan
+        }
+        if (line.starts_with("plugin\t")) {
+            std::istringstream record(line.substr(7UZ));
+            PluginIndexEntry   entry;
+            std::string        path;
+            record >> entry.fileSize >> entry.lastWriteTime >> expectedBlocks;
+            record.ignore(1);
+            if (!record || !std::getline(record, path) || path.empty()) {
+                return {}; // corrupt index -> rescan
+            }
+            current = &index.insert_or_assign(std::move(path), std::move(entry)).first->second;
+        } else if (line.starts_with("block\t") && current != nullptr) {
+            current->blocks.emplace_back(line.substr(6UZ));
+        } else if (line.starts_with("end\t")) {
+            std::size_t nPlugins = 0UZ;
+            std::istringstream(line.substr(4UZ)) >> nPlugins;
+            return nPlugins == index.size() ? index : PluginIndex{};
+        } else if (!line.empty()) {
+            return {};
+        }
+    }
+    return {}; // missing trailer -> truncated index
+}
+
+inline bool
+writePluginIndex(const std::filesystem::path &indexFile, const PluginIndex &index) {
+    const std::filesystem::path temporaryFile = temporaryPathFor(indexFile);
+    {
+        std::ofstream file(temporaryFile, std::ios::trunc);
+        file << kPluginIndexHeader << '\n';
+        for (const auto &[path, entry] : index) {
+            file << "plugin\t" << entry.fileSize << '\t' << entry.lastWriteTime << '\t' << entry.blocks.size() << '\t' << path << '\n';
+            for (const auto &block : entry.blocks) {
+                file << "block\t" << block << '\n';
+            }
+        }
+        file << "end\t" << index.size() << '\n';
+        if (!file) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(temporaryFile, ec);
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporaryFile, indexFile, ec); // N.B. atomic replacement for concurrently starting processes
+    if (ec) {
+        std::filesystem::remove(temporaryFile, ec);
+        return false;
+    }
+    return true;
+}
+} // namespace detail
+
 class PluginLoader {
 private:
-    std::vector<PluginHandler>                        _handlers;
-    std::unordered_map<std::string, gr_plugin_base *> _handlerForName;
-    std::unordered_map<std::string, std::string>      _failedPlugins;
-    std::unordered_set<std::string>                   _loadedPluginFiles;
+    std::vector<PluginHandler>                   _handlers;
+    detail::StringMap<gr_plugin_base *>          _handlerForName;
+    std::unordered_map<std::string, std::string> _failedPlugins;
+    std::unordered_set<std::string>              _loadedPluginFiles;
+    detail::StringMap<std::string>               _pluginFileForName; // blocks of indexed but not yet loaded plugins
 
     BlockRegistry           *_registry;
     std::vector<std::string> _knownBlocks;
 
-public:
-    PluginLoader(BlockRegistry &registry, std::span<const std::filesystem::path> plugin_directories) : _registry(&registry) {
+    template<typename Callback>
+    void
+    forEachPluginFile(std::span<const std::filesystem::path> plugin_directories, Callback &&callback) {
         for (const auto &directory : plugin_directories) {
             std::cerr << std::filesystem::current_path() << std::endl;
 
@@ -153,19 +265,86 @@ public:
                     if (_loadedPluginFiles.contains(fileString)) continue;
                     _loadedPluginFiles.insert(fileString);
 
-                    if (PluginHandler handler(file.path().string()); handler) {
-                        for (const auto &block_name : handler->providedBlocks()) {
-                            _handlerForName.emplace(std::string(block_name), handler.operator->());
-                            _knownBlocks.emplace_back(block_name);
-                        }
+                    callback(file.path());
+                }
+            }
+        }
+    }
 
-                        _handlers.push_back(std::move(handler));
+    gr_plugin_base *
+    loadPlugin(const std::string &file) {
+        PluginHandler handler(file);
+        if (!handler) {
+            _failedPlugins[file] = handler.status();
+            return nullptr;
+        }
 
-                    } else {
-                        _failedPlugins[file.path()] = handler.status();
-                    }
+        for (const auto &block_name : handler->providedBlocks()) {
+            _handlerForName.emplace(std::string(block_name), handler.operator->());
+            if (!_pluginFileForName.contains(block_name)) { // N.B. names of indexed plugins are already known
+                _knownBlocks.emplace_back(block_name);
+            }
+        }
+        _handlers.push_back(std::move(handler));
+        return _handlers.back().operator->();
+    }
+
+    gr_plugin_base *
+    findPlugin(std::string_view name) {
+        if (auto it = _handlerForName.find(name); it != _handlerForName.end()) {
+            return it->second;
+        }
+        auto pending = _pluginFileForName.find(name);
+        if (pending == _pluginFileForName.end()) {
+            return nullptr;
+        }
+
+        const std::string file = pending->second;
+        std::ignore            = loadPlugin(file);
+        std::erase_if(_pluginFileForName, [&file](const auto &entry) { return entry.second == file; });
+        auto it = _handlerForName.find(name);
+        return it == _handlerForName.end() ? nullptr : it->second;
+    }
+
+public:
+    PluginLoader(BlockRegistry &registry, std::span<const std::filesystem::path> plugin_directories) : _registry(&registry) {
+        forEachPluginFile(plugin_directories, [this](const std::filesystem::path &file) { std::ignore = loadPlugin(file.string()); });
+    }
+
+    /**
+     * lazy variant: only plugins that are not (or no longer up-to-date) in the 'pluginIndex' file are loaded up-front to determine
+     * the blocks they provide. All other plugins are only loaded once one of their blocks is instantiated (see 'instantiate(...)' and
+     * 'blockFactory(...)'). The index is (re-)written whenever the set of plugins or their file size/modification time changes.
+     * N.B. the index is only a cache, i.e. a missing, corrupt, or read-only index file results in (repeated) up-front loading.
+     */
+    PluginLoader(BlockRegistry &registry, std::span<const std::filesystem::path> plugin_directories, const std::filesystem::path &pluginIndex) : _registry(&registry) {
+        const detail::PluginIndex cachedIndex = detail::readPluginIndex(pluginIndex);
+        detail::PluginIndex       index;
+        bool                      indexChanged = false;
+        forEachPluginFile(plugin_directories, [&](const std::filesystem::path &file) {
+            auto            fileString = file.string();
+            std::error_code ec;
+            const auto      fileSize      = std::filesystem::file_size(file, ec);
+            const auto      lastWriteTime = static_cast<std::int64_t>(std::filesystem::last_write_time(file, ec).time_since_epoch().count());
+            if (auto cached = cachedIndex.find(fileString); !ec && cached != cachedIndex.end() && cached->second.fileSize == fileSize && cached->second.lastWriteTime == lastWriteTime) {
+                for (const auto &blockName : cached->second.blocks) {
+                    _pluginFileForName.emplace(blockName, fileString);
+                    _knownBlocks.emplace_back(blockName);
                 }
+                index.emplace(std::move(fileString), cached->second);
+                return;
             }
+
+            // new or modified plugin -> scanned now and remains loaded, N.B. failed plugins are not indexed and thus retried on the next start
+            if (const gr_plugin_base *plugin = loadPlugin(fileString); plugin != nullptr && !ec) {
+                const auto provided = plugin->providedBlocks();
+                index.emplace(std::move(fileString), detail::PluginIndexEntry{ fileSize, lastWriteTime, { provided.begin(), provided.end() } });
+                indexChanged = true;
+            }
+        });
+
+        if (indexChanged || index.size() != cachedIndex.size()) {
+            std::ignore = detail::writePluginIndex(pluginIndex, index);
         }
     }
 
@@ -198,14 +377,27 @@ public:
         if (auto result = _registry->createBlock(name, type, params)) {
             return result;
         }
-        auto it = _handlerForName.find(std::string(name)); // TODO avoid std::string here
-        if (it == _handlerForName.end()) return {};
-
-        auto &handler = it->second;
+        auto *handler = findPlugin(name);
+        if (handler == nullptr) return {};
 
         return handler->createBlock(name, type, params);
     }
 
+    /**
+     * resolves the factory of a block once (e.g. for bulk or parallel instantiation), falls back to the plugins (loading them if needed)
+     * if the block is not part of the registry, @return empty factory if the block name is unknown
+     */
+    [[nodiscard]] BlockRegistry::BlockFactory
+    blockFactory(std::string_view name, std::string_view type) {
+        if (auto factory = _registry->blockFactory(name, type)) {
+            return factory;
+        }
+        auto *handler = findPlugin(name);
+        if (handler == nullptr) return {};
+
+        return [handler, name = std::string(name), type = std::string(type)](const property_map &params) { return handler->createBlock(name, type, params); };
+    }
+
     template<typename Graph, typename... InstantiateArgs>
     gr::BlockModel &
     instantiateInGraph(Graph &graph, InstantiateArgs &&...args) {
@@ -226,6 +418,8 @@ private:
 public:
     PluginLoader(BlockRegistry &registry, std::span<const std::filesystem::path> /*plugin_directories*/) : _registry(&registry) {}
 
+    PluginLoader(BlockRegistry &registry, std::span<const std::filesystem::path> /*plugin_directories*/, const std::filesystem::path & /*pluginIndex*/) : _registry(&registry) {}
+
     BlockRegistry &
     registry() {
         return *_registry;
@@ -241,6 +435,11 @@ public:
         return _registry->createBlock(name, type, params);
     }
 
+    [[nodiscard]] BlockRegistry::BlockFactory
+    blockFactory(std::string_view name, std::string_view type) {
+        return _registry->blockFactory(name, type);
+    }
+
     template<typename Graph, typename... InstantiateArgs>
     gr::BlockModel &
     instantiateInGraph(Graph &graph, InstantiateArgs &&...args) {
@@ -81,6 +81,11 @@ struct InternalPortBuffers {
     void *tagHandler;
 };
 
+struct BufferOccupancy {
+    std::size_t capacity = 0UZ; // buffer size [samples]
+    std::size_t nSamples = 0UZ; // published but not yet consumed samples
+};
+
 /**
  * @brief optional port annotation argument to describe the min/max number of samples required from this port before invoking the blocks work function.
  *
@@ -562,6 +567,20 @@ public:
         return _ioHandler;
     }
 
+    /**
+     * @return capacity and number of pending (i.e. published but not yet consumed) samples of the connected input buffer, { 0, 0 } for output ports or buffers w/o support
+     * N.B. derived from the buffer's shared writer/reader sequences and thus safe to be sampled from a thread other than the one executing the block
+     */
+    [[nodiscard]] BufferOccupancy
+    bufferOccupancy() const noexcept {
+        if constexpr (kIsInput && requires { _ioHandler.nSamplesPending(); }) {
+            if (_connected) {
+                return { _ioHandler.buffer().size(), _ioHandler.nSamplesPending() };
+            }
+        }
+        return {};
+    }
+
     [[nodiscard]] constexpr const TagReaderType &
     tagReader() const noexcept {
         static_assert(!kIsOutput, "tagReader() not applicable for outputs (yet)");
@@ -835,6 +854,10 @@ private:
         connect(DynamicPort &dst_port)
                 = 0;
 
+        [[nodiscard]] virtual BufferOccupancy
+        bufferOccupancy() const noexcept
+                = 0;
+
         // internal runtime polymorphism access
         [[nodiscard]] virtual bool
         updateReaderInternal(InternalPortBuffers buffer_other) noexcept
@@ -939,6 +962,11 @@ private:
             return _value.disconnect();
         }
 
+        [[nodiscard]] BufferOccupancy
+        bufferOccupancy() const noexcept override {
+            return _value.bufferOccupancy();
+        }
+
         [[nodiscard]] ConnectionResult
         connect(DynamicPort &dst_port) override {
             using enum gr::ConnectionResult;
@@ -1035,6 +1063,11 @@ public:
         return _accessor->disconnect();
     }
 
+    [[nodiscard]] BufferOccupancy
+    bufferOccupancy() const noexcept {
+        return _accessor->bufferOccupancy();
+    }
+
     [[nodiscard]] ConnectionResult
     connect(DynamicPort &dst_port) {
         return _accessor->connect(dst_port);
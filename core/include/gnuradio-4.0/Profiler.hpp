@@ -1,19 +1,35 @@
 #ifndef GNURADIO_PROFILER_HPP
 #define GNURADIO_PROFILER_HPP
 
-#include "CircularBuffer.hpp"
-
 #include <fmt/format.h>
+#include <fmt/ostream.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <unistd.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
 namespace gr::profiling {
 
 using arg_value = std::pair<std::string, std::variant<std::string, int, double>>;
@@ -22,7 +38,7 @@ namespace detail {
 using clock      = std::chrono::high_resolution_clock;
 using time_point = clock::time_point;
 
-enum class EventType {
+enum class EventType : char {
     DurationBegin = 'B', // Duration Event (begin).
     DurationEnd   = 'E', // Duration Event (end).
     Complete      = 'X', // Complete Event.
@@ -36,84 +52,182 @@ enum class EventType {
     FlowEnd       = 'f'  // Flow Event (end).
 };
 
-inline std::string
-format_args(const std::vector<arg_value> &args) {
-    if (args.empty()) {
-        return "{}";
-    }
-    std::string r = "{";
-    for (std::size_t i = 0; i < args.size(); ++i) {
-        if (i > 0) {
-            r += ",";
-        }
-        if (std::holds_alternative<std::string>(args[i].second)) {
-            r += fmt::format("\"{}\":\"{}\"", args[i].first, std::get<std::string>(args[i].second));
-        } else if (std::holds_alternative<double>(args[i].second)) {
-            r += fmt::format("\"{}\":{}", args[i].first, std::get<double>(args[i].second));
-        } else {
-            r += fmt::format("\"{}\":{}", args[i].first, std::get<int>(args[i].second));
-        }
-    }
-    r += "}";
-    return r;
+/// @return cheap, monotonic time-stamp counter (TSC on x86, virtual counter on aarch64), converted to wall-time offline
+[[nodiscard]] inline std::uint64_t
+ticks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    std::uint64_t value;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
 }
 
-struct alignas(256) TraceEvent { // fills up to power of 2 size, see static_assert below. unaligned size is 152
-    std::thread::id           thread_id;
-    std::string               name;   // Event name.
-    EventType                 type;   // Event type.
-    std::chrono::microseconds ts;     // Timestamp
-    std::chrono::microseconds dur;    // Duration of the event, for 'X' type.
-    int                       id = 0; // ID for matching async or flow events.
-    std::string               cat;    // Event categories.
-    std::vector<arg_value>    args;   // Event arguments.
-
-    // Function to format a TraceEvent into JSON format.
-    std::string
-    toJSON(int pid, int tid) const {
-        using enum EventType;
-        switch (type) {
-        case DurationBegin:
-        case DurationEnd:
-        case Counter:
-        case Instant:
-            return fmt::format(R"({{"name": "{}", "ph": "{}", "ts": {}, "pid": {}, "tid": {}, "cat": "{}", "args": {}}})", name, static_cast<char>(type), ts.count(), pid, tid, cat, format_args(args));
-        case Complete:
-            return fmt::format(R"({{"name": "{}", "ph": "X", "ts": {}, "pid": {}, "tid": {}, "dur": {}, "cat": "{}", "args": {}}})", name, ts.count(), pid, tid, dur.count(), cat, format_args(args));
-        case AsyncStart:
-        case AsyncStep:
-        case AsyncEnd:
-            return fmt::format(R"({{"name": "{}", "ph": "{}", "ts": {}, "pid": {}, "tid": {}, "id": "{}", "cat": "{}", "args": {}}})", name, static_cast<char>(type), ts.count(), pid, tid, id, cat,
-                               format_args(args));
-        default: // TODO
-            return fmt::format(R"({{"name": "{}", "ph": "{}", "ts": {}, "pid": {}, "tid": {}, "cat": "{}", "args": {}}})", name, static_cast<char>(type), ts.count(), pid, tid, cat, format_args(args));
-        }
+enum class ArgKind : std::uint8_t { None = 0U, Int, Double, String };
+
+inline constexpr std::size_t kMaxArgs = 2UZ; // arguments recorded per event, further ones are ignored
+
+/**
+ * Fixed-size POD trace record, written wait-free into per-thread rings and dumped as is (native byte order).
+ * Strings (name, categories, argument keys and string argument values) are interned profiler-wide and referenced by id,
+ * 0 <-> empty. Numeric argument values are stored inline, i.e. varying counters, sizes, etc. neither lock nor allocate.
+ */
+struct alignas(64) TraceEvent {
+    std::uint64_t                       ts        = 0U; // time-stamp [ticks]
+    std::uint64_t                       dur       = 0U; // duration [ticks], 'X' events only
+    std::array<std::uint64_t, kMaxArgs> argValues{};    // bit-cast std::int64_t or double, or the interned id of a string value
+    std::uint32_t                       name      = 0U; // interned event name
+    std::uint32_t                       cat       = 0U; // interned event categories
+    std::array<std::uint32_t, kMaxArgs> argKeys{};      // interned argument keys
+    std::uint32_t                       id        = 0U; // ID for matching async or flow events
+    std::uint32_t                       tid       = 0U; // profiler-wide thread index
+    EventType                           type      = EventType::Instant;
+    std::array<ArgKind, kMaxArgs>       argKinds{};
+};
+
+static_assert(std::is_trivially_copyable_v<TraceEvent>);
+static_assert(sizeof(TraceEvent) == 64UZ, "one event per cache line");
+
+/**
+ * Binary trace format: 'kMagic' followed by blocks of { BlockHeader, payload }:
+ *  - String: { std::uint32_t id, char[size - 4] } -- interned string, emitted before the first event referring to it
+ *  - Clock:  { std::uint64_t ticks, std::int64_t ns } -- tick <-> steady-clock calibration points, the first one defines t = 0
+ *  - Events: TraceEvent[size / sizeof(TraceEvent)]
+ */
+inline constexpr std::array<char, 8> kMagic = { 'G', 'R', 'P', 'R', 'O', 'F', '0', '2' };
+
+enum class BlockKind : std::uint32_t { String = 1U, Clock = 2U, Events = 3U };
+
+struct BlockHeader {
+    BlockKind     kind;
+    std::uint32_t size; // payload size [bytes]
+};
 
-        return {};
+struct ClockSync {
+    std::uint64_t ticks;
+    std::int64_t  ns;
+
+    [[nodiscard]] static ClockSync
+    now() noexcept {
+        return { detail::ticks(), std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() };
     }
+};
 
-    TraceEvent()                       = default;
-    ~TraceEvent()                      = default;
-    TraceEvent(TraceEvent &&) noexcept = default;
-    TraceEvent &
-    operator=(TraceEvent &&) noexcept
-            = default;
+/// maps ticks to microseconds w.r.t. 'origin', the rate is derived from the calibration points 'origin' and 'latest'
+struct TickConverter {
+    ClockSync origin{ 0U, 0 };
+    double    ticksPerUs = 1e3; // fall-back: ticks <-> ns
 
-    // the default implementations slow down publish() even if never called at runtime (branch prediction going wrong for the non-mmap case?)
-    // seen with -O3 on gcc 12.3.0
-    TraceEvent(const TraceEvent &) { throw std::logic_error("unexpected copy"); }
+    TickConverter() = default;
 
-    TraceEvent &
-    operator=(const TraceEvent &) {
-        throw std::logic_error("unexpected assignment");
+    TickConverter(ClockSync first, ClockSync latest) : origin(first) {
+        if (latest.ticks > first.ticks && latest.ns > first.ns) {
+            ticksPerUs = static_cast<double>(latest.ticks - first.ticks) / (1e-3 * static_cast<double>(latest.ns - first.ns));
+        }
+    }
+
+    [[nodiscard]] double
+    toUs(std::uint64_t ticks) const noexcept {
+        return static_cast<double>(static_cast<std::int64_t>(ticks - origin.ticks)) / ticksPerUs;
     }
 };
 
-// size of TraceEvent must be power of 2, otherwise circular_buffer doesn't work correctly
-static_assert(std::has_single_bit(sizeof(TraceEvent)));
+inline std::string
+toJSON(const TraceEvent &event, std::span<const std::string> strings, const TickConverter &converter, int pid) {
+    using enum EventType;
+    auto str = [&strings](std::uint32_t id) -> std::string_view { return id < strings.size() ? std::string_view(strings[id]) : std::string_view{}; };
+
+    std::string args = "{";
+    for (std::size_t i = 0UZ; i < kMaxArgs && event.argKinds[i] != ArgKind::None; ++i) {
+        args += i == 0UZ ? "" : ",";
+        switch (event.argKinds[i]) {
+        case ArgKind::Int: args += fmt::format("\"{}\":{}", str(event.argKeys[i]), std::bit_cast<std::int64_t>(event.argValues[i])); break;
+        case ArgKind::Double: args += fmt::format("\"{}\":{}", str(event.argKeys[i]), std::bit_cast<double>(event.argValues[i])); break;
+        default: args += fmt::format("\"{}\":\"{}\"", str(event.argKeys[i]), str(static_cast<std::uint32_t>(event.argValues[i]))); break;
+        }
+    }
+    args += "}";
+    const double      ts   = converter.toUs(event.ts);
+    switch (event.type) {
+    case Complete:
+        return fmt::format(R"({{"name": "{}", "ph": "X", "ts": {:.3f}, "pid": {}, "tid": {}, "dur": {:.3f}, "cat": "{}", "args": {}}})", str(event.name), ts, pid, event.tid,
+                           static_cast<double>(event.dur) / converter.ticksPerUs, str(event.cat), args);
+    case AsyncStart:
+    case AsyncStep:
+    case AsyncEnd:
+        return fmt::format(R"({{"name": "{}", "ph": "{}", "ts": {:.3f}, "pid": {}, "tid": {}, "id": "{}", "cat": "{}", "args": {}}})", str(event.name), static_cast<char>(event.type), ts, pid, event.tid,
+                           event.id, str(event.cat), args);
+    default:
+        return fmt::format(R"({{"name": "{}", "ph": "{}", "ts": {:.3f}, "pid": {}, "tid": {}, "cat": "{}", "args": {}}})", str(event.name), static_cast<char>(event.type), ts, pid, event.tid, str(event.cat),
+                           args);
+    }
+}
+
+template<typename TPayload>
+void
+writeBlock(std::ostream &out, BlockKind kind, std::span<TPayload> payload, std::string_view suffix = {}) {
+    const BlockHeader header{ kind, static_cast<std::uint32_t>(payload.size_bytes() + suffix.size()) };
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(payload.data()), static_cast<std::streamsize>(payload.size_bytes()));
+    out.write(suffix.data(), static_cast<std::streamsize>(suffix.size()));
+}
 
 } // namespace detail
 
+/**
+ * Offline conversion of a binary trace (OutputMode::BinaryFile) into the Chrome trace event JSON format
+ * (viewable via chrome://tracing or https://ui.perfetto.dev).
+ * @return number of converted events
+ */
+inline std::size_t
+convertToChromeTrace(std::istream &binary, std::ostream &json, int pid = 0) {
+    std::array<char, detail::kMagic.size()> magic{};
+    if (!binary.read(magic.data(), magic.size()) || magic != detail::kMagic) {
+        throw std::invalid_argument("not a binary gr::profiling trace");
+    }
+
+    std::vector<std::string>            strings{ std::string{} };
+    std::vector<detail::ClockSync>      clocks;
+    std::vector<detail::TraceEvent>     events;
+    detail::BlockHeader                 header{};
+    while (binary.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+        std::vector<char> payload(header.size);
+        if (!binary.read(payload.data(), static_cast<std::streamsize>(payload.size()))) {
+            throw std::invalid_argument("truncated gr::profiling trace");
+        }
+        switch (header.kind) {
+        case detail::BlockKind::String: {
+            std::uint32_t id;
+            std::memcpy(&id, payload.data(), sizeof(id));
+            strings.resize(std::max(strings.size(), static_cast<std::size_t>(id) + 1UZ));
+            strings[id].assign(payload.data() + sizeof(id), payload.size() - sizeof(id));
+        } break;
+        case detail::BlockKind::Clock: {
+            detail::ClockSync sync;
+            std::memcpy(&sync, payload.data(), sizeof(sync));
+            clocks.push_back(sync);
+        } break;
+        case detail::BlockKind::Events: {
+            const auto first = events.size();
+            events.resize(first + payload.size() / sizeof(detail::TraceEvent));
+            std::memcpy(static_cast<void *>(events.data() + first), payload.data(), (events.size() - first) * sizeof(detail::TraceEvent));
+        } break;
+        default: break; // forward compatibility: skip unknown blocks
+        }
+    }
+
+    const auto converter = clocks.empty() ? detail::TickConverter{} : detail::TickConverter(clocks.front(), clocks.back());
+    fmt::print(json, "[\n");
+    for (std::size_t i = 0UZ; i < events.size(); ++i) {
+        fmt::print(json, "{}{}", i == 0UZ ? "" : ",\n", detail::toJSON(events[i], strings, converter, pid));
+    }
+    fmt::print(json, "\n]\n");
+    return events.size();
+}
+
 template<typename T>
 concept SimpleEvent = requires(T e) {
     { e.finish() } -> std::same_as<void>;
@@ -139,11 +253,16 @@ concept ProfilerLike = requires(T p) {
     { p.forThisThread() } -> ProfilerHandlerLike;
 };
 
-enum class OutputMode { StdOut, File };
+enum class OutputMode {
+    StdOut,    // Chrome trace JSON, converted on the fly by the drain thread
+    File,      // Chrome trace JSON, converted on the fly by the drain thread
+    BinaryFile // raw event dump, @see convertToChromeTrace(...) for the offline conversion
+};
 
 struct Options {
     std::string output_file;
-    OutputMode  output_mode = OutputMode::File;
+    OutputMode  output_mode       = OutputMode::File;
+    std::size_t events_per_thread = 1UZ << 16U; // per-thread ring capacity (rounded up to a power of two), oldest events are lost if not drained in time
 };
 
 namespace null {
@@ -214,16 +333,12 @@ public:
 
 template<typename Handler>
 class CompleteEvent {
-    Handler               &_handler;
-    std::string            _name;
-    std::string            _categories;
-    std::vector<arg_value> _args;
-    bool                   _finished = false;
-    detail::time_point     _start    = detail::clock::now();
+    Handler           *_handler;
+    bool               _finished = false;
+    detail::TraceEvent _event; // N.B. 'ts' is the start time-stamp
 
 public:
-    explicit CompleteEvent(Handler &handler, std::string_view name, std::string_view categories, std::initializer_list<arg_value> args)
-        : _handler{ handler }, _name{ name }, _categories{ categories }, _args{ args } {}
+    explicit CompleteEvent(Handler &handler, const detail::TraceEvent &event) noexcept : _handler{ &handler }, _event{ event } {}
 
     ~CompleteEvent() { finish(); }
 
@@ -231,40 +346,39 @@ public:
     CompleteEvent &
     operator=(const CompleteEvent &)
             = delete;
-    CompleteEvent(CompleteEvent &&) noexcept = default;
+
+    CompleteEvent(CompleteEvent &&other) noexcept : _handler(other._handler), _finished(std::exchange(other._finished, true)), _event(other._event) {}
+
     CompleteEvent &
-    operator=(CompleteEvent &&) noexcept
-            = default;
+    operator=(CompleteEvent &&other) noexcept {
+        finish();
+        _handler  = other._handler;
+        _finished = std::exchange(other._finished, true);
+        _event    = other._event;
+        return *this;
+    }
 
     void
     finish() noexcept {
         if (_finished) {
             return;
         }
-        const auto elapsed = detail::clock::now() - _start;
-        auto       r       = _handler.reserveEvent();
-        r[0].name          = _name;
-        r[0].type          = detail::EventType::Complete;
-        r[0].ts            = std::chrono::duration_cast<std::chrono::microseconds>(_start - _handler.Profiler().start());
-        r[0].dur           = std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
-        r[0].cat           = _categories;
-        r[0].args          = _args;
-        r.publish(1);
+        _event.dur = detail::ticks() - _event.ts;
+        _handler->emit(_event);
         _finished = true;
     }
 };
 
 template<typename Handler>
 class AsyncEvent {
-    Handler    &_handler;
-    bool        _finished = false;
-    int         _id;
-    std::string _name;
+    Handler      *_handler;
+    bool          _finished = false;
+    std::uint32_t _id;
+    std::uint32_t _name;
+    std::uint32_t _categories;
 
 public:
-    explicit AsyncEvent(Handler &handler, std::string_view name, int id, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) : _handler(handler), _id{ id }, _name{ name } {
-        postEvent(detail::EventType::AsyncStart, categories, args);
-    }
+    explicit AsyncEvent(Handler &handler, const detail::TraceEvent &start) noexcept : _handler(&handler), _id{ start.id }, _name{ start.name }, _categories{ start.cat } { _handler->emit(start); }
 
     ~AsyncEvent() { finish(); }
 
@@ -272,10 +386,19 @@ public:
     AsyncEvent &
     operator=(const AsyncEvent &)
             = delete;
-    AsyncEvent(AsyncEvent &&) noexcept = default;
+
+    AsyncEvent(AsyncEvent &&other) noexcept : _handler(other._handler), _finished(std::exchange(other._finished, true)), _id(other._id), _name(other._name), _categories(other._categories) {}
+
     AsyncEvent &
-    operator=(AsyncEvent &&) noexcept
-            = default;
+    operator=(AsyncEvent &&other) noexcept {
+        finish();
+        _handler    = other._handler;
+        _finished   = std::exchange(other._finished, true);
+        _id         = other._id;
+        _name       = other._name;
+        _categories = other._categories;
+        return *this;
+    }
 
     void
     step() noexcept {
@@ -293,26 +416,49 @@ public:
 
 private:
     void
-    postEvent(detail::EventType type, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) noexcept {
-        auto r    = _handler.reserveEvent();
-        r[0].name = _name;
-        r[0].type = type;
-        r[0].id   = _id;
-        r[0].cat  = std::string{ categories };
-        r[0].args = args;
-        r.publish(1);
+    postEvent(detail::EventType type) noexcept {
+        _handler->emit({ .ts = detail::ticks(), .name = _name, .cat = _categories, .id = _id, .type = type });
     }
 };
 
-template<typename TProfiler, typename TWriterType>
+/**
+ * Per-thread event recorder: events are written wait-free into a private ring that is drained asynchronously by the
+ * profiler. Strings are interned via a small direct-mapped per-thread cache, so that the hot path neither locks nor allocates.
+ * Each ring slot is guarded by its own sequence number (seqlock): the writer marks the slot as busy (odd) while copying the
+ * event word-wise and publishes it with the even value '2 * (index + 1)', the drain thread discards slots whose sequence does
+ * not match the expected value before and after copying, i.e. slots that were (being) overwritten by a wrapping writer.
+ */
+template<typename TProfiler>
 class Handler {
-    using this_t = Handler<TProfiler, TWriterType>;
-    TProfiler  &_profiler;
-    TWriterType _writer;
-    int         _nextId = 1;
+    using this_t = Handler<TProfiler>;
+
+    struct CacheEntry {
+        const char   *data = nullptr;
+        std::size_t   size = 0UZ;
+        std::uint32_t id   = 0U;
+    };
+
+    static constexpr std::size_t kEventWords = sizeof(detail::TraceEvent) / sizeof(std::uint64_t);
+    static_assert(sizeof(detail::TraceEvent) % sizeof(std::uint64_t) == 0UZ);
+
+    struct alignas(64) EventSlot {
+        std::array<std::uint64_t, kEventWords> words{}; // N.B. accessed via std::atomic_ref only
+    };
+
+    TProfiler                                    &_profiler;
+    const std::uint32_t                           _tid;
+    const std::thread::id                         _owner = std::this_thread::get_id();
+    const std::uint64_t                           _mask;
+    std::unique_ptr<EventSlot[]>                  _events;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> _sequences;
+    alignas(64) std::atomic<std::uint64_t>        _head = 0U; // written by the owning thread only
+    std::uint64_t                                 _tail = 0U; // drain thread only
+    std::uint32_t                                 _nextId = 1U;
+    std::array<CacheEntry, 256UZ>                 _internCache{};
 
 public:
-    explicit Handler(TProfiler &profiler, TWriterType &&writer) : _profiler(profiler), _writer{ std::move(writer) } {}
+    explicit Handler(TProfiler &profiler, std::uint32_t tid, std::size_t capacity)
+        : _profiler(profiler), _tid(tid), _mask(std::bit_ceil(std::max(capacity, 2UZ)) - 1U), _events(std::make_unique<EventSlot[]>(_mask + 1U)), _sequences(std::make_unique<std::atomic<std::uint64_t>[]>(_mask + 1U)) {}
 
     Handler(const this_t &) = delete;
     this_t &
@@ -328,100 +474,158 @@ public:
         return _profiler;
     }
 
-    auto
-    reserveEvent() noexcept {
-        const auto elapsed = detail::clock::now() - _profiler.start();
-        auto       r       = _writer.reserve(1);
-        r[0].thread_id     = std::this_thread::get_id();
-        r[0].ts            = std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
-        return r;
+    [[nodiscard]] std::uint32_t
+    threadIndex() const noexcept {
+        return _tid;
+    }
+
+    [[nodiscard]] std::thread::id
+    owner() const noexcept {
+        return _owner;
     }
 
+    /// wait-free, overwrites the oldest event if the drain thread lags behind by more than the ring capacity
     void
-    instantEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) noexcept {
-        auto r    = reserveEvent();
-        r[0].name = std::string{ name };
-        r[0].type = detail::EventType::Instant;
-        r[0].cat  = std::string{ categories };
-        r[0].args = args;
-        r.publish(1);
+    emit(detail::TraceEvent event) noexcept {
+        const std::uint64_t head = _head.load(std::memory_order_relaxed);
+        event.tid                = _tid;
+        std::array<std::uint64_t, kEventWords> words;
+        std::memcpy(words.data(), &event, sizeof(event));
+
+        std::atomic<std::uint64_t> &sequence = _sequences[head & _mask];
+        EventSlot                  &slot     = _events[head & _mask];
+        sequence.store(2U * head + 1U, std::memory_order_relaxed); // odd: slot is being written
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0UZ; i < kEventWords; ++i) {
+            std::atomic_ref(slot.words[i]).store(words[i], std::memory_order_relaxed);
+        }
+        sequence.store(2U * (head + 1U), std::memory_order_release);
+        _head.store(head + 1U, std::memory_order_release);
+    }
+
+    /// @return profiler-wide id of 'str', cached per thread (the slot is chosen by the pointer, a hit is confirmed on the content)
+    [[nodiscard]] std::uint32_t
+    intern(std::string_view str) {
+        if (str.empty()) {
+            return 0U;
+        }
+        CacheEntry &entry = _internCache[(std::hash<const void *>{}(str.data()) ^ str.size()) % _internCache.size()];
+        if (entry.id != 0U && entry.size == str.size() && std::memcmp(entry.data, str.data(), str.size()) == 0) { // N.B. re-used buffers may hold different text
+            return entry.id;
+        }
+        const auto [id, stable] = _profiler.intern(str);
+        entry                   = { stable.data(), stable.size(), id };
+        return id;
+    }
+
+    // N.B. not noexcept: interning a not yet cached string (name, categories, argument keys or string values) may allocate
+
+    void
+    instantEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) {
+        emit(makeEvent(detail::EventType::Instant, name, categories, args));
     }
 
     void
-    counterEvent(std::string_view name, std::string_view categories, std::initializer_list<arg_value> args = {}) noexcept {
-        auto r    = reserveEvent();
-        r[0].name = std::string{ name };
-        r[0].type = detail::EventType::Counter;
-        r[0].cat  = std::string{ categories };
-        r[0].args = args;
-        r.publish(1);
+    counterEvent(std::string_view name, std::string_view categories, std::initializer_list<arg_value> args = {}) {
+        emit(makeEvent(detail::EventType::Counter, name, categories, args));
     }
 
     [[nodiscard]] CompleteEvent<this_t>
-    startCompleteEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) noexcept {
-        return CompleteEvent<this_t>{ *this, name, categories, args };
+    startCompleteEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) {
+        return CompleteEvent<this_t>{ *this, makeEvent(detail::EventType::Complete, name, categories, args) };
     }
 
     [[nodiscard]] AsyncEvent<this_t>
-    startAsyncEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) noexcept {
-        const auto id = _nextId;
-        ++_nextId;
-        return AsyncEvent<this_t>{ *this, name, id, categories, args };
+    startAsyncEvent(std::string_view name, std::string_view categories = {}, std::initializer_list<arg_value> args = {}) {
+        detail::TraceEvent start = makeEvent(detail::EventType::AsyncStart, name, categories, args);
+        start.id                 = _nextId++;
+        return AsyncEvent<this_t>{ *this, start };
     }
-};
 
-class Profiler {
-    gr::CircularBuffer<detail::TraceEvent> _buffer;
-    using WriterType  = decltype(_buffer.new_writer());
-    using HandlerType = Handler<Profiler, WriterType>;
-    std::mutex                             _handlers_lock;
-    std::map<std::thread::id, HandlerType> _handlers;
-    std::atomic<bool>                      _finished = false;
-    decltype(_buffer.new_reader())         _reader   = _buffer.new_reader();
-    std::thread                            _event_handler;
-    detail::time_point                     _start = detail::clock::now();
-
-public:
-    explicit Profiler(const Options &options = {}) : _buffer(500000) {
-        _event_handler = std::thread([options, &reader = _reader, &finished = _finished]() {
-            auto          file_name = options.output_file;
-            std::ofstream out_file;
-            if (file_name.empty() && options.output_mode == OutputMode::File) {
-                static std::atomic<int> counter = 0;
-                file_name                       = fmt::format("profile.{}.{}.trace", getpid(), counter++);
-                out_file                        = std::ofstream(file_name, std::ios::out | std::ios::binary);
+    /**
+     * drain thread: appends the events written since the last call to 'out'
+     * @return number of lost (overwritten) events
+     */
+    std::uint64_t
+    drain(std::vector<detail::TraceEvent> &out) {
+        const std::uint64_t capacity = _mask + 1U;
+        const std::uint64_t head     = _head.load(std::memory_order_acquire);
+        std::uint64_t       lost     = 0U;
+        if (head - _tail > capacity) {
+            lost  = head - capacity - _tail;
+            _tail = head - capacity;
+        }
+        std::array<std::uint64_t, kEventWords> words;
+        for (std::uint64_t i = _tail; i < head; ++i) {
+            const std::atomic<std::uint64_t> &sequence = _sequences[i & _mask];
+            EventSlot                        &slot     = _events[i & _mask];
+            const std::uint64_t               expected = 2U * (i + 1U);
+            if (sequence.load(std::memory_order_acquire) != expected) { // already overwritten (or being overwritten) by the writer
+                ++lost;
+                continue;
             }
+            for (std::size_t w = 0UZ; w < kEventWords; ++w) {
+                words[w] = std::atomic_ref(slot.words[w]).load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) != expected) { // torn: overwritten while being copied
+                ++lost;
+                continue;
+            }
+            out.push_back(std::bit_cast<detail::TraceEvent>(words));
+        }
+        _tail = head;
+        return lost;
+    }
 
-            std::ostream &out_stream = options.output_mode == OutputMode::File ? out_file : std::cout;
-            const int     pid        = getpid();
-
-            // assign numerical values to threads as we see them
-            std::unordered_map<std::thread::id, int> mapped_threads;
-            bool                                     seen_finished = false;
-
-            fmt::print(out_stream, "[\n");
-            bool is_first = true;
-            while (!seen_finished) {
-                seen_finished = finished;
-                while (reader.available() > 0) {
-                    gr::ConsumableSpan auto event = reader.get(1);
-                    auto                    it    = mapped_threads.find(event[0].thread_id);
-                    if (it == mapped_threads.end()) {
-                        it = mapped_threads.emplace(event[0].thread_id, static_cast<int>(mapped_threads.size())).first;
-                    }
-                    if (!is_first) {
-                        fmt::print(out_stream, ",\n{}", event[0].toJSON(pid, it->second));
-                    } else {
-                        fmt::print(out_stream, "{}", event[0].toJSON(pid, it->second));
-                    }
-                    is_first    = false;
-                    std::ignore = event.consume(1);
-                }
+private:
+    /// numeric argument values are stored inline, only keys and string values are interned (i.e. should stem from a bounded set)
+    [[nodiscard]] detail::TraceEvent
+    makeEvent(detail::EventType type, std::string_view name, std::string_view categories, std::initializer_list<arg_value> args) {
+        detail::TraceEvent event{ .ts = detail::ticks(), .name = intern(name), .cat = intern(categories), .type = type };
+        for (std::size_t i = 0UZ; const auto &[key, value] : args) {
+            if (i == detail::kMaxArgs) {
+                break;
             }
-            fmt::print(out_stream, "\n]\n");
-        });
+            event.argKeys[i] = intern(key);
+            if (const auto *str = std::get_if<std::string>(&value)) {
+                event.argKinds[i]  = detail::ArgKind::String;
+                event.argValues[i] = intern(*str);
+            } else if (const auto *number = std::get_if<double>(&value)) {
+                event.argKinds[i]  = detail::ArgKind::Double;
+                event.argValues[i] = std::bit_cast<std::uint64_t>(*number);
+            } else {
+                event.argKinds[i]  = detail::ArgKind::Int;
+                event.argValues[i] = std::bit_cast<std::uint64_t>(static_cast<std::int64_t>(std::get<int>(value)));
+            }
+            ++i;
+        }
+        return event;
+    }
+};
 
+class Profiler {
+    using HandlerType = Handler<Profiler>;
+    static constexpr std::chrono::milliseconds kDrainInterval{ 10 };
+
+    Options                                   _options;
+    std::mutex                                _handlers_lock; // registration of new threads and draining only
+    std::vector<std::unique_ptr<HandlerType>> _handlers;
+    std::mutex                                _strings_lock;
+    std::vector<std::unique_ptr<std::string>> _strings; // N.B. stable addresses, referenced by the per-thread intern caches
+    std::unordered_map<std::string_view, std::uint32_t> _string_ids;
+    std::atomic<std::uint64_t>                _lost     = 0U;
+    std::atomic<bool>                         _finished = false;
+    std::uint64_t                             _instance = nextInstanceId();
+    detail::time_point                        _start    = detail::clock::now();
+    detail::ClockSync                         _startSync;
+    std::thread                               _event_handler;
+
+public:
+    explicit Profiler(const Options &options = {}) : _options(options) {
+        _strings.push_back(std::make_unique<std::string>()); // id 0 <-> empty string
         reset();
+        _event_handler = std::thread([this] { drainLoop(); });
     }
 
     ~Profiler() {
@@ -436,20 +640,125 @@ public:
 
     void
     reset() noexcept {
-        _start = detail::clock::now();
+        _start     = detail::clock::now();
+        _startSync = detail::ClockSync::now();
+    }
+
+    /// @return number of events lost because a thread's ring was overwritten before it was drained
+    [[nodiscard]] std::uint64_t
+    lostEvents() const noexcept {
+        return _lost.load();
+    }
+
+    /// @return interned id and the stable copy of 'str'
+    std::pair<std::uint32_t, std::string_view>
+    intern(std::string_view str) {
+        std::lock_guard lock{ _strings_lock };
+        if (auto it = _string_ids.find(str); it != _string_ids.end()) {
+            return { it->second, it->first };
+        }
+        const auto id = static_cast<std::uint32_t>(_strings.size());
+        _strings.push_back(std::make_unique<std::string>(str));
+        _string_ids.emplace(*_strings.back(), id);
+        return { id, *_strings.back() };
     }
 
-    Handler<Profiler, WriterType> &
+    Handler<Profiler> &
     forThisThread() {
-        const auto            this_id = std::this_thread::get_id();
+        struct ThreadCache {
+            std::uint64_t instance = 0U;
+            HandlerType  *handler  = nullptr;
+        };
+        thread_local ThreadCache cache; // fast path w/o locking, keyed by the unique instance id rather than the (re-usable) address
+        if (cache.instance == _instance) {
+            return *cache.handler;
+        }
         const std::lock_guard lock{ _handlers_lock };
-        auto                  it = _handlers.find(this_id);
-        if (it == _handlers.end()) {
-            auto [new_it, _] = _handlers.try_emplace(this_id, *this, _buffer.new_writer());
-            it               = new_it;
+        // N.B. a (pool) thread alternating between profilers misses the single-entry cache -> re-use its existing handler
+        if (const auto it = std::ranges::find(_handlers, std::this_thread::get_id(), &HandlerType::owner); it != _handlers.end()) {
+            cache = { _instance, it->get() };
+            return *cache.handler;
+        }
+        _handlers.push_back(std::make_unique<HandlerType>(*this, static_cast<std::uint32_t>(_handlers.size()), _options.events_per_thread));
+        cache = { _instance, _handlers.back().get() };
+        return *cache.handler;
+    }
+
+private:
+    static std::uint64_t
+    nextInstanceId() noexcept {
+        static std::atomic<std::uint64_t> counter = 0U;
+        return ++counter;
+    }
+
+    void
+    drainLoop() {
+        using enum OutputMode;
+        std::ofstream out_file;
+        if (_options.output_mode != StdOut) {
+            static std::atomic<int> counter   = 0;
+            const auto              file_name = _options.output_file.empty() ? fmt::format("profile.{}.{}.{}", getpid(), counter++, _options.output_mode == BinaryFile ? "grtrace" : "trace") : _options.output_file;
+            out_file                          = std::ofstream(file_name, std::ios::out | std::ios::binary);
+        }
+        std::ostream &out_stream = _options.output_mode == StdOut ? std::cout : out_file;
+        const int     pid        = getpid();
+        const bool    binary     = _options.output_mode == BinaryFile;
+
+        std::vector<detail::TraceEvent> events;
+        std::vector<std::string>        strings; // JSON mode: local copy of the interned strings
+        std::size_t                     nStringsWritten = 1UZ;
+        bool                            is_first        = true;
+        if (binary) {
+            out_stream.write(detail::kMagic.data(), detail::kMagic.size());
+            detail::writeBlock(out_stream, detail::BlockKind::Clock, std::span(&_startSync, 1UZ));
+        } else {
+            fmt::print(out_stream, "[\n");
         }
 
-        return it->second;
+        bool seen_finished = false;
+        while (!seen_finished) {
+            seen_finished = _finished;
+            if (!seen_finished) {
+                std::this_thread::sleep_for(kDrainInterval);
+            }
+
+            events.clear();
+            {
+                const std::lock_guard lock{ _handlers_lock };
+                for (auto &handler : _handlers) {
+                    _lost += handler->drain(events);
+                }
+            }
+            {
+                const std::lock_guard lock{ _strings_lock }; // N.B. events are drained first, thus all referenced strings are known
+                for (; nStringsWritten < _strings.size(); ++nStringsWritten) {
+                    const auto id = static_cast<std::uint32_t>(nStringsWritten);
+                    if (binary) {
+                        detail::writeBlock(out_stream, detail::BlockKind::String, std::span(&id, 1UZ), *_strings[nStringsWritten]);
+                    } else {
+                        strings.resize(nStringsWritten);
+                        strings.push_back(*_strings[nStringsWritten]);
+                    }
+                }
+            }
+            const auto sync = detail::ClockSync::now();
+            if (binary) {
+                if (!events.empty()) {
+                    detail::writeBlock(out_stream, detail::BlockKind::Events, std::span<const detail::TraceEvent>(events));
+                }
+                detail::writeBlock(out_stream, detail::BlockKind::Clock, std::span(&sync, 1UZ));
+            } else {
+                const detail::TickConverter converter(_startSync, sync);
+                for (const auto &event : events) {
+                    fmt::print(out_stream, "{}{}", is_first ? "" : ",\n", detail::toJSON(event, strings, converter, pid));
+                    is_first = false;
+                }
+            }
+        }
+        if (!binary) {
+            fmt::print(out_stream, "\n]\n");
+        }
+        out_stream.flush();
     }
 };
 
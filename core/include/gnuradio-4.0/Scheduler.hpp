@@ -2,6 +2,8 @@
 #define GNURADIO_SCHEDULER_HPP
 
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <set>
 #include <source_location>
 #include <thread>
@@ -25,6 +27,10 @@ enum ExecutionPolicy { singleThreaded, multiThreaded };
 
 constexpr std::chrono::milliseconds kMessagePollInterval{ 10 };
 
+namespace property {
+inline static const char *kEdgeTelemetry = "EdgeTelemetry"; ///< sampled per-edge buffer occupancy and back-pressure statistics, @see gr::EdgeTelemetry, 'Set' w/ { "reset", true } resets them
+} // namespace property
+
 template<typename Derived, ExecutionPolicy execution = ExecutionPolicy::singleThreaded, profiling::ProfilerLike TProfiler = profiling::null::Profiler>
 class SchedulerBase : public Block<Derived> {
     friend class lifecycle::StateMachine<Derived>;
@@ -43,6 +49,29 @@ protected:
     std::vector<gr::Message>         _pendingMessagesToChildren;
     bool                             _messagePortsConnected = false;
 
+    std::chrono::steady_clock::time_point _lastEdgeTelemetrySample{};
+
+    struct JobControl { // hand-shake to park an individual job at its next iteration boundary while the graph is being modified
+        std::mutex              mutex;
+        std::condition_variable cv;
+        std::atomic_bool        pauseRequested = false;
+        bool                    parked         = false;
+        bool                    finished       = false;
+    };
+
+    struct GraphChange {
+        enum class Type { AddBlock, RemoveBlock, AddEdge, RemoveEdge };
+        Type                         type;
+        std::unique_ptr<BlockModel>  newBlock{};      ///< AddBlock: the block to be added
+        const void                  *block  = nullptr; ///< RemoveBlock: the block to be removed, Add/RemoveEdge: the destination block
+        const void                  *source = nullptr; ///< Add/RemoveEdge: the source block whose output buffer gains/loses a reader
+        std::function<bool(Graph &)> apply{};         ///< Add/RemoveEdge: performs the (dis-)connection
+    };
+
+    std::vector<std::unique_ptr<JobControl>> _jobControls;
+    std::mutex                               _graphChangesMutex;
+    std::vector<GraphChange>                 _pendingGraphChanges;
+
 public:
     using base_t = Block<Derived>;
 
@@ -53,7 +82,9 @@ public:
 
     explicit SchedulerBase(gr::Graph &&graph, std::shared_ptr<BasicThreadPool> thread_pool = std::make_shared<BasicThreadPool>("simple-scheduler-pool", thread_pool::CPU_BOUND),
                            const profiling::Options &profiling_options = {})
-        : _graph(std::move(graph)), _profiler{ profiling_options }, _profiler_handler{ _profiler.forThisThread() }, _pool(std::move(thread_pool)) {}
+        : _graph(std::move(graph)), _profiler{ profiling_options }, _profiler_handler{ _profiler.forThisThread() }, _pool(std::move(thread_pool)) {
+        this->propertyCallbacks.emplace(property::kEdgeTelemetry, &SchedulerBase::propertyCallbackEdgeTelemetry);
+    }
 
     ~SchedulerBase() {
         if (this->state() == lifecycle::RUNNING) {
@@ -77,15 +108,18 @@ public:
     }
 
     void
-    connectBlockMessagePorts() {
-        _graph.forEachBlock([this](auto &block) {
-            if (ConnectionResult::SUCCESS != _toChildMessagePort.connect(*block.msgIn)) {
-                this->emitErrorMessage("connectBlockMessagePorts()", fmt::format("Failed to connect scheduler input message port to child '{}'", block.uniqueName()));
-            }
+    connectBlockMessagePorts(BlockModel &block) {
+        if (ConnectionResult::SUCCESS != _toChildMessagePort.connect(*block.msgIn)) {
+            this->emitErrorMessage("connectBlockMessagePorts()", fmt::format("Failed to connect scheduler input message port to child '{}'", block.uniqueName()));
+        }
 
-            auto buffer = _fromChildMessagePort.buffer();
-            block.msgOut->setBuffer(buffer.streamBuffer, buffer.tagBuffer);
-        });
+        auto buffer = _fromChildMessagePort.buffer();
+        block.msgOut->setBuffer(buffer.streamBuffer, buffer.tagBuffer);
+    }
+
+    void
+    connectBlockMessagePorts() {
+        _graph.forEachBlock([this](BlockModel &block) { connectBlockMessagePorts(block); });
 
         // Forward any messages to children that were received before the scheduler was initialised
         _messagePortsConnected = true;
@@ -112,6 +146,8 @@ public:
     void
     processScheduledMessages() {
         base_t::processScheduledMessages(); // filters messages and calls own property handler
+        applyGraphChanges();
+        sampleEdgeTelemetry();
 
         // Process messages in the graph
         _graph.processScheduledMessages();
@@ -147,6 +183,86 @@ public:
         return _graph;
     }
 
+    /**
+     * Runtime graph modifications: the following methods are thread-safe and may be called while the graph is executing.
+     * The changes are queued and applied in order at the next safe point of the scheduler's control loop (or during init()).
+     * For multi-threaded execution, only the jobs containing blocks whose ports or job membership change -- including the sources
+     * whose output buffers gain or lose a reader -- are parked for the duration of the update while all other jobs continue. New readers attach to a live buffer at its current write position,
+     * i.e. they receive the samples published after the change was applied.
+     * N.B. the returned block references remain valid until the block is removed
+     */
+    template<BlockLike TBlock>
+    TBlock &
+    emplaceBlock(const property_map &initialSettings = {}) {
+        static_assert(std::is_same_v<TBlock, std::remove_reference_t<TBlock>>);
+        auto  block = std::make_unique<BlockWrapper<TBlock>>();
+        auto *raw   = static_cast<TBlock *>(block->raw());
+        if (const auto failed = raw->settings().set(initialSettings); !failed.empty()) {
+            std::vector<std::string> keys;
+            for (const auto &pair : failed) {
+                keys.push_back(pair.first);
+            }
+            throw std::invalid_argument(fmt::format("initial Block settings could not be applied successfully - mismatched keys or value-type: {}\n", fmt::join(keys, ", ")));
+        }
+        queueGraphChange({ .type = GraphChange::Type::AddBlock, .newBlock = std::move(block) });
+        return *raw;
+    }
+
+    BlockModel &
+    addBlock(std::unique_ptr<BlockModel> block) {
+        BlockModel &blockRef = *block;
+        queueGraphChange({ .type = GraphChange::Type::AddBlock, .newBlock = std::move(block) });
+        return blockRef;
+    }
+
+    template<typename TBlock>
+        requires(!std::is_pointer_v<std::remove_cvref_t<TBlock>>)
+    void
+    removeBlock(TBlock &block) {
+        queueGraphChange({ .type = GraphChange::Type::RemoveBlock, .block = std::addressof(block) });
+    }
+
+    template<typename Source, typename Destination>
+        requires(!std::is_pointer_v<std::remove_cvref_t<Source>> && !std::is_pointer_v<std::remove_cvref_t<Destination>>)
+    void
+    connect(Source &source, PortIndexDefinition<std::size_t> sourcePort, Destination &destination, PortIndexDefinition<std::size_t> destinationPort, std::size_t minBufferSize = 65536,
+            std::int32_t weight = 0, std::string_view edgeName = "unnamed edge") {
+        queueConnect(source, std::move(sourcePort), destination, std::move(destinationPort), minBufferSize, weight, edgeName);
+    }
+
+    template<typename Source, typename Destination>
+        requires(!std::is_pointer_v<std::remove_cvref_t<Source>> && !std::is_pointer_v<std::remove_cvref_t<Destination>>)
+    void
+    connect(Source &source, PortIndexDefinition<std::string> sourcePort, Destination &destination, PortIndexDefinition<std::string> destinationPort, std::size_t minBufferSize = 65536,
+            std::int32_t weight = 0, std::string_view edgeName = "unnamed edge") {
+        queueConnect(source, std::move(sourcePort), destination, std::move(destinationPort), minBufferSize, weight, edgeName);
+    }
+
+    template<typename Source, typename Destination>
+        requires(!std::is_pointer_v<std::remove_cvref_t<Source>> && !std::is_pointer_v<std::remove_cvref_t<Destination>>)
+    void
+    removeEdge(Source &source, PortIndexDefinition<std::size_t> sourcePort, Destination &destination, PortIndexDefinition<std::size_t> destinationPort) {
+        queueRemoveEdge(source, std::move(sourcePort), destination, std::move(destinationPort));
+    }
+
+    template<typename Source, typename Destination>
+        requires(!std::is_pointer_v<std::remove_cvref_t<Source>> && !std::is_pointer_v<std::remove_cvref_t<Destination>>)
+    void
+    removeEdge(Source &source, PortIndexDefinition<std::string> sourcePort, Destination &destination, PortIndexDefinition<std::string> destinationPort) {
+        queueRemoveEdge(source, std::move(sourcePort), destination, std::move(destinationPort));
+    }
+
+    [[nodiscard]] property_map
+    edgeTelemetry() const {
+        property_map edges;
+        _graph.forEachEdge([&edges](const Edge &edge) {
+            if (!edge.bufferTelemetry().label.empty()) {
+                edges.insert_or_assign(edge.bufferTelemetry().label, edge.bufferTelemetry().get());
+            }
+        });
+        return edges;
+    }
+
     std::expected<void, std::string>
     runAndWait() {
         [[maybe_unused]] const auto pe = this->_profiler_handler.startCompleteEvent("scheduler_base.runAndWait");
@@ -228,9 +344,163 @@ protected:
         if (!result) {
             this->emitErrorMessage("init()", "Failed to connect blocks in graph");
         }
+        applyGraphChanges(false); // N.B. job lists are generated afterwards by the derived scheduler
         connectBlockMessagePorts();
     }
 
+    void
+    graphChanged() {} // hook for derived schedulers that keep their own view on the graph topology
+
+    void
+    queueGraphChange(GraphChange &&change) {
+        std::scoped_lock lock{ _graphChangesMutex };
+        _pendingGraphChanges.push_back(std::move(change));
+    }
+
+    template<typename Source, typename Destination, typename TPortDefinition>
+    void
+    queueConnect(Source &source, TPortDefinition sourcePort, Destination &destination, TPortDefinition destinationPort, std::size_t minBufferSize, std::int32_t weight, std::string_view edgeName) {
+        queueGraphChange({ .type   = GraphChange::Type::AddEdge,
+                           .block  = std::addressof(destination),
+                           .source = std::addressof(source),
+                           .apply = [&source, sourcePort, &destination, destinationPort, minBufferSize, weight, edgeName = std::string(edgeName)](Graph &graph) {
+                               return graph.connect(source, sourcePort, destination, destinationPort, minBufferSize, weight, edgeName) == ConnectionResult::SUCCESS;
+                           } });
+    }
+
+    template<typename Source, typename Destination, typename TPortDefinition>
+    void
+    queueRemoveEdge(Source &source, TPortDefinition sourcePort, Destination &destination, TPortDefinition destinationPort) {
+        queueGraphChange({ .type   = GraphChange::Type::RemoveEdge,
+                           .block  = std::addressof(destination),
+                           .source = std::addressof(source),
+                           .apply  = [&source, sourcePort, &destination, destinationPort](Graph &graph) { return graph.removeEdge(source, sourcePort, destination, destinationPort); } });
+    }
+
+    [[nodiscard]] BlockModel *
+    findBlockModel(const void *block) {
+        for (const auto &blockPtr : _graph.blocks()) {
+            if (blockPtr.get() == block || blockPtr->raw() == block) {
+                return blockPtr.get();
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] std::size_t
+    jobIndexOf(const BlockModel *block) const {
+        for (std::size_t jobIndex = 0UZ; jobIndex < _job_lists.size(); ++jobIndex) {
+            if (std::ranges::find(_job_lists[jobIndex], block) != _job_lists[jobIndex].end()) {
+                return jobIndex;
+            }
+        }
+        return meta::invalid_index;
+    }
+
+    /// applies the queued graph changes (N.B. must be called from the scheduler's control thread)
+    void
+    applyGraphChanges(bool updateJobs = true) {
+        std::vector<GraphChange> changes;
+        {
+            std::scoped_lock lock{ _graphChangesMutex };
+            changes.swap(_pendingGraphChanges);
+        }
+        if (changes.empty()) {
+            return;
+        }
+        [[maybe_unused]] const auto pe = _profiler_handler.startCompleteEvent("scheduler_base.applyGraphChanges");
+        updateJobs                     = updateJobs && executionPolicy() == multiThreaded;
+
+        // park only the jobs executing blocks whose input ports or job membership are modified, as well as the jobs of the
+        // source blocks whose output buffers gain or lose a reader
+        // N.B. the writer iterates the buffer's reader list without taking a snapshot -> swapping the list while the source is
+        // publishing would race (and could free the list while being iterated)
+        std::set<std::size_t> affectedJobs;
+        std::size_t           targetJob = meta::invalid_index; // job that receives the new blocks
+        if (updateJobs) {
+            auto addJobOf = [this, &affectedJobs](const BlockModel *block) {
+                if (const std::size_t jobIndex = jobIndexOf(block); jobIndex != meta::invalid_index) {
+                    affectedJobs.insert(jobIndex);
+                }
+            };
+            for (const GraphChange &change : changes) {
+                if (change.type == GraphChange::Type::AddBlock) {
+                    if (targetJob == meta::invalid_index && !_job_lists.empty()) {
+                        targetJob = static_cast<std::size_t>(std::ranges::distance(_job_lists.begin(), std::ranges::min_element(_job_lists, {}, &std::vector<BlockModel *>::size)));
+                        affectedJobs.insert(targetJob);
+                    }
+                } else if (const BlockModel *block = findBlockModel(change.block); block != nullptr) {
+                    addJobOf(block);
+                    if (change.type == GraphChange::Type::RemoveBlock) {
+                        _graph.forEachEdge([&addJobOf, block](const Edge &edge) {
+                            if (&edge.sourceBlock() == block) {
+                                addJobOf(&edge.destinationBlock());
+                            } else if (&edge.destinationBlock() == block) {
+                                addJobOf(&edge.sourceBlock());
+                            }
+                        });
+                    } else if (const BlockModel *source = findBlockModel(change.source); source != nullptr) {
+                        addJobOf(source);
+                    }
+                }
+            }
+            parkJobs(affectedJobs);
+        }
+
+        for (GraphChange &change : changes) {
+            try {
+                switch (change.type) {
+                case GraphChange::Type::AddBlock: {
+                    BlockModel &block = _graph.addBlock(std::move(change.newBlock));
+                    if (_messagePortsConnected) {
+                        connectBlockMessagePorts(block);
+                    }
+                    if (this->state() == lifecycle::State::RUNNING) {
+                        this->emitErrorMessageIfAny("applyGraphChanges() -> LifecycleState", block.changeState(lifecycle::State::RUNNING));
+                    }
+                    if (updateJobs) {
+                        if (targetJob == meta::invalid_index) { // N.B. no jobs -> nothing is executing and the job list can be safely extended
+                            targetJob = _job_lists.size();
+                            _job_lists.emplace_back();
+                        }
+                        _job_lists[targetJob].push_back(&block);
+                    }
+                } break;
+                case GraphChange::Type::RemoveBlock: {
+                    BlockModel *block = findBlockModel(change.block);
+                    if (block == nullptr) {
+                        this->emitErrorMessage("applyGraphChanges()", "cannot remove block that is not part of the graph");
+                        break;
+                    }
+                    if (lifecycle::isActive(block->state())) {
+                        this->emitErrorMessageIfAny("applyGraphChanges() -> LifecycleState", block->changeState(lifecycle::State::REQUESTED_STOP));
+                        if (!block->isBlocking()) {
+                            this->emitErrorMessageIfAny("applyGraphChanges() -> LifecycleState", block->changeState(lifecycle::State::STOPPED));
+                        }
+                    }
+                    for (auto &job : _job_lists) {
+                        std::erase(job, block);
+                    }
+                    _graph.removeBlock(*block);
+                } break;
+                case GraphChange::Type::AddEdge:
+                case GraphChange::Type::RemoveEdge:
+                    if (!change.apply(_graph)) {
+                        this->emitErrorMessage("applyGraphChanges()", change.type == GraphChange::Type::AddEdge ? "failed to connect blocks" : "failed to remove edge (unknown edge)");
+                    }
+                    break;
+                }
+            } catch (const std::exception &e) {
+                this->emitErrorMessage("applyGraphChanges()", e.what());
+            }
+        }
+
+        if (updateJobs) {
+            resumeJobs(affectedJobs, targetJob);
+        }
+        static_cast<Derived *>(this)->graphChanged();
+    }
+
 private:
     void
     stop() {
@@ -299,23 +569,141 @@ private:
     void
     runOnPool(const std::vector<std::vector<BlockModel *>> &jobs, const std::function<work::Result(const std::span<BlockModel *const> &)> work_function) {
         [[maybe_unused]] const auto pe = _profiler_handler.startCompleteEvent("scheduler_base.runOnPool");
-        _running_jobs                  = jobs.size();
-        for (auto &jobset : jobs) {
-            _pool->execute([this, &jobset, work_function]() { poolWorker([&work_function, &jobset]() { return work_function(jobset); }); });
+        _jobControls.clear();
+        for (std::size_t jobIndex = 0UZ; jobIndex < jobs.size(); ++jobIndex) {
+            _jobControls.push_back(std::make_unique<JobControl>());
+        }
+        _running_jobs = jobs.size();
+        for (std::size_t jobIndex = 0UZ; jobIndex < jobs.size(); ++jobIndex) {
+            launchJob(jobs[jobIndex], *_jobControls[jobIndex], work_function);
+        }
+    }
+
+    void
+    launchJob(const std::vector<BlockModel *> &jobset, JobControl &control, const std::function<work::Result(const std::span<BlockModel *const> &)> &work_function) {
+        _pool->execute([this, &jobset, &control, work_function]() { poolWorker([&work_function, &jobset]() { return work_function(jobset); }, control); });
+    }
+
+    /// requests the given jobs to park at their next iteration boundary and waits until they did (or finished)
+    void
+    parkJobs(const std::set<std::size_t> &jobs) {
+        for (const std::size_t jobIndex : jobs) {
+            if (jobIndex < _jobControls.size()) {
+                std::scoped_lock lock{ _jobControls[jobIndex]->mutex };
+                _jobControls[jobIndex]->pauseRequested = true;
+            }
+        }
+        for (const std::size_t jobIndex : jobs) {
+            if (jobIndex < _jobControls.size()) {
+                JobControl       &control = *_jobControls[jobIndex];
+                std::unique_lock lock{ control.mutex };
+                control.cv.wait(lock, [&control] { return control.parked || control.finished; });
+            }
+        }
+    }
+
+    /// releases the parked jobs and (re-)launches jobs that received new blocks but have already finished (or never ran)
+    void
+    resumeJobs(const std::set<std::size_t> &jobs, std::size_t targetJob) {
+        for (const std::size_t jobIndex : jobs) {
+            if (jobIndex < _jobControls.size()) {
+                {
+                    std::scoped_lock lock{ _jobControls[jobIndex]->mutex };
+                    _jobControls[jobIndex]->pauseRequested = false;
+                }
+                _jobControls[jobIndex]->cv.notify_all();
+            }
+        }
+        if (targetJob == meta::invalid_index || this->state() != lifecycle::State::RUNNING) {
+            return; // N.B. not yet started or paused -> the new blocks are executed on start()/resume()
         }
+        if (targetJob >= _jobControls.size()) {
+            _jobControls.push_back(std::make_unique<JobControl>());
+            _jobControls.back()->finished = true;
+        }
+        JobControl &control = *_jobControls[targetJob];
+        {
+            std::scoped_lock lock{ control.mutex };
+            if (!control.finished) {
+                return;
+            }
+            control.finished = false;
+        }
+        _running_jobs.fetch_add(1);
+        launchJob(_job_lists[targetJob], control, [this](auto &job) { return this->workOnce(job); });
     }
 
+    /// samples the buffer occupancy of all edges (rate-limited to kMessagePollInterval) and exports the fill levels as profiler counter events
     void
-    poolWorker(const std::function<work::Result()> &work) {
+    sampleEdgeTelemetry() {
+        const auto now = std::chrono::steady_clock::now();
+        if (now - _lastEdgeTelemetrySample < kMessagePollInterval) {
+            return;
+        }
+        _lastEdgeTelemetrySample = now;
+        for (Edge &edge : _graph.edges()) {
+            if (edge.sampleBufferTelemetry()) {
+                if constexpr (!std::is_same_v<TProfiler, profiling::null::Profiler>) {
+                    _profiler_handler.counterEvent(edge.bufferTelemetry().label, "buffer", { { "fill_level", static_cast<double>(edge.bufferTelemetry().fillLevel) } });
+                }
+            }
+        }
+        if (const auto it = this->propertySubscriptions.find(property::kEdgeTelemetry); it != this->propertySubscriptions.end() && !it->second.empty()) {
+            this->notifyListeners(property::kEdgeTelemetry, edgeTelemetry());
+        }
+    }
+
+    std::optional<Message>
+    propertyCallbackEdgeTelemetry(std::string_view propertyName, Message message) {
+        using enum gr::message::Command;
+        assert(propertyName == property::kEdgeTelemetry);
+
+        if (message.cmd == Set || message.cmd == Get) {
+            property_map telemetry = edgeTelemetry();
+            if (message.cmd == Set && message.data.has_value() && message.data->contains("reset") && std::holds_alternative<bool>(message.data->at("reset")) && std::get<bool>(message.data->at("reset"))) {
+                for (Edge &edge : _graph.edges()) {
+                    edge._telemetry = EdgeTelemetry{ .label = edge.bufferTelemetry().label };
+                }
+            }
+            message.data = std::move(telemetry);
+            return message;
+        } else if (message.cmd == Subscribe) {
+            if (!message.clientRequestID.empty()) {
+                this->propertySubscriptions[std::string(propertyName)].insert(message.clientRequestID);
+            }
+            return std::nullopt;
+        } else if (message.cmd == Unsubscribe) {
+            this->propertySubscriptions[std::string(propertyName)].erase(message.clientRequestID);
+            return std::nullopt;
+        }
+
+        throw gr::exception(fmt::format("scheduler {} property {} does not implement command {}, msg: {}", this->unique_name, propertyName, message.cmd, message));
+    }
+
+    void
+    poolWorker(const std::function<work::Result()> &work, JobControl &control) {
         auto &profiler_handler   = _profiler.forThisThread();
         bool  something_happened = true;
         while (something_happened && !_stop_requested) {
+            if (control.pauseRequested.load(std::memory_order_acquire)) { // graph is being modified -> park until released
+                std::unique_lock lock{ control.mutex };
+                control.parked = true;
+                control.cv.notify_all();
+                control.cv.wait(lock, [&control] { return !control.pauseRequested.load(std::memory_order_acquire); });
+                control.parked = false;
+                continue;
+            }
             auto                   pe         = profiler_handler.startCompleteEvent("scheduler_base.work");
             const gr::work::Result workResult = work();
             pe.finish();
 
             something_happened = workResult.status == work::Status::OK;
         }
+        {
+            std::scoped_lock lock{ control.mutex };
+            control.finished = true;
+        }
+        control.cv.notify_all();
         _running_jobs.fetch_sub(1);
         _running_jobs.notify_all();
     }
@@ -362,12 +750,10 @@ private:
         requires(base_t::executionPolicy() == ExecutionPolicy::singleThreaded)
     {
         work::Result result;
-        auto         blocklist = std::span{ this->_graph.blocks() };
-
         do {
-            this->processScheduledMessages();
+            this->processScheduledMessages(); // N.B. may modify the graph -> block list is re-evaluated every iteration
             if (this->state() == lifecycle::State::RUNNING) {
-                result = this->workOnce(blocklist);
+                result = this->workOnce(std::span{ this->_graph.blocks() });
                 if (result.status == work::Status::DONE) {
                     this->emitErrorMessageIfAny("runSingleThreaded() -> LifecycleState (DONE)", this->changeStateTo(lifecycle::State::REQUESTED_STOP));
                 } else if (result.status == work::Status::ERROR) {
@@ -410,43 +796,8 @@ private:
     void
     init() {
         [[maybe_unused]] const auto pe = this->_profiler_handler.startCompleteEvent("breadth_first.init");
-        using block_t                  = BlockModel *;
         base_t::init();
-        // calculate adjacency list
-        std::map<block_t, std::vector<block_t>> _adjacency_list{};
-        std::vector<block_t>                    _source_blocks{};
-        // compute the adjacency list
-        std::set<block_t> block_reached;
-        for (auto &e : this->_graph.edges()) {
-            _adjacency_list[e._sourceBlock].push_back(e._destinationBlock);
-            _source_blocks.push_back(e._sourceBlock);
-            block_reached.insert(e._destinationBlock);
-        }
-        _source_blocks.erase(std::remove_if(_source_blocks.begin(), _source_blocks.end(), [&block_reached](auto currentBlock) { return block_reached.contains(currentBlock); }), _source_blocks.end());
-        // traverse graph
-        std::queue<block_t> queue{};
-        std::set<block_t>   reached;
-        // add all source blocks to queue
-        for (block_t sourceBlock : _source_blocks) {
-            if (!reached.contains(sourceBlock)) {
-                queue.push(sourceBlock);
-            }
-            reached.insert(sourceBlock);
-        }
-        // process all blocks, adding all unvisited child blocks to the queue
-        while (!queue.empty()) {
-            block_t currentBlock = queue.front();
-            queue.pop();
-            _blocklist.push_back(currentBlock);
-            if (_adjacency_list.contains(currentBlock)) { // node has outgoing edges
-                for (auto &dst : _adjacency_list.at(currentBlock)) {
-                    if (!reached.contains(dst)) { // detect cycles. this could be removed if we guarantee cycle free graphs earlier
-                        queue.push(dst);
-                        reached.insert(dst);
-                    }
-                }
-            }
-        }
+        _blocklist                     = breadthFirstOrder(this->_graph);
         // generate job list
         if constexpr (base_t::executionPolicy() == ExecutionPolicy::multiThreaded) {
             const auto n_batches = std::min(static_cast<std::size_t>(this->_pool->maxThreads()), _blocklist.size());
@@ -462,16 +813,20 @@ private:
         }
     }
 
+    void
+    graphChanged() {
+        _blocklist = breadthFirstOrder(this->_graph);
+    }
+
     void
     runSingleThreaded()
         requires(base_t::executionPolicy() == ExecutionPolicy::singleThreaded)
     {
         work::Result result;
-        auto         blocklist = std::span{ this->_blocklist };
         do {
-            this->processScheduledMessages();
+            this->processScheduledMessages(); // N.B. may modify the graph -> block list is re-evaluated every iteration
             if (this->state() == lifecycle::State::RUNNING) {
-                result = this->workOnce(blocklist);
+                result = this->workOnce(std::span{ this->_blocklist });
                 if (result.status == work::Status::DONE) {
                     this->emitErrorMessageIfAny("runSingleThreaded() -> LifecycleState (DONE)", this->changeStateTo(lifecycle::State::REQUESTED_STOP));
                 } else if (result.status == work::Status::ERROR) {
@@ -0,0 +1,286 @@
+#ifndef GNURADIO_SCHEDULING_DOMAIN_HPP
+#define GNURADIO_SCHEDULING_DOMAIN_HPP
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/LifeCycle.hpp>
+#include <gnuradio-4.0/Message.hpp>
+#include <gnuradio-4.0/Port.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/Settings.hpp>
+#include <gnuradio-4.0/thread/thread_affinity.hpp>
+#include <gnuradio-4.0/thread/thread_pool.hpp>
+
+namespace gr {
+
+/**
+ * A sub-graph that is executed as an isolated scheduling domain: it owns its own scheduler instance `TScheduler` (and thus its
+ * own ExecutionPolicy) and thread pool, while appearing as a regular block inside the parent graph.
+ *
+ * Selected ports of the inner blocks are exposed via `exposeInput(...)`/`exposeOutput(...)` and connected by the parent graph
+ * like any other block port, i.e. samples and tags cross the domain boundary through the usual lock-free port buffers.
+ * The inner scheduler runs on a dedicated thread that is started/stopped/paused with the parent's lifecycle and pinned to the
+ * affinity mask of the domain's thread pool (if any). Control messages are exchanged through the inner scheduler's message
+ * ports: lifecycle changes are forwarded as `kLifeCycleState` messages, other messages from the parent are relayed to the inner
+ * blocks, and messages emitted by the inner blocks are forwarded to the parent.
+ *
+ * @code
+ * gr::Graph  frontEnd;
+ * auto      &filter = frontEnd.emplaceBlock<Filter<float>>();
+ * auto       pool   = std::make_shared<BasicThreadPool>("front-end", thread_pool::CPU_BOUND, 1, 1);
+ * pool->setAffinityMask({ false, false, true, true }); // pins the domain to cores 2 and 3
+ * auto domain       = std::make_unique<gr::SchedulingDomain<scheduler::Simple<>>>(std::move(frontEnd), pool);
+ * domain->exposeInput(gr::inputPort<"in">(&filter));
+ * domain->exposeOutput(gr::outputPort<"out">(&filter));
+ * auto &frontEndBlock = graph.addBlock(std::move(domain));
+ * graph.connect(source, 0, frontEndBlock, 0);
+ * @endcode
+ */
+template<typename TScheduler>
+class SchedulingDomain : public lifecycle::StateMachine<SchedulingDomain<TScheduler>>, public BlockModel {
+    friend class lifecycle::StateMachine<SchedulingDomain<TScheduler>>;
+    using BasicThreadPool = thread_pool::BasicThreadPool;
+
+    static std::atomic_size_t         _uniqueIdCounter;
+    const std::size_t                 _uniqueId   = _uniqueIdCounter++;
+    const std::string                 _uniqueName = fmt::format("SchedulingDomain#{}", _uniqueId);
+    std::string                       _name       = _uniqueName;
+    std::string                       _typeName   = gr::meta::type_name<SchedulingDomain<TScheduler>>();
+    property_map                      _metaInformation;
+    std::unique_ptr<gr::SettingsBase> _settings = std::make_unique<gr::BasicSettings<SchedulingDomain<TScheduler>>>(*this);
+
+    std::shared_ptr<BasicThreadPool> _pool;
+    TScheduler                       _scheduler;
+    std::thread                      _runner;
+    std::atomic_bool                 _finished = false;
+    std::optional<std::string>       _runError;
+
+    MsgPortInNamed<"__Builtin">  _msgIn;
+    MsgPortOutNamed<"__Builtin"> _msgOut;
+    MsgPortOut                   _toScheduler;
+    MsgPortIn                    _fromScheduler;
+
+public:
+    explicit SchedulingDomain(gr::Graph &&graph, std::shared_ptr<BasicThreadPool> pool = std::make_shared<BasicThreadPool>("domain-pool", thread_pool::CPU_BOUND))
+        : _pool(pool), _scheduler(std::move(graph), std::move(pool)) {
+        msgIn  = &_msgIn;
+        msgOut = &_msgOut;
+        if (_toScheduler.connect(_scheduler.msgIn) != ConnectionResult::SUCCESS || _scheduler.msgOut.connect(_fromScheduler) != ConnectionResult::SUCCESS) {
+            throw gr::exception(fmt::format("SchedulingDomain {}: failed to connect to the inner scheduler's message ports", _uniqueName));
+        }
+        _dynamicPortsLoaded = true;
+        _dynamicPortsLoader = [] {};
+    }
+
+    ~SchedulingDomain() override { joinRunner(); }
+
+    /// exposes a port of a block of the inner graph as the next input port of this domain (N.B. the port's name is retained)
+    template<PortLike TPort>
+    SchedulingDomain &
+    exposeInput(TPort &innerPort) {
+        static_assert(TPort::kIsInput, "exposeInput(...) requires an input port");
+        _dynamicInputPorts.emplace_back(gr::DynamicPort(innerPort, gr::DynamicPort::non_owned_reference_tag{}));
+        return *this;
+    }
+
+    /// exposes a port of a block of the inner graph as the next output port of this domain (N.B. the port's name is retained)
+    template<PortLike TPort>
+    SchedulingDomain &
+    exposeOutput(TPort &innerPort) {
+        static_assert(TPort::kIsOutput, "exposeOutput(...) requires an output port");
+        _dynamicOutputPorts.emplace_back(gr::DynamicPort(innerPort, gr::DynamicPort::non_owned_reference_tag{}));
+        return *this;
+    }
+
+    [[nodiscard]] TScheduler &
+    scheduler() noexcept {
+        return _scheduler;
+    }
+
+    [[nodiscard]] const std::shared_ptr<BasicThreadPool> &
+    threadPool() const noexcept {
+        return _pool;
+    }
+
+    /// the dedicated thread running the inner scheduler (N.B. only valid between start and stop)
+    [[nodiscard]] std::thread::id
+    runnerId() const noexcept {
+        return _runner.get_id();
+    }
+
+    void
+    init(std::shared_ptr<gr::Sequence> /*progress*/, std::shared_ptr<BasicThreadPool> /*ioThreadPool*/) override {
+        // N.B. the domain deliberately ignores the parent's I/O pool -- it owns its own
+        std::ignore = this->changeStateTo(lifecycle::State::INITIALISED);
+    }
+
+    [[nodiscard]] constexpr bool
+    isBlocking() const noexcept override {
+        return true; // the inner scheduler needs to be joined before the domain can be considered stopped
+    }
+
+    [[nodiscard]] std::expected<void, Error>
+    changeState(lifecycle::State newState) noexcept override {
+        return this->changeStateTo(newState);
+    }
+
+    [[nodiscard]] lifecycle::State
+    state() const noexcept override {
+        return lifecycle::StateMachine<SchedulingDomain<TScheduler>>::state();
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    availableInputSamples(std::vector<std::size_t> &) const noexcept override {
+        return 0UZ;
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    availableOutputSamples(std::vector<std::size_t> &) const noexcept override {
+        return 0UZ;
+    }
+
+    [[nodiscard]] std::string_view
+    name() const override {
+        return _name;
+    }
+
+    [[nodiscard]] std::string_view
+    typeName() const override {
+        return _typeName;
+    }
+
+    void
+    setName(std::string name) noexcept override {
+        _name = std::move(name);
+    }
+
+    [[nodiscard]] property_map &
+    metaInformation() noexcept override {
+        return _metaInformation;
+    }
+
+    [[nodiscard]] const property_map &
+    metaInformation() const override {
+        return _metaInformation;
+    }
+
+    [[nodiscard]] std::string_view
+    uniqueName() const override {
+        return _uniqueName;
+    }
+
+    [[nodiscard]] SettingsBase &
+    settings() const override {
+        return *_settings;
+    }
+
+    /// the actual processing happens on the domain's own thread -- this only reports whether the inner graph is still active
+    [[nodiscard]] work::Result
+    work(std::size_t requestedWork) override {
+        if (!_finished.load(std::memory_order_acquire)) {
+            return { requestedWork, 0UZ, state() == lifecycle::State::ERROR ? work::Status::ERROR : work::Status::OK };
+        }
+        return { requestedWork, 0UZ, _runError.has_value() ? work::Status::ERROR : work::Status::DONE };
+    }
+
+    [[nodiscard]] work::Status
+    draw() override {
+        return work::Status::OK;
+    }
+
+    void
+    processScheduledMessages() override {
+        forwardMessages(_msgIn, _toScheduler);           // parent -> inner blocks (N.B. lifecycle messages are not forwarded by the parent)
+        forwardMessages(_fromScheduler, *this->msgOut); // inner blocks -> parent
+    }
+
+    [[nodiscard]] void *
+    raw() override {
+        return this;
+    }
+
+private:
+    void
+    start() {
+        _finished = false;
+        _runError.reset();
+        _runner = std::thread([this] {
+            thread_pool::thread::setThreadName(fmt::format("{}#domain", _pool->poolName()));
+            if (const std::vector<bool> &mask = _pool->getAffinityMask(); !mask.empty()) {
+                thread_pool::thread::setThreadAffinity(mask);
+            }
+            if (auto result = _scheduler.runAndWait(); !result) {
+                _runError = result.error();
+                std::ignore = this->changeStateTo(lifecycle::State::ERROR);
+            }
+            _finished.store(true, std::memory_order_release);
+        });
+    }
+
+    void
+    stop() {
+        joinRunner();
+        if (auto e = this->changeStateTo(lifecycle::State::STOPPED); !e) {
+            fmt::println(std::cerr, "SchedulingDomain {}: failed to stop: {}", _uniqueName, e.error().message);
+        }
+    }
+
+    void
+    pause() {
+        requestSchedulerState(lifecycle::State::REQUESTED_PAUSE);
+        std::ignore = this->changeStateTo(lifecycle::State::PAUSED);
+    }
+
+    void
+    resume() {
+        requestSchedulerState(lifecycle::State::RUNNING);
+    }
+
+    void
+    requestSchedulerState(lifecycle::State newState) {
+        sendMessage<message::Command::Set>(_toScheduler, _scheduler.unique_name, block::property::kLifeCycleState, { { "state", std::string(magic_enum::enum_name(newState)) } });
+    }
+
+    void
+    joinRunner() {
+        if (!_runner.joinable()) {
+            return;
+        }
+        // N.B. the stop request is only sent once the inner scheduler is RUNNING, since it would otherwise be consumed
+        // (and rejected as an invalid transition) while the scheduler is still initialising
+        bool stopRequested = false;
+        while (!_finished.load(std::memory_order_acquire)) {
+            if (!stopRequested && lifecycle::isActive(_scheduler.state())) {
+                requestSchedulerState(lifecycle::State::REQUESTED_STOP);
+                stopRequested = true;
+            }
+            std::this_thread::sleep_for(scheduler::kMessagePollInterval);
+        }
+        _runner.join();
+    }
+
+    static void
+    forwardMessages(auto &inPort, auto &outPort) {
+        auto             &reader    = inPort.streamReader();
+        const std::size_t available = reader.available();
+        if (available == 0UZ) {
+            return;
+        }
+        ConsumableSpan auto messages = reader.get(available);
+        outPort.streamWriter().publish([&messages](auto &out) { std::ranges::copy(messages, out.begin()); }, messages.size());
+        std::ignore = messages.tryConsume(messages.size());
+    }
+};
+
+template<typename TScheduler>
+std::atomic_size_t SchedulingDomain<TScheduler>::_uniqueIdCounter = 0UZ;
+
+} // namespace gr
+
+#endif // GNURADIO_SCHEDULING_DOMAIN_HPP
@@ -1,6 +1,8 @@
 #ifndef GNURADIO_SETTINGS_HPP
 #define GNURADIO_SETTINGS_HPP
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <concepts>
@@ -365,31 +367,19 @@ public:
         if constexpr (refl::is_reflectable<TBlock>()) {
             std::lock_guard lg(_lock);
             for (const auto &[key, value] : parameters) {
-                bool is_set              = false;
-                auto iterate_over_member = [&, this](auto member) {
-                    using Type = unwrap_if_wrapped_t<std::remove_cvref_t<decltype(member(*_block))>>;
-                    if constexpr (traits::port::is_not_any_port_or_collection<Type> && !std::is_const_v<Type> && is_writable(member) && settings::isSupportedType<Type>()) {
-                        const auto fieldName = std::string_view(get_display_name(member));
-                        if (fieldName == key && std::holds_alternative<Type>(value)) {
-                            if (_auto_update.contains(key)) {
-                                _auto_update.erase(key);
-                            }
-                            _staged.insert_or_assign(key, value);
-                            SettingsBase::_changed.store(true);
-                            is_set = true;
-                        }
-                        if (fieldName == key && !std::holds_alternative<Type>(value)) {
-                            throw std::invalid_argument([&key, &value] { // lazy evaluation
-                                const std::size_t actual_index   = value.index();
-                                const std::size_t required_index = meta::to_typelist<pmtv::pmt>::index_of<Type>(); // This too, as per your implementation.
-                                return fmt::format("value for key '{}' has a wrong type. Index of actual type: {} ({}), Index of expected type: {} ({})", key, actual_index, "<missing pmt type>",
-                                                   required_index, gr::meta::type_name<Type>());
-                            }());
-                        }
+                if (const MemberSetter *setter = findMemberSetter(key); setter != nullptr) {
+                    if (value.index() != setter->typeIndex) {
+                        throw std::invalid_argument([&key, &value, setter] { // lazy evaluation
+                            return fmt::format("value for key '{}' has a wrong type. Index of actual type: {} ({}), Index of expected type: {} ({})", key, value.index(), "<missing pmt type>",
+                                               setter->typeIndex, setter->typeName());
+                        }());
                     }
-                };
-                processMembers<TBlock>(iterate_over_member);
-                if (!is_set) {
+                    if (_auto_update.contains(key)) {
+                        _auto_update.erase(key);
+                    }
+                    _staged.insert_or_assign(key, value);
+                    SettingsBase::_changed.store(true);
+                } else {
                     ret.insert_or_assign(key, pmtv::pmt(value));
                 }
             }
@@ -425,16 +415,13 @@ public:
     autoUpdate(const property_map &parameters, SettingsCtx = {}) override {
         if constexpr (refl::is_reflectable<TBlock>()) {
             for (const auto &[key, value] : parameters) {
-                auto iterate_over_member = [&](auto member) {
-                    using Type = unwrap_if_wrapped_t<std::remove_cvref_t<decltype(member(*_block))>>;
-                    if constexpr (traits::port::is_not_any_port_or_collection<Type> && !std::is_const_v<Type> && is_writable(member) && settings::isSupportedType<Type>()) {
-                        if (_auto_update.contains(key) && std::string(get_display_name(member)) == key && std::holds_alternative<Type>(value)) {
-                            _staged.insert_or_assign(key, value);
-                            SettingsBase::_changed.store(true);
-                        }
-                    }
-                };
-                processMembers<TBlock>(iterate_over_member);
+                if (!_auto_update.contains(key)) {
+                    continue;
+                }
+                if (const MemberSetter *setter = findMemberSetter(key); setter != nullptr && value.index() == setter->typeIndex) {
+                    _staged.insert_or_assign(key, value);
+                    SettingsBase::_changed.store(true);
+                }
             }
         }
     }
@@ -510,54 +497,22 @@ public:
 
             // update staged and forward parameters based on member properties
             property_map staged;
-            for (const auto &[localKey, localStaged_value] : _staged) {
-                const auto &key                  = localKey;
-                const auto &staged_value         = localStaged_value;
-                auto        apply_member_changes = [&key, &staged, &result, &staged_value, this](auto member) {
-                    using RawType = std::remove_cvref_t<decltype(member(*_block))>;
-                    using Type    = unwrap_if_wrapped_t<RawType>;
-                    if constexpr (traits::port::is_not_any_port_or_collection<Type> && !std::is_const_v<Type> && is_writable(member) && settings::isSupportedType<Type>()) {
-                        if (std::string(get_display_name(member)) == key && std::holds_alternative<Type>(staged_value)) {
-                            if constexpr (is_annotated<RawType>()) {
-                                if (member(*_block).validate_and_set(std::get<Type>(staged_value))) {
-                                    result.appliedParameters.insert_or_assign(key, staged_value);
-                                    if constexpr (HasSettingsChangedCallback<TBlock>) {
-                                        staged.insert_or_assign(key, staged_value);
-                                    } else {
-                                        std::ignore = staged; // help clang to see why staged is not unused
-                                    }
-                                } else {
-                                    // TODO: replace with pmt error message on msgOut port (to note: clang compiler bug/issue)
-#if !defined(__EMSCRIPTEN__) && !defined(__clang__)
-                                    fmt::print(stderr, " cannot set field {}({})::{} = {} to {} due to limit constraints [{}, {}] validate func is {} defined\n", //
-                                               _block->unique_name, _block->name, member(*_block), std::get<Type>(staged_value),                                  //
-                                               std::string(get_display_name(member)), RawType::LimitType::MinRange,
-                                               RawType::LimitType::MaxRange, //
-                                               RawType::LimitType::ValidatorFunc == nullptr ? "not" : "");
-#else
-                                    fmt::print(stderr, " cannot set field {}({})::{} = {} to {} due to limit constraints [{}, {}] validate func is {} defined\n", //
-                                               "_block->unique_name", "_block->name", "member(*_block)", std::get<Type>(staged_value),                            //
-                                               std::string(get_display_name(member)), RawType::LimitType::MinRange,
-                                               RawType::LimitType::MaxRange, //
-                                               RawType::LimitType::ValidatorFunc == nullptr ? "not" : "");
-#endif
-                                }
-                            } else {
-                                member(*_block) = std::get<Type>(staged_value);
-                                result.appliedParameters.insert_or_assign(key, staged_value);
-                                if constexpr (HasSettingsChangedCallback<TBlock>) {
-                                    staged.insert_or_assign(key, staged_value);
-                                } else {
-                                    std::ignore = staged; // help clang to see why staged is not unused
-                                }
-                            }
-                        }
-                        if (_auto_forward.contains(key)) {
-                            result.forwardParameters.insert_or_assign(key, staged_value);
-                        }
+            for (const auto &[key, staged_value] : _staged) {
+                const MemberSetter *setter = findMemberSetter(key);
+                if (setter == nullptr) {
+                    continue;
+                }
+                if (staged_value.index() == setter->typeIndex && setter->apply(*_block, staged_value)) {
+                    result.appliedParameters.insert_or_assign(key, staged_value);
+                    if constexpr (HasSettingsChangedCallback<TBlock>) {
+                        staged.insert_or_assign(key, staged_value);
+                    } else {
+                        std::ignore = staged; // help clang to see why staged is not unused
                     }
-                };
-                processMembers<TBlock>(apply_member_changes);
+                }
+                if (_auto_forward.contains(key)) {
+                    result.forwardParameters.insert_or_assign(key, staged_value);
+                }
             }
 
             // update active parameters
@@ -610,6 +565,91 @@ public:
     }
 
 private:
+    /**
+     * @brief type-erased setter for a single settable block member, collected into a name-sorted static table
+     * so that staged key-value pairs are matched by binary search rather than by iterating over all reflected members.
+     */
+    struct MemberSetter {
+        std::string_view name;
+        std::size_t      typeIndex; /// index of the member's value type within pmtv::pmt
+        bool (*apply)(TBlock &block, const pmtv::pmt &value); /// returns 'false' if the value is rejected by the member's limits
+        std::string (*typeName)();
+    };
+
+    template<typename Member>
+    using member_value_t = unwrap_if_wrapped_t<std::remove_cvref_t<decltype(Member{}(std::declval<TBlock &>()))>>;
+
+    template<typename Member>
+    static constexpr bool
+    isSettableMember() {
+        using Type = member_value_t<Member>;
+        return traits::port::is_not_any_port_or_collection<Type> && !std::is_const_v<Type> && is_writable(Member{}) && settings::isSupportedType<Type>();
+    }
+
+    template<typename Member>
+    static bool
+    applyMember(TBlock &block, const pmtv::pmt &value) {
+        using RawType = std::remove_cvref_t<decltype(Member{}(block))>;
+        using Type    = member_value_t<Member>;
+        constexpr Member member{};
+        if constexpr (is_annotated<RawType>()) {
+            if (member(block).validate_and_set(std::get<Type>(value))) {
+                return true;
+            }
+            // TODO: replace with pmt error message on msgOut port (to note: clang compiler bug/issue)
+#if !defined(__EMSCRIPTEN__) && !defined(__clang__)
+            fmt::print(stderr, " cannot set field {}({})::{} = {} to {} due to limit constraints [{}, {}] validate func is {} defined\n", //
+                       block.unique_name, block.name, member(block), std::get<Type>(value),                                              //
+                       std::string(get_display_name(member)), RawType::LimitType::MinRange,
+                       RawType::LimitType::MaxRange, //
+                       RawType::LimitType::ValidatorFunc == nullptr ? "not" : "");
+#else
+            fmt::print(stderr, " cannot set field {}({})::{} = {} to {} due to limit constraints [{}, {}] validate func is {} defined\n", //
+                       "_block->unique_name", "_block->name", "member(*_block)", std::get<Type>(value),                                  //
+                       std::string(get_display_name(member)), RawType::LimitType::MinRange,
+                       RawType::LimitType::MaxRange, //
+                       RawType::LimitType::ValidatorFunc == nullptr ? "not" : "");
+#endif
+            return false;
+        } else {
+            member(block) = std::get<Type>(value);
+            return true;
+        }
+    }
+
+    static constexpr std::size_t
+    settableMemberCount() {
+        std::size_t count = 0UZ;
+        processMembers<TBlock>([&count]<typename Member>(Member) {
+            if constexpr (isSettableMember<Member>()) {
+                ++count;
+            }
+        });
+        return count;
+    }
+
+    static constexpr auto
+    makeMemberSetters() {
+        std::array<MemberSetter, settableMemberCount()> setters{};
+        std::size_t                                     index = 0UZ;
+        processMembers<TBlock>([&setters, &index]<typename Member>(Member) {
+            if constexpr (isSettableMember<Member>()) {
+                using Type        = member_value_t<Member>;
+                setters[index++] = MemberSetter{ std::string_view(Member::name.c_str(), Member::name.size), meta::to_typelist<pmtv::pmt>::index_of<Type>(), &applyMember<Member>,
+                                                 &gr::meta::type_name<Type> };
+            }
+        });
+        std::ranges::sort(setters, {}, &MemberSetter::name);
+        return setters;
+    }
+
+    [[nodiscard]] static const MemberSetter *
+    findMemberSetter(std::string_view key) noexcept {
+        static constexpr auto setters = makeMemberSetters(); // generated once per block type at compile-time
+        const auto            it      = std::ranges::lower_bound(setters, key, {}, &MemberSetter::name);
+        return (it != setters.end() && it->name == key) ? &*it : nullptr;
+    }
+
     void
     storeDefaultSettings(property_map &oldSettings) {
         // take a copy of the field -> map value of the old settings
@@ -0,0 +1,444 @@
+#ifndef GNURADIO_SHARED_MEMORY_BUFFER_HPP
+#define GNURADIO_SHARED_MEMORY_BUFFER_HPP
+
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/BinarySerialiser.hpp>
+#include <gnuradio-4.0/CircularBuffer.hpp> // for HAS_POSIX_MAP_INTERFACE and the POSIX mmap headers
+#include <gnuradio-4.0/Sequence.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+namespace gr {
+
+namespace shm {
+inline constexpr std::uint64_t kMagic       = 0x3452472D4D485347; // "GSHM-GR4" (little-endian)
+inline constexpr std::uint32_t kVersion     = 2U;
+inline constexpr std::size_t   kTagSlots    = 64UZ;   // default number of in-flight tags
+inline constexpr std::size_t   kTagSlotSize = 1024UZ; // bytes per tag slot, including the slot header
+
+/**
+ * @brief control block at the start of every shared-memory segment -- shared between the writer and reader process.
+ *
+ * The cursors count the total number of samples/tags that have been published/consumed (starting at 0).
+ * They are lock-free 64-bit atomics and thus valid across process boundaries.
+ */
+struct SegmentHeader {
+    std::atomic<std::uint64_t> magic{ 0U }; // set last by the creator, signals that the segment is fully initialised
+    std::uint32_t              version{ kVersion };
+    std::uint32_t              elementSize{ 0U };
+    std::uint64_t              capacity{ 0U };    // in samples
+    std::uint64_t              headerBytes{ 0U }; // offset of the sample data region w.r.t. the segment start
+    std::uint64_t              tagSlots{ 0U };
+    std::uint64_t              tagSlotSize{ 0U };
+    std::int64_t               ownerPid{ 0 };   // process that created the segment, used to detect stale left-overs
+    std::atomic<bool>          closed{ false }; // set by the writer once no further samples will be published
+    Sequence                   writeCursor{ 0 };
+    Sequence                   readCursor{ 0 };
+    Sequence                   tagWriteCursor{ 0 };
+    Sequence                   tagReadCursor{ 0 };
+};
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<Sequence::signed_index_type>::is_always_lock_free, "cross-process cursors require lock-free atomics");
+
+struct TagSlot {
+    std::int64_t  index; // absolute sample index
+    std::uint32_t size;  // encoded property_map size in bytes
+    std::uint32_t reserved;
+
+    [[nodiscard]] std::uint8_t *
+    payload() noexcept {
+        return reinterpret_cast<std::uint8_t *>(this + 1);
+    }
+};
+} // namespace shm
+
+/**
+ * @brief named, single-producer/single-consumer circular buffer located in POSIX shared memory (`shm_open`).
+ *
+ * Connects two `Graph`s that run in different processes: one process `create(...)`s (and owns) the named segment,
+ * the other `open(...)`s it. Similar to `double_mapped_memory_resource`, the sample region is mapped twice back-to-back
+ * so that every readable/writable range is contiguous irrespective of the wrap-around. Tags are transported
+ * out-of-band in a fixed-size slot ring using the compact binary codec (`BinarySerialiser.hpp`).
+ *
+ * Segment layout: [SegmentHeader | tag slots]_page-aligned [samples][samples (mirror)]
+ *
+ * N.B. the segment is removed (`shm_unlink`) when the owning instance is destroyed. Tags must be published before
+ * the samples they refer to. A left-over segment of the same name is only replaced if its recorded owner process no
+ * longer exists.
+ */
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+class SharedMemoryBuffer {
+    std::string         _name;
+    shm::SegmentHeader *_header      = nullptr;
+    T                  *_data        = nullptr;
+    std::size_t         _mappedBytes = 0UZ;
+    bool                _isOwner     = false;
+
+public:
+    using signed_index_type = Sequence::signed_index_type;
+
+    SharedMemoryBuffer() = default;
+
+    SharedMemoryBuffer(SharedMemoryBuffer &&other) noexcept
+        : _name(std::move(other._name))
+        , _header(std::exchange(other._header, nullptr))
+        , _data(std::exchange(other._data, nullptr))
+        , _mappedBytes(std::exchange(other._mappedBytes, 0UZ))
+        , _isOwner(std::exchange(other._isOwner, false)) {}
+
+    SharedMemoryBuffer &
+    operator=(SharedMemoryBuffer &&other) noexcept {
+        if (this != &other) {
+            release();
+            _name        = std::move(other._name);
+            _header      = std::exchange(other._header, nullptr);
+            _data        = std::exchange(other._data, nullptr);
+            _mappedBytes = std::exchange(other._mappedBytes, 0UZ);
+            _isOwner     = std::exchange(other._isOwner, false);
+        }
+        return *this;
+    }
+
+    SharedMemoryBuffer(const SharedMemoryBuffer &) = delete;
+    SharedMemoryBuffer &
+    operator=(const SharedMemoryBuffer &)
+            = delete;
+
+    ~SharedMemoryBuffer() { release(); }
+
+    /**
+     * creates (or replaces a stale) named segment holding at least `minSize` samples. The capacity is rounded up so that
+     * the sample region is a multiple of the page size. Throws `std::system_error` with `std::errc::file_exists` if a
+     * segment of the same name is owned by a live process (or is still being initialised).
+     */
+    [[nodiscard]] static SharedMemoryBuffer
+    create(std::string name, std::size_t minSize, std::size_t nTagSlots = shm::kTagSlots, std::size_t tagSlotSize = shm::kTagSlotSize) {
+#ifdef HAS_POSIX_MAP_INTERFACE
+        if (minSize == 0UZ || nTagSlots == 0UZ || tagSlotSize <= sizeof(shm::TagSlot) || tagSlotSize % alignof(shm::TagSlot) != 0UZ) {
+            throw std::invalid_argument(fmt::format("{} - invalid shared-memory buffer size: {} samples, {} tag slots of {} bytes", name, minSize, nTagSlots, tagSlotSize));
+        }
+        const auto        pageSize    = static_cast<std::size_t>(getpagesize());
+        const std::size_t granularity = pageSize / std::gcd(pageSize, sizeof(T)); // smallest sample count that fills full pages
+        const std::size_t capacity    = (minSize + granularity - 1UZ) / granularity * granularity;
+        const std::size_t dataBytes   = capacity * sizeof(T);
+        const std::size_t headerBytes = roundUpToPage(sizeof(shm::SegmentHeader) + nTagSlots * tagSlotSize, pageSize);
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd < 0 && errno == EEXIST) {
+            if (removeStaleSegment(name)) { // left-over from a previous (crashed) owner
+                fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+            } else {
+                errno = EEXIST; // segment in use by a live process
+            }
+        }
+        if (fd < 0) {
+            throw std::system_error(errno, std::system_category(), fmt::format("{} - shm_open (create) error {}: {}", name, errno, strerror(errno)));
+        }
+        if (ftruncate(fd, static_cast<off_t>(headerBytes + dataBytes)) == -1) {
+            std::error_code errorCode(errno, std::system_category());
+            ::close(fd);
+            shm_unlink(name.c_str());
+            throw std::system_error(errorCode, fmt::format("{} - ftruncate {}: {}", name, errno, strerror(errno)));
+        }
+
+        SharedMemoryBuffer buffer;
+        buffer._name    = std::move(name);
+        buffer._isOwner = true;
+        buffer.map(fd, headerBytes, dataBytes);
+
+        auto *header        = new (buffer._header) shm::SegmentHeader();
+        header->elementSize = static_cast<std::uint32_t>(sizeof(T));
+        header->capacity    = capacity;
+        header->headerBytes = headerBytes;
+        header->tagSlots    = nTagSlots;
+        header->tagSlotSize = tagSlotSize;
+        header->ownerPid    = static_cast<std::int64_t>(getpid());
+        header->magic.store(shm::kMagic, std::memory_order_release);
+        return buffer;
+#else
+        throw std::invalid_argument(fmt::format("{} - OS does not provide POSIX interface for shm_open(...) and mmap(...)", name));
+#endif
+    }
+
+    /**
+     * attaches to an existing segment created by another process (or instance) -- throws `std::system_error` with
+     * `std::errc::no_such_file_or_directory` if the segment does not (yet) exist or is not (yet) initialised.
+     */
+    [[nodiscard]] static SharedMemoryBuffer
+    open(std::string name) {
+#ifdef HAS_POSIX_MAP_INTERFACE
+        const int fd = shm_open(name.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd < 0) {
+            throw std::system_error(errno, std::system_category(), fmt::format("{} - shm_open (attach) error {}: {}", name, errno, strerror(errno)));
+        }
+
+        struct stat fileStat {};
+        if (fstat(fd, &fileStat) == -1 || static_cast<std::size_t>(fileStat.st_size) < sizeof(shm::SegmentHeader)) {
+            ::close(fd);
+            throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), fmt::format("{} - segment not yet initialised", name));
+        }
+        void *peek = mmap(nullptr, sizeof(shm::SegmentHeader), PROT_READ, MAP_SHARED, fd, 0);
+        if (peek == MAP_FAILED) {
+            std::error_code errorCode(errno, std::system_category());
+            ::close(fd);
+            throw std::system_error(errorCode, fmt::format("{} - mmap header {}: {}", name, errno, strerror(errno)));
+        }
+        const auto *peekHeader = static_cast<const shm::SegmentHeader *>(peek);
+        const bool  ready       = peekHeader->magic.load(std::memory_order_acquire) == shm::kMagic;
+        const auto  version     = peekHeader->version;
+        const auto  elementSize = peekHeader->elementSize;
+        const auto  headerBytes = static_cast<std::size_t>(peekHeader->headerBytes);
+        const auto  dataBytes   = static_cast<std::size_t>(peekHeader->capacity) * sizeof(T);
+        munmap(peek, sizeof(shm::SegmentHeader));
+
+        if (!ready) {
+            ::close(fd);
+            throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), fmt::format("{} - segment not yet initialised", name));
+        }
+        if (version != shm::kVersion || elementSize != sizeof(T) || static_cast<std::size_t>(fileStat.st_size) != headerBytes + dataBytes) {
+            ::close(fd);
+            throw std::invalid_argument(fmt::format("{} - incompatible segment: version {} vs. {}, element size {} vs. {}, file size {} vs. {}", name, version, shm::kVersion, elementSize, sizeof(T), fileStat.st_size, headerBytes + dataBytes));
+        }
+
+        SharedMemoryBuffer buffer;
+        buffer._name = std::move(name);
+        buffer.map(fd, headerBytes, dataBytes);
+        return buffer;
+#else
+        throw std::invalid_argument(fmt::format("{} - OS does not provide POSIX interface for shm_open(...) and mmap(...)", name));
+#endif
+    }
+
+    [[nodiscard]] bool
+    isValid() const noexcept {
+        return _header != nullptr;
+    }
+
+    [[nodiscard]] bool
+    isOwner() const noexcept {
+        return _isOwner;
+    }
+
+    [[nodiscard]] std::string_view
+    name() const noexcept {
+        return _name;
+    }
+
+    [[nodiscard]] std::size_t
+    size() const noexcept {
+        return _header ? static_cast<std::size_t>(_header->capacity) : 0UZ;
+    }
+
+    // writer interface
+
+    [[nodiscard]] std::size_t
+    availableForWrite() const noexcept {
+        return size() - static_cast<std::size_t>(_header->writeCursor.value() - _header->readCursor.value());
+    }
+
+    /// contiguous writable range of `nSamples <= availableForWrite()` samples, made visible by `publish(nSamples)`
+    [[nodiscard]] std::span<T>
+    reserve(std::size_t nSamples) const noexcept {
+        assert(nSamples <= availableForWrite());
+        return { _data + static_cast<std::size_t>(_header->writeCursor.value()) % size(), nSamples };
+    }
+
+    void
+    publish(std::size_t nSamples) noexcept {
+        _header->writeCursor.setValue(_header->writeCursor.value() + static_cast<signed_index_type>(nSamples));
+    }
+
+    /// @return absolute index of the next sample to be published
+    [[nodiscard]] signed_index_type
+    writePosition() const noexcept {
+        return _header->writeCursor.value();
+    }
+
+    /**
+     * publishes a tag at the absolute sample `index` -- needs to be called before the corresponding sample is published.
+     * @return false if all tag slots are occupied (i.e. the reader is lagging), throws `std::length_error` if the
+     * encoded tag does not fit into a slot.
+     */
+    [[nodiscard]] bool
+    tryPublishTag(signed_index_type index, const property_map &map) {
+        const auto write = _header->tagWriteCursor.value();
+        if (static_cast<std::size_t>(write - _header->tagReadCursor.value()) >= _header->tagSlots) {
+            return false;
+        }
+        const std::vector<std::uint8_t> encoded = serialiser::serialise(map);
+        if (encoded.size() > _header->tagSlotSize - sizeof(shm::TagSlot)) {
+            throw std::length_error(fmt::format("{} - encoded tag size {} exceeds slot capacity {}", _name, encoded.size(), _header->tagSlotSize - sizeof(shm::TagSlot)));
+        }
+        shm::TagSlot *slot = tagSlot(write);
+        slot->index        = index;
+        slot->size         = static_cast<std::uint32_t>(encoded.size());
+        std::memcpy(slot->payload(), encoded.data(), encoded.size());
+        _header->tagWriteCursor.setValue(write + 1);
+        return true;
+    }
+
+    /// marks the end of the stream -- the reader drains the remaining samples and tags
+    void
+    close() noexcept {
+        if (_header) {
+            _header->closed.store(true, std::memory_order_release);
+        }
+    }
+
+    // reader interface
+
+    [[nodiscard]] std::size_t
+    available() const noexcept {
+        return static_cast<std::size_t>(_header->writeCursor.value() - _header->readCursor.value());
+    }
+
+    /// contiguous readable range of `nSamples <= available()` samples, released by `consume(nSamples)`
+    [[nodiscard]] std::span<const T>
+    get(std::size_t nSamples) const noexcept {
+        assert(nSamples <= available());
+        return { _data + static_cast<std::size_t>(_header->readCursor.value()) % size(), nSamples };
+    }
+
+    void
+    consume(std::size_t nSamples) noexcept {
+        _header->readCursor.setValue(_header->readCursor.value() + static_cast<signed_index_type>(nSamples));
+    }
+
+    /// @return absolute index of the next sample to be read
+    [[nodiscard]] signed_index_type
+    readPosition() const noexcept {
+        return _header->readCursor.value();
+    }
+
+    /// @return absolute sample index of the oldest unread tag (if any) without decoding it
+    [[nodiscard]] std::optional<signed_index_type>
+    nextTagIndex() const noexcept {
+        const auto read = _header->tagReadCursor.value();
+        if (read == _header->tagWriteCursor.value()) {
+            return std::nullopt;
+        }
+        return static_cast<signed_index_type>(tagSlot(read)->index);
+    }
+
+    /// decodes and releases the oldest unread tag -- requires `nextTagIndex().has_value()`
+    [[nodiscard]] Tag
+    consumeTag() {
+        const auto        read     = _header->tagReadCursor.value();
+        shm::TagSlot     *slot     = tagSlot(read);
+        const std::size_t size     = slot->size; // N.B. written by the peer process -> read once and validate
+        const std::size_t capacity = _header->tagSlotSize > sizeof(shm::TagSlot) ? _header->tagSlotSize - sizeof(shm::TagSlot) : 0UZ;
+        if (size > capacity) {
+            throw std::length_error(fmt::format("{} - encoded tag size {} exceeds slot capacity {}", _name, size, capacity));
+        }
+        Tag tag(static_cast<Tag::signed_index_type>(slot->index), serialiser::deserialise<property_map>(std::span<const std::uint8_t>(slot->payload(), size)));
+        _header->tagReadCursor.setValue(read + 1);
+        return tag;
+    }
+
+    /// true once the writer closed the stream, N.B. there may still be samples left to read
+    [[nodiscard]] bool
+    isClosed() const noexcept {
+        return _header->closed.load(std::memory_order_acquire);
+    }
+
+private:
+    [[nodiscard]] static constexpr std::size_t
+    roundUpToPage(std::size_t bytes, std::size_t pageSize) noexcept {
+        return (bytes + pageSize - 1UZ) / pageSize * pageSize;
+    }
+
+    [[nodiscard]] shm::TagSlot *
+    tagSlot(signed_index_type tagCursor) const noexcept {
+        auto *slots = reinterpret_cast<std::uint8_t *>(_header) + sizeof(shm::SegmentHeader);
+        return reinterpret_cast<shm::TagSlot *>(slots + (static_cast<std::size_t>(tagCursor) % _header->tagSlots) * _header->tagSlotSize);
+    }
+
+#ifdef HAS_POSIX_MAP_INTERFACE
+    /// unlinks the existing segment `name` iff it is fully initialised and its recorded owner process is dead
+    [[nodiscard]] static bool
+    removeStaleSegment(const std::string &name) noexcept {
+        const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            return errno == ENOENT; // removed in the meantime -> retry creation
+        }
+        struct stat fileStat {};
+        if (fstat(fd, &fileStat) == -1 || static_cast<std::size_t>(fileStat.st_size) < sizeof(shm::SegmentHeader)) {
+            ::close(fd);
+            return false; // N.B. may be a live owner between shm_open(...) and ftruncate(...)
+        }
+        void *peek = mmap(nullptr, sizeof(shm::SegmentHeader), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (peek == MAP_FAILED) {
+            return false;
+        }
+        const auto *header   = static_cast<const shm::SegmentHeader *>(peek);
+        const bool  complete = header->magic.load(std::memory_order_acquire) == shm::kMagic && header->version == shm::kVersion;
+        const auto  ownerPid = static_cast<pid_t>(header->ownerPid);
+        munmap(peek, sizeof(shm::SegmentHeader));
+
+        if (!complete || ownerPid <= 0 || ownerPid == getpid() || kill(ownerPid, 0) == 0 || errno != ESRCH) {
+            return false; // unknown layout, live owner, or still being initialised -> must not be touched
+        }
+        return shm_unlink(name.c_str()) == 0 || errno == ENOENT;
+    }
+
+    // reserves [header | data | data] and maps the data region twice so that wrap-around ranges are contiguous, closes `fd`
+    void
+    map(int fd, std::size_t headerBytes, std::size_t dataBytes) {
+        const std::size_t totalBytes = headerBytes + 2UZ * dataBytes;
+        void             *base       = mmap(nullptr, totalBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            std::error_code errorCode(errno, std::system_category());
+            ::close(fd);
+            throw std::system_error(errorCode, fmt::format("{} - failed to reserve address range {}: {}", _name, errno, strerror(errno)));
+        }
+        auto *bytes = static_cast<char *>(base);
+        if (mmap(bytes, headerBytes + dataBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED //
+            || mmap(bytes + headerBytes + dataBytes, dataBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, static_cast<off_t>(headerBytes)) == MAP_FAILED) {
+            std::error_code errorCode(errno, std::system_category());
+            munmap(base, totalBytes);
+            ::close(fd);
+            throw std::system_error(errorCode, fmt::format("{} - failed mmap for shared segment {}: {}", _name, errno, strerror(errno)));
+        }
+        ::close(fd); // file-descriptor is no longer needed. The mapping is retained.
+        _header      = reinterpret_cast<shm::SegmentHeader *>(bytes);
+        _data        = reinterpret_cast<T *>(bytes + headerBytes);
+        _mappedBytes = totalBytes;
+    }
+#endif
+
+    void
+    release() noexcept {
+#ifdef HAS_POSIX_MAP_INTERFACE
+        if (_header == nullptr) {
+            return;
+        }
+        if (_isOwner) {
+            close();
+            shm_unlink(_name.c_str());
+        }
+        munmap(_header, _mappedBytes);
+        _header      = nullptr;
+        _data        = nullptr;
+        _mappedBytes = 0UZ;
+#endif
+    }
+};
+
+} // namespace gr
+
+#endif // GNURADIO_SHARED_MEMORY_BUFFER_HPP
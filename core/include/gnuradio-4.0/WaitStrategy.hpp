@@ -1,6 +1,7 @@
 #ifndef GNURADIO_WAITSTRATEGY_HPP
 #define GNURADIO_WAITSTRATEGY_HPP
 
+#include <algorithm>
 #include <condition_variable>
 #include <atomic>
 #include <chrono>
@@ -41,6 +42,15 @@ inline constexpr bool hasSignalAllWhenBlocking = requires(T /*const*/ t) {
 };
 static_assert(!hasSignalAllWhenBlocking<int>);
 
+/**
+ * signal those waiting (parked) on the given cursor that it has advanced.
+ */
+template<typename T>
+inline constexpr bool hasSignalAllWhenBlockingOnCursor = requires(T /*const*/ t, Sequence &cursor) {
+    { t.signalAllWhenBlocking(cursor) } -> std::same_as<void>;
+};
+static_assert(!hasSignalAllWhenBlockingOnCursor<int>);
+
 template<typename T>
 concept WaitStrategy = isWaitStrategy<T>;
 
@@ -340,6 +350,97 @@ struct SpinWaitWaitStrategy {
 static_assert(WaitStrategy<SpinWaitWaitStrategy>);
 static_assert(!hasSignalAllWhenBlocking<SpinWaitWaitStrategy>);
 
+/**
+ * Adaptive strategy that escalates from busy-spinning to yielding and eventually parks the waiting thread on the cursor `Sequence`
+ * (`std::atomic::wait`, i.e. a futex on Linux). The spin budget follows the observed arrival intervals: it converges to about twice
+ * the spins needed while data arrives during the spin phase, grows if data arrived shortly after spinning stopped (yield phase), and
+ * shrinks if the waiter had to park (idle producer). This gives spin-like latency while data is flowing and no CPU use while idle.
+ * Publishers only notify (syscall) if a waiter is actually parked.
+ * N.B. only waits on the cursor are parked, lagging dependent sequences (i.e. other consumers) are waited for by yielding.
+ */
+class AdaptiveWaitStrategy {
+    static constexpr std::uint32_t     kMinSpins = 16U;
+    std::uint32_t                      _maxSpins;
+    std::uint32_t                      _maxYields;
+    mutable std::atomic<std::uint32_t> _spinBudget;
+    mutable std::atomic<std::int32_t>  _nParked{ 0 };   // number of currently parked waiters
+    mutable std::atomic<std::uint64_t> _nParkings{ 0U }; // statistics
+
+    static void cpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        asm volatile("rep\nnop"); // aka. 'pause'
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    void park(const std::int64_t sequence, const Sequence &cursor) const noexcept {
+        const auto observedCursor = cursor.value();
+        if (observedCursor >= sequence) {
+            return;
+        }
+        _nParked.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst); // pairs with the fence in 'signalAllWhenBlocking' -> either we see the new cursor or the publisher sees us parked
+        cursor.wait(observedCursor);                          // returns immediately if the cursor already moved on
+        _nParked.fetch_sub(1, std::memory_order_release);
+        _nParkings.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+public:
+    explicit AdaptiveWaitStrategy(std::uint32_t maxSpins = 4096U, std::uint32_t maxYields = 64U)
+        : _maxSpins(std::max(maxSpins, kMinSpins)), _maxYields(maxYields), _spinBudget(_maxSpins) {}
+
+    std::int64_t waitFor(const std::int64_t sequence, const Sequence &cursor, const std::vector<std::shared_ptr<Sequence>> &dependentSequences) const {
+        std::int64_t availableSequence = detail::getMinimumSequence(dependentSequences);
+        if (availableSequence >= sequence) {
+            return availableSequence; // no need to wait -> nothing to learn
+        }
+
+        const std::uint32_t spinBudget = _spinBudget.load(std::memory_order_relaxed);
+        std::uint32_t       nSpins     = 0U;
+        std::uint32_t       nYields    = 0U;
+        bool                parked     = false;
+        while ((availableSequence = detail::getMinimumSequence(dependentSequences)) < sequence) {
+            // optional: barrier check alert
+            if (nSpins < spinBudget) {
+                ++nSpins;
+                cpuRelax();
+            } else if (nYields < _maxYields || cursor.value() >= sequence) {
+                ++nYields;
+                std::this_thread::yield();
+            } else {
+                park(sequence, cursor);
+                parked = true;
+            }
+        }
+
+        std::uint32_t newBudget;
+        if (parked) { // idle producer -> spinning is a waste of CPU
+            newBudget = spinBudget / 2U;
+        } else if (nYields > 0U) { // data arrived shortly after spinning stopped -> spin longer
+            newBudget = spinBudget > _maxSpins / 2U ? _maxSpins : 2U * spinBudget;
+        } else { // data arrived while spinning -> exponential moving average of (twice) the needed spins
+            newBudget = static_cast<std::uint32_t>((7UL * spinBudget + 2UL * nSpins) / 8UL);
+        }
+        _spinBudget.store(std::clamp(newBudget, kMinSpins, _maxSpins), std::memory_order_relaxed);
+
+        return availableSequence;
+    }
+
+    void signalAllWhenBlocking(Sequence &cursor) noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst); // pairs with the fence in 'park'
+        if (_nParked.load(std::memory_order_relaxed) > 0) {
+            cursor.notify_all();
+        }
+    }
+
+    [[nodiscard]] std::uint32_t spinBudget() const noexcept { return _spinBudget.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t parkCount() const noexcept { return _nParkings.load(std::memory_order_relaxed); }
+};
+static_assert(WaitStrategy<AdaptiveWaitStrategy>);
+static_assert(hasSignalAllWhenBlockingOnCursor<AdaptiveWaitStrategy>);
+static_assert(!hasSignalAllWhenBlocking<AdaptiveWaitStrategy>);
+
 struct NO_SPIN_WAIT {};
 
 template<typename SPIN_WAIT = NO_SPIN_WAIT>
@@ -69,6 +69,17 @@ struct BlockingIO {
     [[maybe_unused]] constexpr static bool useIoThread = UseIoThread;
 };
 
+/**
+ * @brief Annotates `processOne(...)`-based block, allowing a processed chunk to span several input tags.
+ *
+ * By default, chunks end before the next tag and a tag on the first sample limits the chunk to that sample, so that
+ * tag-dense streams are processed in very small chunks. With this annotation the chunk is only limited by the port
+ * constraints and an EOS tag. Tags inside the chunk are applied (settings) and forwarded at their exact offsets
+ * between consecutive `processOne` sub-ranges. The sub-ranges are still processed in SIMD/bulk fashion.
+ * N.B. `mergedInputTag()` stays valid for the whole sub-range that starts at the tag and not only for the tagged sample.
+ */
+struct ChunkAcrossTags {};
+
 /**
  * @brief Annotates block, indicating to perform resampling based on the provided ratio.
  *
@@ -6,6 +6,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <deque>
+#include <exception>
 #include <functional>
 #include <future>
 #include <iostream>
@@ -16,6 +17,7 @@
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -752,6 +754,46 @@ inline std::atomic<uint64_t> BasicThreadPool::_globalPoolId = 0U;
 inline std::atomic<uint64_t> BasicThreadPool::_taskID       = 0U;
 static_assert(ThreadPool<BasicThreadPool>);
 
+/**
+ * invokes 'func(index)' for all indices in [0, nItems) distributed over up to 'pool.maxThreads()' tasks with the calling thread participating.
+ * Indices are claimed dynamically (i.e. uneven per-item costs are balanced) and the call returns after all items have been processed.
+ * The first exception thrown by 'func' is re-thrown after all tasks have finished (remaining items are still processed).
+ */
+template<std::invocable<std::size_t> Callable>
+void
+parallelFor(BasicThreadPool &pool, std::size_t nItems, Callable &&func) {
+    std::atomic_size_t nextIndex{ 0UZ };
+    auto               worker = [&nextIndex, nItems, &func] {
+        std::exception_ptr firstException;
+        for (std::size_t index = nextIndex.fetch_add(1UZ, std::memory_order_relaxed); index < nItems; index = nextIndex.fetch_add(1UZ, std::memory_order_relaxed)) {
+            try {
+                std::invoke(func, index);
+            } catch (...) {
+                if (!firstException) {
+                    firstException = std::current_exception();
+                }
+            }
+        }
+        return firstException;
+    };
+
+    const std::size_t                            nTasks = std::min(static_cast<std::size_t>(pool.maxThreads()), nItems);
+    std::vector<std::future<std::exception_ptr>> tasks;
+    tasks.reserve(nTasks);
+    for (std::size_t i = 1UZ; i < nTasks; ++i) {
+        tasks.emplace_back(pool.execute(worker));
+    }
+    std::exception_ptr firstException = worker();
+    for (auto &task : tasks) {
+        if (auto exception = task.get(); exception && !firstException) {
+            firstException = exception;
+        }
+    }
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+
 } // namespace gr::thread_pool
 
 #endif // THREADPOOL_HPP
@@ -0,0 +1,194 @@
+#include <boost/ut.hpp>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/BinarySerialiser.hpp>
+#include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/Message.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+const boost::ut::suite BinarySerialiserTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+    using namespace gr::serialiser;
+    using namespace std::string_literals;
+
+    "var-int encoding"_test = [] {
+        BinaryWriter writer;
+        for (std::uint64_t value : { 0UL, 1UL, 127UL, 128UL, 300UL, 1UL << 35, std::numeric_limits<std::uint64_t>::max() }) {
+            writer.writeVarInt(value);
+        }
+        for (std::int64_t value : { 0L, -1L, 1L, -64L, 64L, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max() }) {
+            writer.writeSignedVarInt(value);
+        }
+        expect(eq(writer.data()[0], std::uint8_t{ 0 })) << "zero is a single byte";
+
+        const auto   bytes = writer.release();
+        BinaryReader reader(bytes);
+        for (std::uint64_t value : { 0UL, 1UL, 127UL, 128UL, 300UL, 1UL << 35, std::numeric_limits<std::uint64_t>::max() }) {
+            expect(eq(reader.readVarInt(), value));
+        }
+        for (std::int64_t value : { 0L, -1L, 1L, -64L, 64L, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max() }) {
+            expect(eq(reader.readSignedVarInt(), value));
+        }
+        expect(eq(reader.available(), 0UZ));
+    };
+
+    "property_map round-trip"_test = [] {
+        const property_map map{ { "bool", true },
+                                { "int32", std::int32_t{ -42 } },
+                                { "uint64", std::uint64_t{ 42 } },
+                                { "float", 1.5f },
+                                { "complex", std::complex<double>{ 1.0, -2.0 } },
+                                { "string", "hello"s },
+                                { "floats", std::vector<float>{ 1.f, 2.f, 3.f } },
+                                { "strings", std::vector<std::string>{ "a", "bc" } },
+                                { "nested", property_map{ { "string", "world"s }, { "float", 2.5f } } } };
+
+        for (const auto keyEncoding : { KeyEncoding::Inline, KeyEncoding::Interned }) {
+            const auto bytes = serialise(map, keyEncoding);
+            expect(deserialise<property_map>(bytes) == map) << fmt::format("keyEncoding: {}", static_cast<int>(keyEncoding));
+        }
+        expect(lt(serialise(map, KeyEncoding::Interned).size(), serialise(map, KeyEncoding::Inline).size())) << "interned keys are more compact";
+    };
+
+    "Tag round-trip"_test = [] {
+        const Tag tag(-1234, { { "sample_rate", 1e6f }, { "signal_name", "IQ"s } });
+        const Tag copy = deserialise<Tag>(serialise(tag));
+        expect(eq(copy.index, tag.index));
+        expect(copy.map == tag.map);
+    };
+
+    "Message round-trip"_test = [] {
+        Message msg;
+        msg.cmd             = message::Command::Set;
+        msg.serviceName     = "block#1";
+        msg.clientRequestID = "42";
+        msg.endpoint        = "Settings";
+        msg.data            = property_map{ { "scaling_factor", 2.0f } };
+
+        const Message copy = deserialise<Message>(serialise(msg));
+        expect(eq(copy.protocol, msg.protocol));
+        expect(copy.cmd == msg.cmd);
+        expect(eq(copy.serviceName, msg.serviceName));
+        expect(eq(copy.clientRequestID, msg.clientRequestID));
+        expect(eq(copy.endpoint, msg.endpoint));
+        expect(copy.data.has_value());
+        expect(copy.data.value() == msg.data.value());
+
+        Message errorMessage;
+        errorMessage.data       = std::unexpected(Error("some error"));
+        const Message errorCopy = deserialise<Message>(serialise(errorMessage));
+        expect(not errorCopy.data.has_value());
+        expect(eq(errorCopy.data.error().message, "some error"s));
+        expect(errorCopy.data.error().errorTime == errorMessage.data.error().errorTime);
+    };
+
+    "DataSet round-trip"_test = [] {
+        DataSet<float> dataSet;
+        dataSet.timestamp        = 123456789;
+        dataSet.axis_names       = { "time" };
+        dataSet.axis_units       = { "s" };
+        dataSet.axis_values      = { { 0.f, 1.f, 2.f } };
+        dataSet.extents          = { 3 };
+        dataSet.layout           = "custom"s;
+        dataSet.signal_names     = { "signal" };
+        dataSet.signal_units     = { "V" };
+        dataSet.signal_values    = { 1.f, 2.f, 3.f };
+        dataSet.signal_ranges    = { { 0.f, 3.f } };
+        dataSet.meta_information = { { { "key", "value"s } } };
+        dataSet.timing_events    = { { Tag(1, { { "trigger_name", "A"s } }) } };
+
+        const auto copy = deserialise<DataSet<float>>(serialise(dataSet));
+        expect(eq(copy.timestamp, dataSet.timestamp));
+        expect(copy.axis_names == dataSet.axis_names);
+        expect(copy.axis_values == dataSet.axis_values);
+        expect(copy.extents == dataSet.extents);
+        expect(std::get<std::string>(copy.layout) == "custom"s);
+        expect(copy.signal_values == dataSet.signal_values);
+        expect(copy.signal_errors.empty());
+        expect(copy.signal_ranges == dataSet.signal_ranges);
+        expect(copy.meta_information == dataSet.meta_information);
+        expect(copy.timing_events == dataSet.timing_events);
+    };
+
+    "zero-copy vector view"_test = [] {
+        BinaryWriter writer;
+        writer.write(std::uint8_t{ 7 }); // misalign payload on purpose
+        encode(writer, pmtv::pmt(std::vector<double>{ 1.0, 2.0, 3.0 }));
+        const auto bytes = writer.release();
+
+        BinaryReader reader(bytes);
+        expect(eq(reader.read<std::uint8_t>(), std::uint8_t{ 7 }));
+        const std::span<const double> view = decodePmtView<double>(reader);
+        expect(eq(view.size(), 3UZ));
+        expect(eq(view[2], 3.0));
+        expect(eq(reinterpret_cast<std::uintptr_t>(view.data()) % alignof(double), 0UZ)) << "payload is aligned";
+        expect(view.data() >= reinterpret_cast<const double *>(bytes.data()) && view.data() < reinterpret_cast<const double *>(bytes.data() + bytes.size())) << "view points into buffer";
+    };
+
+    "malformed input"_test = [] {
+        const auto bytes = serialise(Tag(0, { { "key", "value"s } }));
+        for (std::size_t length = 0UZ; length < bytes.size(); ++length) {
+            expect(throws([&] { std::ignore = deserialise<Tag>(std::span(bytes).first(length)); })) << fmt::format("truncated at {} of {}", length, bytes.size());
+        }
+    };
+
+    "nesting depth limit"_test = [] {
+        const auto nested = [](std::size_t depth) {
+            property_map map{ { "leaf", 42 } };
+            for (std::size_t i = 0UZ; i < depth; ++i) {
+                map = property_map{ { "key", std::move(map) } };
+            }
+            return map;
+        };
+        const property_map shallow = nested(kMaxNestingDepth - 1UZ);
+        expect(deserialise<property_map>(serialise(shallow)) == shallow);
+        expect(throws<gr::exception>([&] { std::ignore = deserialise<property_map>(serialise(nested(kMaxNestingDepth + 1UZ))); }));
+        expect(throws<gr::exception>([&] { std::ignore = deserialise<pmtv::pmt>(serialise(pmtv::pmt(nested(kMaxNestingDepth + 1UZ)))); }));
+    };
+
+    "invalid message command"_test = [] {
+        Message    msg;
+        auto       bytes           = serialise(msg);
+        const auto commandPosition = 1UZ + msg.protocol.size(); // N.B. after the length-prefixed protocol string
+        expect(eq(bytes[commandPosition], static_cast<std::uint8_t>(msg.cmd)));
+        bytes[commandPosition] = 0xFF;
+        expect(throws<gr::exception>([&] { std::ignore = deserialise<Message>(bytes); }));
+    };
+
+    "oversized element counts"_test = [] { // N.B. must be rejected before sizing any container (i.e. no std::bad_alloc)
+        constexpr std::uint64_t kHugeCount = 1UL << 40;
+        const auto              withCount  = [](auto &&prefix) {
+            BinaryWriter writer;
+            prefix(writer);
+            writer.writeVarInt(kHugeCount);
+            writer.writeString("padding");
+            return writer.release();
+        };
+
+        const auto map = withCount([](BinaryWriter &) {});
+        expect(throws<gr::exception>([&] { std::ignore = deserialise<property_map>(map); })) << "property_map entries";
+
+        const auto strings = withCount([](BinaryWriter &writer) { writer.write(static_cast<std::uint8_t>(pmtv::pmt(std::vector<std::string>{}).index())); });
+        expect(throws<gr::exception>([&] { std::ignore = deserialise<pmtv::pmt>(strings); })) << "std::vector<std::string>";
+
+        const auto bools = withCount([](BinaryWriter &writer) { writer.write(static_cast<std::uint8_t>(pmtv::pmt(std::vector<bool>{}).index())); });
+        expect(throws<gr::exception>([&] { std::ignore = deserialise<pmtv::pmt>(bools); })) << "std::vector<bool>";
+
+        const auto axisNames = withCount([](BinaryWriter &writer) { writer.writeSignedVarInt(0); });
+        expect(throws<gr::exception>([&] { std::ignore = deserialise<DataSet<float>>(axisNames); })) << "DataSet axis names";
+
+        DataSet<float> dataSet;
+        auto           valid = serialise(dataSet);
+        valid.resize(valid.size() - 2UZ); // N.B. trailing meta_information and timing_events counts (both 0)
+        BinaryWriter tail;
+        tail.writeVarInt(kHugeCount);
+        valid.insert(valid.end(), tail.data().begin(), tail.data().end());
+        expect(throws<gr::exception>([&] { std::ignore = deserialise<DataSet<float>>(valid); })) << "DataSet meta_information";
+    };
+};
+
+int
+main() { /* tests are statically executed */
+}
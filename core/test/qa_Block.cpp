@@ -839,6 +839,45 @@ const boost::ut::suite _portMetaInfoTests = [] {
     };
 };
 
+const boost::ut::suite _simdAlignmentTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+    using namespace gr::testing;
+
+    "simd alignment helper"_test = [] {
+        constexpr auto        width     = std::integral_constant<std::size_t, stdx::native_simd<float>::size()>{};
+        constexpr std::size_t alignment = stdx::memory_alignment_v<stdx::native_simd<float>>;
+        static_assert(alignment == stdx::memory_alignment_v<meta::simdize<float, width>>);
+        alignas(4UZ * alignment) std::array<float, 64> data{};
+        for (std::size_t offset = 0UZ; offset < 16UZ; ++offset) {
+            const std::size_t nPeel = simd_alignment_offset(data, offset);
+            expect(lt(nPeel, alignment / sizeof(float))) << "peels at most one native vector";
+            expect(is_simd_aligned(width, std::tuple{ std::span(data) }, offset + nPeel)) << fmt::format("offset {} + peel {}", offset, nPeel);
+        }
+        expect(is_simd_aligned(width, std::tuple{ std::span(data), std::span(data) }, 0UZ));
+        expect(alignment == sizeof(float) || !is_simd_aligned(width, std::tuple{ std::span(data), std::span(data).subspan(1UZ) }, 0UZ)) << "ports with different misalignment";
+    };
+
+    "SIMD processOne with misaligned chunk starts"_test = [] {
+        constexpr gr::Size_t n_samples = 1024;
+        Graph                testGraph;
+        auto                &src = testGraph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", n_samples }, { "mark_tag", false } });
+        src.tags                 = { { 1, { { "key", "value@1" } } }, { 4, { { "key", "value@4" } } }, { 11, { { "key", "value@11" } } }, { 30, { { "key", "value@30" } } }, { 97, { { "key", "value@97" } } }, { 515, { { "key", "value@515" } } } };
+        auto &monitor            = testGraph.emplaceBlock<TagMonitor<float, ProcessFunction::USE_PROCESS_ONE_SIMD>>({ { "n_samples_expected", n_samples } });
+        auto &sink               = testGraph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>();
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(monitor)));
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(monitor).to<"in">(sink)));
+
+        scheduler::Simple sched{ std::move(testGraph) };
+        expect(sched.runAndWait().has_value());
+
+        // chunks start at the tag positions -> the SIMD loop needs to peel the head of each chunk to reach aligned loads/stores
+        expect(eq(monitor.samples.size(), static_cast<std::size_t>(n_samples)));
+        expect(std::ranges::equal(monitor.samples, std::views::iota(0U, n_samples) | std::views::transform([](auto i) { return static_cast<float>(i); })));
+        expect(std::ranges::equal(sink.samples, monitor.samples));
+    };
+};
+
 int
 main() { /* not needed for UT */
 }
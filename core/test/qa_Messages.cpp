@@ -178,6 +178,55 @@ const boost::ut::suite MessagesTests = [] {
             };
         };
 
+        "Block<T>-level performance counter tests"_test = [] {
+            gr::Graph flow;
+            auto     &source  = flow.emplaceBlock<TagSource<int, ProcessFunction::USE_PROCESS_BULK>>({ { "n_samples_max", gr::Size_t(1000) }, { "mark_tag", false } });
+            auto     &process = flow.emplaceBlock<TestBlock<int>>({ { "name", "UnitTestBlock" } });
+            auto     &sink    = flow.emplaceBlock<TagSink<int, ProcessFunction::USE_PROCESS_BULK>>({ { "log_samples", false } });
+            source.tags       = { { 100, { { "key", "value" } } } };
+            expect(eq(ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(process)));
+            expect(eq(ConnectionResult::SUCCESS, flow.connect<"out">(process).to<"in">(sink)));
+
+            auto scheduler = scheduler::Simple(std::move(flow));
+            expect(scheduler.runAndWait().has_value());
+
+            gr::MsgPortOut toBlock;
+            gr::MsgPortIn  fromBlock;
+            expect(eq(ConnectionResult::SUCCESS, toBlock.connect(process.msgIn)));
+            expect(eq(ConnectionResult::SUCCESS, process.msgOut.connect(fromBlock)));
+
+            "get"_test = [&] {
+                sendMessage<Get>(toBlock, process.unique_name /* serviceName */, block::property::kPerformanceCounters /* endpoint */, {} /* data  */, "client#42");
+                expect(nothrow([&] { process.processScheduledMessages(); })) << "manually execute processing of messages";
+
+                expect(eq(fromBlock.streamReader().available(), 1UZ)) << "didn't receive reply message";
+                const Message reply = returnReplyMsg(fromBlock);
+                expect(reply.cmd == Final) << fmt::format("mismatch between reply.cmd = {} and expected {} command", reply.cmd, Final);
+                expect(eq(reply.endpoint, std::string(block::property::kPerformanceCounters)));
+                expect(reply.data.has_value());
+                const property_map &counters = reply.data.value();
+                for (const char *key : { "calls", "samples_in", "samples_out", "tags", "work_time_ns", "blocked_on_input_ns", "blocked_on_output_ns", "insufficient_input", "insufficient_output" }) {
+                    expect(counters.contains(key)) << fmt::format("missing counter '{}'", key);
+                }
+                expect(ge(std::get<std::uint64_t>(counters.at("calls")), 2U)) << "tag splits the stream into at least two chunks";
+                expect(eq(std::get<std::uint64_t>(counters.at("samples_in")), 1000U));
+                expect(eq(std::get<std::uint64_t>(counters.at("samples_out")), 1000U));
+                expect(ge(std::get<std::uint64_t>(counters.at("tags")), 1U));
+                expect(gt(std::get<std::uint64_t>(counters.at("work_time_ns")), 0U));
+            };
+
+            "set - reset"_test = [&] {
+                sendMessage<Set>(toBlock, process.unique_name /* serviceName */, block::property::kPerformanceCounters /* endpoint */, { { "reset", true } } /* data  */, "client#42");
+                expect(nothrow([&] { process.processScheduledMessages(); })) << "manually execute processing of messages";
+                expect(eq(fromBlock.streamReader().available(), 1UZ)) << "didn't receive reply message";
+                const Message reply = returnReplyMsg(fromBlock);
+                expect(reply.data.has_value());
+                expect(eq(std::get<std::uint64_t>(reply.data.value().at("samples_in")), 1000U)) << "reply contains the counters before the reset";
+                expect(eq(std::get<std::uint64_t>(process.performanceCounters.get().at("samples_in")), 0U));
+                expect(eq(std::get<std::uint64_t>(process.performanceCounters.get().at("calls")), 0U));
+            };
+        };
+
         "Block<T>-level echo tests"_test = [] {
             gr::MsgPortOut toBlock;
             TestBlock<int> unitTestBlock({ { "name", "UnitTestBlock" } });
@@ -0,0 +1,144 @@
+#include <boost/ut.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <gnuradio-4.0/Profiler.hpp>
+
+namespace {
+std::size_t
+countOccurrences(std::string_view text, std::string_view pattern) {
+    std::size_t count = 0UZ;
+    for (auto pos = text.find(pattern); pos != std::string_view::npos; pos = text.find(pattern, pos + pattern.size())) {
+        ++count;
+    }
+    return count;
+}
+} // namespace
+
+const boost::ut::suite ProfilerTests = [] {
+    using namespace boost::ut;
+    using namespace gr::profiling;
+
+    "trace event record"_test = [] {
+        static_assert(std::is_trivially_copyable_v<detail::TraceEvent>);
+        expect(eq(sizeof(detail::TraceEvent), 64UZ));
+        expect(eq(alignof(detail::TraceEvent), 64UZ));
+    };
+
+    "binary dump and offline conversion"_test = [] {
+        const auto fileName = (std::filesystem::temp_directory_path() / fmt::format("qa_Profiler.{}.grtrace", getpid())).string();
+        {
+            Profiler profiler(Options{ .output_file = fileName, .output_mode = OutputMode::BinaryFile, .events_per_thread = 1UZ << 16U });
+            auto    &handler = profiler.forThisThread();
+            expect(eq(&handler, &profiler.forThisThread())) << "per-thread handler is cached";
+            {
+                [[maybe_unused]] auto complete = handler.startCompleteEvent("complete", "cat1", { { "key", "value" } });
+                auto                  async    = handler.startAsyncEvent("async", {}, { { "arg1", 2 }, { "arg2", "hello" } });
+                async.step();
+                async.step();
+            }
+            handler.instantEvent("instant");
+            for (int i = 0; i < 10; ++i) {
+                handler.counterEvent("counter", {}, { { "n", i } });
+            }
+            std::thread([&profiler] { profiler.forThisThread().instantEvent("other thread"); }).join();
+            expect(eq(profiler.lostEvents(), 0UZ));
+        }
+
+        std::ifstream      binary(fileName, std::ios::binary);
+        std::ostringstream json;
+        const auto         nEvents = convertToChromeTrace(binary, json);
+        std::filesystem::remove(fileName);
+
+        expect(eq(nEvents, 1UZ + 4UZ + 1UZ + 10UZ + 1UZ));
+        const std::string out = json.str();
+        expect(out.starts_with("[\n") && out.ends_with("\n]\n"));
+        expect(eq(countOccurrences(out, R"("name": "complete", "ph": "X")"), 1UZ));
+        expect(eq(countOccurrences(out, R"("cat": "cat1", "args": {"key":"value"})"), 1UZ));
+        expect(eq(countOccurrences(out, R"("name": "async", "ph": "n")"), 2UZ));
+        expect(eq(countOccurrences(out, R"("args": {"arg1":2,"arg2":"hello"})"), 1UZ));
+        expect(eq(countOccurrences(out, R"("name": "counter", "ph": "C")"), 10UZ));
+        expect(eq(countOccurrences(out, R"("args": {"n":9})"), 1UZ));
+        expect(eq(countOccurrences(out, R"("name": "other thread", "ph": "I", )"), 1UZ));
+        expect(eq(countOccurrences(out, R"("tid": 1,)"), 1UZ)) << "second thread gets its own index";
+    };
+
+    "JSON output"_test = [] {
+        const auto fileName = (std::filesystem::temp_directory_path() / fmt::format("qa_Profiler.{}.trace", getpid())).string();
+        {
+            Profiler profiler(Options{ .output_file = fileName, .output_mode = OutputMode::File, .events_per_thread = 1UZ << 16U });
+            [[maybe_unused]] auto event = profiler.forThisThread().startCompleteEvent("complete");
+        }
+        std::ifstream     file(fileName);
+        const std::string out{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        std::filesystem::remove(fileName);
+        expect(eq(countOccurrences(out, R"("name": "complete", "ph": "X")"), 1UZ));
+    };
+
+    "ring overflow"_test = [] {
+        const auto fileName = (std::filesystem::temp_directory_path() / fmt::format("qa_Profiler.{}.overflow.grtrace", getpid())).string();
+        std::uint64_t nLost    = 0U;
+        {
+            Profiler profiler(Options{ .output_file = fileName, .output_mode = OutputMode::BinaryFile, .events_per_thread = 16UZ });
+            auto    &handler = profiler.forThisThread();
+            for (int i = 0; i < 1000; ++i) { // N.B. much faster than the drain interval
+                handler.instantEvent("instant");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            nLost = profiler.lostEvents();
+        }
+        std::ifstream      binary(fileName, std::ios::binary);
+        std::ostringstream json;
+        const auto         nEvents = convertToChromeTrace(binary, json);
+        std::filesystem::remove(fileName);
+        expect(gt(nLost, 0U));
+        expect(eq(nEvents + nLost, 1000UZ)) << "every event is either written or accounted as lost";
+    };
+
+    "intern re-used buffer"_test = [] {
+        Profiler    profiler(Options{ .output_file = "/dev/null", .output_mode = OutputMode::File });
+        auto       &handler = profiler.forThisThread();
+        std::string buffer  = "event_a";
+        const auto  idA     = handler.intern(buffer);
+        buffer.replace(0UZ, buffer.size(), "event_b"); // same address and length, different content
+        const auto idB = handler.intern(buffer);
+        expect(neq(idA, idB)) << "cache must not hit on pointer and size alone";
+        expect(eq(handler.intern("event_a"), idA));
+    };
+
+    "numeric arguments are stored inline"_test = [] {
+        Profiler   profiler(Options{ .output_file = "/dev/null", .output_mode = OutputMode::File, .events_per_thread = 1UZ << 16U });
+        auto      &handler = profiler.forThisThread();
+        const auto idFirst = handler.intern("first");
+        for (int i = 0; i < 1000; ++i) {
+            handler.counterEvent("counter", "cat", { { "n", i }, { "ratio", 0.5 * i } });
+            [[maybe_unused]] auto complete = handler.startCompleteEvent("complete", {}, { { "size", i } });
+        }
+        // N.B. string ids are allocated sequentially, only the names, categories and keys may have been added in between
+        expect(le(handler.intern("last") - idFirst, 7U)) << "varying values must not grow the interned strings";
+    };
+
+    "handler re-use across profilers"_test = [] {
+        Profiler profilerA(Options{ .output_file = "/dev/null", .output_mode = OutputMode::File });
+        Profiler profilerB(Options{ .output_file = "/dev/null", .output_mode = OutputMode::File });
+        auto    *handlerA = &profilerA.forThisThread();
+        auto    *handlerB = &profilerB.forThisThread();
+        for (int i = 0; i < 10; ++i) { // e.g. pool thread alternating between schedulers
+            expect(eq(handlerA, &profilerA.forThisThread()));
+            expect(eq(handlerB, &profilerB.forThisThread()));
+        }
+        std::thread([&profilerA, handlerA] { expect(neq(handlerA, &profilerA.forThisThread())) << "other thread gets its own handler"; }).join();
+    };
+
+    "invalid binary trace"_test = [] {
+        std::istringstream invalid("not a trace");
+        std::ostringstream json;
+        expect(throws([&] { std::ignore = convertToChromeTrace(invalid, json); }));
+    };
+};
+
+int
+main() { /* tests are statically executed */
+}
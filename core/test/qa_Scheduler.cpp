@@ -1,5 +1,8 @@
 #include <boost/ut.hpp>
 
+#include <chrono>
+#include <thread>
+
 #include <gnuradio-4.0/Scheduler.hpp>
 
 using TraceVectorType = std::vector<std::string>;
@@ -303,6 +306,45 @@ struct LifecycleBlock : public gr::Block<LifecycleBlock<T>> {
 
 ENABLE_REFLECTION_FOR_TEMPLATE(LifecycleBlock, in, out);
 
+template<typename T>
+struct InfiniteRamp : public gr::Block<InfiniteRamp<T>> {
+    gr::PortOut<T> out;
+    T              n_samples_produced{};
+
+    gr::work::Status
+    processBulk(gr::PublishableSpan auto &output) noexcept {
+        for (auto &sample : output) {
+            sample = n_samples_produced++;
+        }
+        output.publish(output.size());
+        return gr::work::Status::OK;
+    }
+};
+
+ENABLE_REFLECTION_FOR_TEMPLATE(InfiniteRamp, out);
+
+template<typename T>
+struct ContinuitySink : public gr::Block<ContinuitySink<T>> {
+    gr::PortIn<T> in;
+    std::size_t   count = 0UZ;
+    T             firstSample{};
+    T             lastSample{};
+    bool          contiguous = true;
+
+    void
+    processOne(T sample) noexcept {
+        if (count == 0UZ) {
+            firstSample = sample;
+        } else {
+            contiguous = contiguous && sample == lastSample + T{ 1 };
+        }
+        lastSample = sample;
+        count++;
+    }
+};
+
+ENABLE_REFLECTION_FOR_TEMPLATE(ContinuitySink, in);
+
 const boost::ut::suite SchedulerTests = [] {
     using namespace boost::ut;
     using namespace gr;
@@ -474,7 +516,127 @@ const boost::ut::suite SchedulerTests = [] {
         expect(eq(lifecycleBlock.resume_count, 0));
         expect(eq(lifecycleBlock.reset_count, 1));
     };
-};
+
+    "EdgeTelemetry"_test = [&threadPool] {
+        using namespace gr::message;
+        using scheduler               = gr::scheduler::Simple<>;
+        std::shared_ptr<Tracer> trace = std::make_shared<Tracer>();
+        auto                    sched = scheduler{ getGraphLinear(trace), threadPool };
+        expect(sched.runAndWait().has_value());
+
+        std::size_t nEdges = 0UZ;
+        sched.graph().forEachEdge([&nEdges](const gr::Edge &edge) {
+            const gr::EdgeTelemetry &telemetry = edge.bufferTelemetry();
+            expect(!telemetry.label.empty());
+            expect(ge(telemetry.nSamples, 1U)) << telemetry.label;
+            expect(gt(telemetry.capacity, 0UZ)) << telemetry.label;
+            expect(le(telemetry.highWaterMark, telemetry.capacity)) << telemetry.label;
+            expect(le(telemetry.nWriterStalls + telemetry.nReaderStarvations, 2U * telemetry.nSamples)) << telemetry.label;
+            nEdges++;
+        });
+        expect(eq(nEdges, 3UZ));
+
+        gr::MsgPortOut toScheduler;
+        gr::MsgPortIn  fromScheduler;
+        expect(eq(gr::ConnectionResult::SUCCESS, toScheduler.connect(sched.msgIn)));
+        expect(eq(gr::ConnectionResult::SUCCESS, sched.msgOut.connect(fromScheduler)));
+        sendMessage<Command::Get>(toScheduler, sched.unique_name, gr::scheduler::property::kEdgeTelemetry, {}, "client#42");
+        sched.processScheduledMessages();
+
+        expect(eq(fromScheduler.streamReader().available(), 1UZ)) << "didn't receive reply message";
+        gr::ConsumableSpan auto span  = fromScheduler.streamReader().get<gr::SpanReleasePolicy::ProcessAll>(1UZ);
+        const gr::Message       reply = span[0];
+        expect(span.consume(1UZ));
+        expect(eq(reply.endpoint, std::string(gr::scheduler::property::kEdgeTelemetry)));
+        expect(reply.data.has_value());
+        expect(eq(reply.data.value().size(), 3UZ));
+        for (const auto &[label, value] : reply.data.value()) {
+            const auto *edge = std::get_if<gr::property_map>(&value);
+            expect(edge != nullptr && edge->contains("fill_level") && edge->contains("high_water_mark") && edge->contains("writer_stalls") && edge->contains("reader_starvations")) << label;
+        }
+    };
+    "RuntimeGraphModification"_test = [&threadPool]<typename TPolicy>() {
+        using namespace std::chrono_literals;
+        using scheduler = gr::scheduler::Simple<TPolicy::value>;
+        gr::Graph flow;
+
+        auto &source = flow.emplaceBlock<InfiniteRamp<std::int64_t>>();
+        auto &sink   = flow.emplaceBlock<ContinuitySink<std::int64_t>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(sink)));
+
+        auto           sched = scheduler{ std::move(flow), threadPool };
+        gr::MsgPortOut toScheduler;
+        gr::MsgPortIn  fromScheduler;
+        expect(eq(gr::ConnectionResult::SUCCESS, toScheduler.connect(sched.msgIn)));
+        expect(eq(gr::ConnectionResult::SUCCESS, sched.msgOut.connect(fromScheduler)));
+
+        ContinuitySink<std::int64_t> *tap = nullptr;
+        std::thread                   controller([&] {
+            std::this_thread::sleep_for(100ms);
+            tap             = &sched.template emplaceBlock<ContinuitySink<std::int64_t>>({ { "name", "tap" } });
+            auto &transient = sched.template emplaceBlock<ContinuitySink<std::int64_t>>({ { "name", "transient" } });
+            sched.connect(source, { "out" }, *tap, { "in" });
+            sched.connect(source, { "out" }, transient, { "in" });
+            std::this_thread::sleep_for(200ms);
+            sched.removeEdge(source, { "out" }, *tap, { "in" });
+            sched.removeBlock(transient);
+            std::this_thread::sleep_for(100ms);
+            gr::sendMessage<gr::message::Command::Set>(toScheduler, "", gr::block::property::kLifeCycleState, { { "state", std::string(magic_enum::enum_name(gr::lifecycle::State::REQUESTED_STOP)) } });
+        });
+        expect(sched.runAndWait().has_value());
+        controller.join();
+
+        expect(eq(sched.graph().blocks().size(), 3UZ)) << "transient block should have been removed";
+        expect(eq(sched.graph().edges().size(), 1UZ)) << "only the original edge should remain";
+        expect(gt(sink.count, 0UZ)) << fatal;
+        expect(sink.contiguous) << "original path must not lose samples while the graph is modified";
+        expect(eq(sink.firstSample, std::int64_t{ 0 }));
+        expect(tap != nullptr) << fatal;
+        expect(gt(tap->count, 0UZ)) << fatal;
+        expect(tap->contiguous) << "tap attached at runtime must receive a gap-free stream";
+        expect(gt(tap->firstSample, std::int64_t{ 0 })) << "tap must attach at the current write position rather than replaying the stream";
+        expect(le(tap->lastSample, sink.lastSample));
+    } | std::tuple<std::integral_constant<gr::scheduler::ExecutionPolicy, gr::scheduler::singleThreaded>, std::integral_constant<gr::scheduler::ExecutionPolicy, gr::scheduler::multiThreaded>>{};
+
+    "RuntimeReaderChurn"_test = [&threadPool] { // N.B. primarily a sanitizer target (ASAN/TSAN) for reader (de-)registration on a busy source buffer
+        using namespace std::chrono_literals;
+        using scheduler = gr::scheduler::Simple<gr::scheduler::multiThreaded>;
+        gr::Graph flow;
+
+        auto &source = flow.emplaceBlock<InfiniteRamp<std::int64_t>>();
+        auto &sink   = flow.emplaceBlock<ContinuitySink<std::int64_t>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(sink)));
+
+        auto           sched = scheduler{ std::move(flow), threadPool };
+        gr::MsgPortOut toScheduler;
+        gr::MsgPortIn  fromScheduler;
+        expect(eq(gr::ConnectionResult::SUCCESS, toScheduler.connect(sched.msgIn)));
+        expect(eq(gr::ConnectionResult::SUCCESS, sched.msgOut.connect(fromScheduler)));
+
+        constexpr std::size_t kIterations = 50UZ;
+        std::thread           controller([&] {
+            std::this_thread::sleep_for(50ms);
+            for (std::size_t i = 0UZ; i < kIterations; ++i) {
+                auto &tap = sched.template emplaceBlock<ContinuitySink<std::int64_t>>();
+                sched.connect(source, { "out" }, tap, { "in" });
+                std::this_thread::sleep_for(2ms);
+                if (i % 2UZ == 0UZ) {
+                    sched.removeEdge(source, { "out" }, tap, { "in" });
+                }
+                sched.removeBlock(tap);
+                std::this_thread::sleep_for(2ms);
+            }
+            std::this_thread::sleep_for(50ms);
+            gr::sendMessage<gr::message::Command::Set>(toScheduler, "", gr::block::property::kLifeCycleState, { { "state", std::string(magic_enum::enum_name(gr::lifecycle::State::REQUESTED_STOP)) } });
+        });
+        expect(sched.runAndWait().has_value());
+        controller.join();
+
+        expect(eq(sched.graph().blocks().size(), 2UZ)) << "all taps should have been removed";
+        expect(eq(sched.graph().edges().size(), 1UZ)) << "only the original edge should remain";
+        expect(gt(sink.count, 0UZ)) << fatal;
+        expect(sink.contiguous) << "original path must not lose samples while readers are attached and detached";
+    };
 
 int
 main() { /* tests are statically executed */
@@ -0,0 +1,166 @@
+#include <boost/ut.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/SchedulingDomain.hpp>
+
+namespace gr::scheduling_domain_test {
+
+template<typename T>
+struct Ramp : public Block<Ramp<T>> {
+    PortOut<T> out;
+    gr::Size_t n_samples_max = 0U; // 0: infinite
+    gr::Size_t n_samples     = 0U;
+
+    work::Status
+    processBulk(PublishableSpan auto &output) noexcept {
+        const std::size_t nSamples = n_samples_max == 0U ? output.size() : std::min(output.size(), static_cast<std::size_t>(n_samples_max - n_samples));
+        for (std::size_t i = 0UZ; i < nSamples; ++i) {
+            output[i] = static_cast<T>(n_samples + i);
+        }
+        n_samples += static_cast<gr::Size_t>(nSamples);
+        output.publish(nSamples);
+        return n_samples_max != 0U && n_samples == n_samples_max ? work::Status::DONE : work::Status::OK;
+    }
+};
+
+template<typename T>
+struct TracingScale : public Block<TracingScale<T>> {
+    PortIn<T>       in;
+    PortOut<T>      out;
+    T               factor = T{ 1 };
+    std::thread::id executingThread{};
+
+    [[nodiscard]] constexpr T
+    processOne(T a) noexcept {
+        executingThread = std::this_thread::get_id();
+        return a * factor;
+    }
+};
+
+template<typename T>
+struct CollectSink : public Block<CollectSink<T>> {
+    PortIn<T>       in;
+    std::vector<T>  samples;
+    std::thread::id executingThread{};
+
+    void
+    processOne(T sample) {
+        executingThread = std::this_thread::get_id();
+        samples.push_back(sample);
+    }
+};
+
+template<typename T>
+struct CountingSink : public Block<CountingSink<T>> {
+    PortIn<T>   in;
+    std::size_t count = 0UZ;
+    T           lastSample{};
+
+    void
+    processOne(T sample) {
+        count++;
+        lastSample = sample;
+    }
+};
+
+} // namespace gr::scheduling_domain_test
+
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::scheduling_domain_test::Ramp, out, n_samples_max);
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::scheduling_domain_test::TracingScale, in, out, factor);
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::scheduling_domain_test::CollectSink, in);
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::scheduling_domain_test::CountingSink, in);
+
+const boost::ut::suite SchedulingDomainTests = [] {
+    using namespace boost::ut;
+    using namespace gr::scheduling_domain_test;
+    using gr::thread_pool::BasicThreadPool;
+
+    "sub-graph executed in its own domain"_test = []<typename TInnerPolicy>() {
+        constexpr gr::Size_t nSamples = 10'000U;
+
+        gr::Graph inner;
+        auto     &scaleA = inner.emplaceBlock<TracingScale<float>>({ { "factor", 2.f } });
+        auto     &scaleB = inner.emplaceBlock<TracingScale<float>>({ { "factor", 3.f } });
+        expect(eq(gr::ConnectionResult::SUCCESS, inner.connect<"out">(scaleA).to<"in">(scaleB)));
+
+        auto innerPool = std::make_shared<BasicThreadPool>("domain pool", gr::thread_pool::CPU_BOUND, 1, 1);
+        innerPool->setAffinityMask({ true }); // N.B. first core exists on every machine
+        auto domain = std::make_unique<gr::SchedulingDomain<gr::scheduler::Simple<TInnerPolicy::value>>>(std::move(inner), innerPool);
+        domain->exposeInput(gr::inputPort<"in">(&scaleA)).exposeOutput(gr::outputPort<"out">(&scaleB));
+        auto &innerScheduler = domain->scheduler();
+
+        gr::Graph graph;
+        auto     &source      = graph.emplaceBlock<Ramp<float>>({ { "n_samples_max", nSamples } });
+        auto     &domainBlock = graph.addBlock(std::move(domain));
+        auto     &sink        = graph.emplaceBlock<CollectSink<float>>();
+        expect(eq(domainBlock.dynamicInputPortsSize(), 1UZ));
+        expect(eq(domainBlock.dynamicOutputPortsSize(), 1UZ));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(source, 0, domainBlock, 0)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(domainBlock, 0, sink, 0)));
+
+        gr::scheduler::Simple sched{ std::move(graph) };
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(domainBlock.state(), gr::lifecycle::State::STOPPED));
+        expect(eq(innerScheduler.state(), gr::lifecycle::State::STOPPED));
+        expect(eq(sink.samples.size(), static_cast<std::size_t>(nSamples))) << fatal;
+        bool allEqual = true;
+        for (std::size_t i = 0UZ; i < nSamples; ++i) {
+            allEqual = allEqual && sink.samples[i] == 6.f * static_cast<float>(i);
+        }
+        expect(allEqual) << "samples must pass through the domain unaltered except for the inner processing";
+
+        expect(sink.executingThread == std::this_thread::get_id()) << "parent graph is single-threaded";
+        expect(scaleA.executingThread != sink.executingThread) << "inner graph must execute outside of the parent's thread";
+        expect(scaleB.executingThread != sink.executingThread) << "inner graph must execute outside of the parent's thread";
+    } | std::tuple<std::integral_constant<gr::scheduler::ExecutionPolicy, gr::scheduler::singleThreaded>, std::integral_constant<gr::scheduler::ExecutionPolicy, gr::scheduler::multiThreaded>>{};
+
+    "stop and messages are propagated into the domain"_test = [] {
+        using namespace std::chrono_literals;
+        using enum gr::message::Command;
+
+        gr::Graph inner;
+        auto     &scale  = inner.emplaceBlock<TracingScale<float>>({ { "name", "innerScale" } });
+        auto      domain = std::make_unique<gr::SchedulingDomain<gr::scheduler::Simple<>>>(std::move(inner));
+        domain->exposeInput(gr::inputPort<"in">(&scale)).exposeOutput(gr::outputPort<"out">(&scale));
+
+        gr::Graph graph;
+        auto     &source      = graph.emplaceBlock<Ramp<float>>(); // infinite
+        auto     &domainBlock = graph.addBlock(std::move(domain));
+        auto     &sink        = graph.emplaceBlock<CountingSink<float>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(source, 0, domainBlock, 0)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(domainBlock, 0, sink, 0)));
+
+        auto                                                pool = std::make_shared<BasicThreadPool>("parent pool", gr::thread_pool::CPU_BOUND, 2, 2);
+        gr::scheduler::Simple<gr::scheduler::multiThreaded> sched{ std::move(graph), pool };
+        gr::MsgPortOut                                      toScheduler;
+        gr::MsgPortIn                                       fromScheduler;
+        expect(eq(gr::ConnectionResult::SUCCESS, toScheduler.connect(sched.msgIn)));
+        expect(eq(gr::ConnectionResult::SUCCESS, sched.msgOut.connect(fromScheduler)));
+
+        std::thread controller([&toScheduler] {
+            std::this_thread::sleep_for(100ms);
+            gr::sendMessage<Set>(toScheduler, "innerScale", gr::block::property::kSetting, { { "factor", 3.f } });
+            std::this_thread::sleep_for(500ms);
+            gr::sendMessage<Set>(toScheduler, "", gr::block::property::kLifeCycleState, { { "state", std::string(magic_enum::enum_name(gr::lifecycle::State::REQUESTED_STOP)) } });
+        });
+        expect(sched.runAndWait().has_value());
+        controller.join();
+
+        expect(eq(domainBlock.state(), gr::lifecycle::State::STOPPED));
+        expect(eq(source.state(), gr::lifecycle::State::STOPPED));
+        expect(eq(scale.factor, 3.f)) << "settings message must be relayed to the inner block";
+        expect(gt(sink.count, 0UZ)) << fatal;
+        expect(eq(sink.lastSample, 3.f * static_cast<float>(sink.count - 1UZ))) << "samples after the settings change must use the new factor";
+    };
+};
+
+int
+main() { /* not needed for UT */
+}
@@ -488,6 +488,30 @@ const boost::ut::suite SettingsTests = [] {
         expect(block.name == "TestNameAlt");
         expect(eq(block.scaling_factor, 42.f));
     };
+
+    "staged settings lookup"_test = []() {
+        Graph testGraph;
+        auto &block = testGraph.emplaceBlock<TestBlock<float>>({ { "name", "TestName" } });
+        block.debug = false;
+
+        // keys of base-class and derived-class members in non-sorted order mixed with an unknown key
+        const auto notSet = block.settings().set({ { "vector_setting", std::vector<float>{ 1.f, 2.f } }, { "unknown_key", 42 }, { "name", "TestNameAlt" }, { "scaling_factor", 3.f }, { "sample_rate", -1.f } });
+        expect(eq(notSet.size(), 1UZ)) << "only the unknown key is returned";
+        expect(notSet.contains("unknown_key"));
+
+        const auto result = block.settings().applyStagedParameters();
+        expect(result.appliedParameters.contains("name"));
+        expect(result.appliedParameters.contains("scaling_factor"));
+        expect(result.appliedParameters.contains("vector_setting"));
+        expect(not result.appliedParameters.contains("sample_rate")) << "value violating limits is not applied";
+        expect(result.forwardParameters.contains("sample_rate")) << "auto-forwarded key is forwarded regardless";
+        expect(block.name == "TestNameAlt");
+        expect(eq(block.scaling_factor, 3.f));
+        expect(eq(block.vector_setting, std::vector<float>{ 1.f, 2.f }));
+        expect(eq(block.sample_rate, 1.0f));
+
+        expect(throws<std::invalid_argument>([&block] { std::ignore = block.settings().set({ { "scaling_factor", "wrong type" } }); })) << "wrong value type throws";
+    };
 };
 
 const boost::ut::suite AnnotationTests = [] {
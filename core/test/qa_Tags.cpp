@@ -30,8 +30,62 @@ static_assert(HasRequiredProcessFunction<TagMonitor<int, ProcessFunction::USE_PR
 
 static_assert(HasRequiredProcessFunction<TagSink<int, ProcessFunction::USE_PROCESS_ONE>>);
 static_assert(HasRequiredProcessFunction<TagSink<int, ProcessFunction::USE_PROCESS_BULK>>);
+
+template<typename T>
+struct DenseTagSource : public Block<DenseTagSource<T>> {
+    PortOut<T> out;
+    gr::Size_t n_samples_max{ 1024 };
+    gr::Size_t tag_interval{ 64 };
+    gr::Size_t n_samples_produced{ 0 };
+
+    work::Status
+    processBulk(PublishableSpan auto &output) noexcept {
+        const std::size_t nSamples = std::min(output.size(), static_cast<std::size_t>(n_samples_max - n_samples_produced));
+        for (std::size_t i = 0; i < nSamples; ++i) {
+            const gr::Size_t index = n_samples_produced + static_cast<gr::Size_t>(i);
+            output[i]              = static_cast<T>(index);
+            if (index % tag_interval == 0U) {
+                out.publishTag({ { "scale", static_cast<T>(index / tag_interval + 1U) } }, static_cast<Tag::signed_index_type>(i));
+            }
+        }
+        n_samples_produced += static_cast<gr::Size_t>(nSamples);
+        output.publish(nSamples);
+        return n_samples_produced < n_samples_max ? work::Status::OK : work::Status::DONE;
+    }
+};
+
+template<typename T, typename... Arguments>
+struct TaggedScale : public Block<TaggedScale<T, Arguments...>, Arguments...> {
+    PortIn<T>  in;
+    PortOut<T> out;
+    T          scale = static_cast<T>(1);
+
+    template<meta::t_or_simd<T> V>
+    [[nodiscard]] constexpr V
+    processOne(const V &a) const noexcept {
+        return a * scale;
+    }
+};
+
+template<typename T, typename... Arguments>
+struct TaggedCounter : public Block<TaggedCounter<T, Arguments...>, Arguments...> {
+    PortIn<T>  in;
+    PortOut<T> out;
+    T          scale = static_cast<T>(1);
+    gr::Size_t n_samples_produced{ 0 };
+
+    [[nodiscard]] constexpr T
+    processOne(T a) noexcept {
+        n_samples_produced++;
+        return a * scale;
+    }
+};
 } // namespace gr::testing
 
+ENABLE_REFLECTION_FOR_TEMPLATE(gr::testing::DenseTagSource, out, n_samples_max, tag_interval);
+ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T, typename... Arguments), (gr::testing::TaggedScale<T, Arguments...>), in, out, scale);
+ENABLE_REFLECTION_FOR_TEMPLATE_FULL((typename T, typename... Arguments), (gr::testing::TaggedCounter<T, Arguments...>), in, out, scale);
+
 const boost::ut::suite TagTests = [] {
     using namespace boost::ut;
     using namespace gr;
@@ -170,6 +224,51 @@ const boost::ut::suite TagPropagation = [] {
     "TagSource<float, USE_PROCESS_BULK>"_test = [&runTest] { runTest.template operator()<ProcessFunction::USE_PROCESS_BULK>(true); };
 
     "TagSource<float, USE_PROCESS_ONE>"_test = [&runTest] { runTest.template operator()<ProcessFunction::USE_PROCESS_ONE>(true); };
+
+    auto runChunkAcrossTagsTest = []<typename TReference, typename TAcrossTags>() {
+        constexpr gr::Size_t nSamples    = 8192U;
+        constexpr gr::Size_t tagInterval = 64U;
+
+        struct Result {
+            std::vector<float> samples;
+            std::vector<Tag>   tags;
+            float              scale;
+            std::uint64_t      calls;
+        };
+
+        auto runGraph = [&]<typename TBlock>() -> Result {
+            Graph testGraph;
+            auto &src   = testGraph.emplaceBlock<DenseTagSource<float>>({ { "n_samples_max", nSamples }, { "tag_interval", tagInterval } });
+            auto &block = testGraph.emplaceBlock<TBlock>();
+            auto &sink  = testGraph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>();
+            expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).template to<"in">(block)));
+            expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(block).template to<"in">(sink)));
+
+            scheduler::Simple sched{ std::move(testGraph) };
+            expect(sched.runAndWait().has_value());
+            return { sink.samples, sink.tags, block.scale, std::get<std::uint64_t>(block.performanceCounters.get().at("calls")) };
+        };
+
+        const Result reference = runGraph.template operator()<TReference>();
+        const Result across    = runGraph.template operator()<TAcrossTags>();
+
+        expect(eq(across.samples.size(), static_cast<std::size_t>(nSamples)));
+        bool samplesMatch = true;
+        for (std::size_t i = 0; i < across.samples.size(); ++i) {
+            samplesMatch = samplesMatch && across.samples[i] == static_cast<float>(i) * static_cast<float>(i / tagInterval + 1UZ);
+        }
+        expect(samplesMatch) << "tag-based settings must be applied at the exact sample offset";
+        expect(std::ranges::equal(reference.samples, across.samples));
+        expect(ge(across.tags.size(), static_cast<std::size_t>(nSamples / tagInterval)));
+        expect(equal_tag_lists(reference.tags, across.tags)) << "tags must be forwarded at the same offsets";
+        expect(eq(across.scale, static_cast<float>(nSamples / tagInterval)));
+        // N.B. the scheduler calls every block until all are done: w/o ChunkAcrossTags the block needs two calls per tag, otherwise only the sink needs one call per tag
+        expect(lt(across.calls, reference.calls)) << fmt::format("{} work calls with vs. {} without ChunkAcrossTags", across.calls, reference.calls);
+    };
+
+    "processOne chunks across tags (SIMD)"_test = [&runChunkAcrossTagsTest] { runChunkAcrossTagsTest.template operator()<TaggedScale<float>, TaggedScale<float, ChunkAcrossTags>>(); };
+
+    "processOne chunks across tags (non-const)"_test = [&runChunkAcrossTagsTest] { runChunkAcrossTagsTest.template operator()<TaggedCounter<float>, TaggedCounter<float, ChunkAcrossTags>>(); };
 };
 
 int
@@ -3,6 +3,7 @@
 #include <complex>
 #include <numeric>
 #include <ranges>
+#include <thread>
 #include <tuple>
 
 #include <boost/ut.hpp>
@@ -204,6 +205,7 @@ const boost::ut::suite WaitStrategiesTests = [] {
         expect(isWaitStrategy<SpinWaitWaitStrategy>);
         expect(isWaitStrategy<TimeoutBlockingWaitStrategy>);
         expect(isWaitStrategy<YieldingWaitStrategy>);
+        expect(isWaitStrategy<AdaptiveWaitStrategy>);
         expect(not isWaitStrategy<int>);
 
         expect(WaitStrategy<BlockingWaitStrategy>);
@@ -213,11 +215,46 @@ const boost::ut::suite WaitStrategiesTests = [] {
         expect(WaitStrategy<SpinWaitWaitStrategy>);
         expect(WaitStrategy<TimeoutBlockingWaitStrategy>);
         expect(WaitStrategy<YieldingWaitStrategy>);
+        expect(WaitStrategy<AdaptiveWaitStrategy>);
         expect(not WaitStrategy<int>);
 
         TestStruct a;
         expect(a.test());
     };
+
+    "AdaptiveWaitStrategy"_test = [] {
+        using namespace gr;
+        using namespace std::chrono_literals;
+        constexpr std::int64_t nFast = 500; // back-to-back samples
+        constexpr std::int64_t nSlow = 5;   // samples with idle gaps -> waiter needs to park
+
+        CircularBuffer<std::int32_t, std::dynamic_extent, ProducerType::Single, AdaptiveWaitStrategy> buffer(1024);
+        BufferWriter auto                                                                            writer       = buffer.new_writer();
+        BufferReader auto                                                                            reader       = buffer.new_reader(); // N.B. writer does not publish w/o readers
+        const AdaptiveWaitStrategy                                                                  &waitStrategy = buffer.wait_strategy();
+        const Sequence                                                                              &cursor       = buffer.cursor_sequence();
+        const std::vector<std::shared_ptr<Sequence>> dependents{ std::shared_ptr<Sequence>(std::shared_ptr<Sequence>{}, const_cast<Sequence *>(&cursor)) }; // non-owning
+
+        std::jthread producer([&writer] {
+            for (std::int64_t i = 0; i < nFast + nSlow; i++) {
+                if (i >= nFast) {
+                    std::this_thread::sleep_for(20ms);
+                }
+                writer.publish([i](auto w) { w[0] = static_cast<std::int32_t>(i); }, 1UZ);
+            }
+        });
+
+        bool allAvailable = true;
+        for (std::int64_t sequence = 0; sequence < nFast + nSlow; sequence++) {
+            allAvailable = allAvailable && waitStrategy.waitFor(sequence, cursor, dependents) >= sequence;
+        }
+        producer.join();
+
+        expect(allAvailable) << "waitFor(..) returned before the sequence was published";
+        expect(eq(reader.available(), static_cast<std::size_t>(nFast + nSlow)));
+        expect(gt(waitStrategy.parkCount(), 0UZ)) << "idle producer should have parked the waiter";
+        expect(lt(waitStrategy.spinBudget(), 4096U)) << "parking should reduce the spin budget";
+    };
 };
 
 const boost::ut::suite UserApiExamples = [] {
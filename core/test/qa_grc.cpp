@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -8,6 +12,7 @@
 
 #include <gnuradio-4.0/basic/common_blocks.hpp>
 #include <gnuradio-4.0/Graph_yaml_importer.hpp>
+#include <gnuradio-4.0/GraphImage.hpp>
 #include <gnuradio-4.0/Scheduler.hpp>
 
 #include <boost/ut.hpp>
@@ -283,6 +288,163 @@ connections:
             expect(false);
         }
     };
+
+    "Parallel loading of large graphs"_test = [] {
+        using namespace gr;
+        constexpr std::size_t nBlocks = detail::kParallelLoadMinBlocks + 8UZ; // -> parallel construction and connection
+
+        std::string graph_source = "blocks:\n";
+        for (std::size_t i = 0UZ; i < nBlocks; ++i) {
+            graph_source += fmt::format("  - name: counter{0}\n    id: builtin_counter\n    parameters:\n      unknown_property: {0}\n", i);
+        }
+        graph_source += "connections:\n";
+        std::set<std::string> expectedEdges;
+        for (std::size_t i = 0UZ; i + 1UZ < nBlocks; ++i) {
+            graph_source += fmt::format("  - [counter{}, 0, counter{}, 0]\n", i, i + 1UZ);
+            expectedEdges.insert(fmt::format("counter{}#0#{} - counter{}#0#{}", i, meta::invalid_index, i + 1UZ, meta::invalid_index));
+        }
+
+        try {
+            const auto     context = getContext();
+            GraphLoadStats stats;
+            auto           graph = gr::load_grc(context->loader, graph_source, &stats);
+            expect(eq(stats.nBlocks, nBlocks));
+            expect(eq(stats.nEdges, nBlocks - 1UZ));
+            expect(stats.nThreads >= 1UZ);
+            expect(eq(stats.total(), stats.parse + stats.resolve + stats.construct + stats.add + stats.connect));
+            expect(eq(collectEdges(graph), expectedEdges));
+
+            std::size_t              index = 0UZ; // blocks are added in the YAML order, independent of the construction order
+            std::vector<std::size_t> uniqueIds;
+            graph.forEachBlock([&index, &uniqueIds](const auto &block) {
+                expect(eq(block.name(), fmt::format("counter{}", index)));
+                expect(eq(std::get<std::string>(block.metaInformation().at("unknown_property")), fmt::format("{}", index)));
+                const std::string_view uniqueName = block.uniqueName();
+                uniqueIds.push_back(std::stoul(std::string(uniqueName.substr(uniqueName.rfind('#') + 1UZ))));
+                index++;
+            });
+            expect(eq(index, nBlocks));
+            expect(std::ranges::adjacent_find(uniqueIds, std::greater_equal{}) == uniqueIds.end()) << "unique ids follow the document order";
+        } catch (const std::string &e) {
+            fmt::println(std::cerr, "Unexpected exception: {}", e);
+            expect(false);
+        }
+
+        expect(throws<std::string>([&] { std::ignore = gr::load_grc(getContext()->loader, graph_source + "  - [counter0, 0, unknown, 0]\n"); }));
+        std::string unknownBlocks = "blocks:\n";
+        for (std::size_t i = 0UZ; i < nBlocks; ++i) {
+            unknownBlocks += fmt::format("  - name: block{}\n    id: {}\n", i, i == nBlocks / 2UZ ? "UnknownBlock" : "builtin_counter");
+        }
+        expect(throws<std::string>([&] { std::ignore = gr::load_grc(getContext()->loader, unknownBlocks); }));
+    };
+
+    "Binary graph image"_test = [] {
+        using namespace gr;
+        try {
+            const auto context = getContext();
+            Graph      graph_1;
+            auto      &arraySink    = graph_1.emplaceBlock<ArraySink<double>>({ { "string_setting", std::string("abc") }, { "double_vector", std::vector<double>{ 1., 2., 3. } } });
+            auto      &arraySource0 = graph_1.emplaceBlock<ArraySource<double>>();
+            auto      &arraySource1 = graph_1.emplaceBlock<ArraySource<double>>();
+            std::ignore             = graph_1.emplaceBlock<ArraySink<double>>({ { "name", std::string("unconnected") } });
+            arraySink.meta_information.value["unknown_property"] = std::string("42");
+
+            expect(eq(ConnectionResult::SUCCESS, graph_1.connect(arraySource0, { 0UZ, 1UZ }, arraySink, { 1UZ, 0UZ }, 1024UZ, -3, "custom edge")));
+            expect(eq(ConnectionResult::SUCCESS, graph_1.connect(arraySource1, { 1UZ, 0UZ }, arraySink, { 0UZ, 1UZ })));
+
+            const auto     image = save_graph_image(graph_1, 42U);
+            GraphLoadStats stats;
+            auto           graph_2 = load_graph_image(context->loader, image, &stats);
+            expect(stats.fromImage);
+            expect(eq(stats.nBlocks, 4UZ));
+            expect(eq(stats.nEdges, 2UZ));
+            expect(eq(collectBlocks(graph_1), collectBlocks(graph_2)));
+            expect(eq(collectEdges(graph_1), collectEdges(graph_2)));
+
+            std::vector<std::string> blockOrder; // stored in execution (i.e. breadth-first) order
+            graph_2.forEachBlock([&blockOrder](const auto &block) { blockOrder.emplace_back(block.name()); });
+            expect(eq(blockOrder, std::vector<std::string>{ arraySource0.name.value, arraySource1.name.value, arraySink.name.value, "unconnected" }));
+            graph_2.forEachBlock([&](const auto &block) {
+                if (block.name() == arraySink.name.value) {
+                    const auto settings = block.settings().get();
+                    expect(eq(std::get<std::string>(settings.at("string_setting")), std::string("abc")));
+                    expect(eq(std::get<std::vector<double>>(settings.at("double_vector")), std::vector<double>{ 1., 2., 3. }));
+                    expect(eq(std::get<std::string>(block.metaInformation().at("unknown_property")), std::string("42")));
+                }
+            });
+            graph_2.forEachEdge([](const auto &edge) {
+                const bool isCustom = edge.sourcePortDefinition().subIndex == 1UZ;
+                expect(eq(edge.minBufferSize(), isCustom ? 1024UZ : 65536UZ));
+                expect(eq(edge.weight(), isCustom ? -3 : 0));
+                expect(eq(edge.name(), isCustom ? std::string_view("custom edge") : std::string_view("unnamed edge")));
+            });
+
+            auto corruptImage = image;
+            corruptImage[0]   = 0U;
+            expect(throws([&] { std::ignore = load_graph_image(context->loader, corruptImage); })) << "invalid magic";
+            expect(throws([&] { std::ignore = load_graph_image(context->loader, std::span(image).first(image.size() / 2UZ)); })) << "truncated image";
+
+            serialiser::BinaryWriter oversized(serialiser::KeyEncoding::Interned, 64UZ);
+            oversized.write<std::uint32_t>(detail::kGraphImageMagic);
+            oversized.write<std::uint32_t>(detail::kGraphImageVersion);
+            oversized.write<std::uint64_t>(42U);
+            oversized.write<std::uint64_t>(0U);
+            oversized.writeVarInt(std::size_t{ 1 } << 40U);
+            const auto oversizedImage = oversized.release();
+            expect(throws([&] { std::ignore = load_graph_image(context->loader, oversizedImage); })) << "block count exceeds image size";
+        } catch (const std::string &e) {
+            fmt::println(std::cerr, "Unexpected exception: {}", e);
+            expect(false);
+        }
+    };
+
+    "Cached graph loading"_test = [] {
+        using namespace gr;
+        const auto imagePath = std::filesystem::temp_directory_path() / "qa_grc_cached_graph.grim";
+        std::filesystem::remove(imagePath);
+        try {
+            const auto     context      = getContext();
+            const auto     graph_source = std::string(test_grc);
+            GraphLoadStats stats;
+            const auto     graph_1 = load_grc_cached(context->loader, graph_source, imagePath, &stats);
+            expect(!stats.fromImage) << "no image yet";
+            expect(std::filesystem::exists(imagePath));
+
+            const auto graph_2 = load_grc_cached(context->loader, graph_source, imagePath, &stats);
+            expect(stats.fromImage);
+            expect(eq(collectBlocks(graph_1), collectBlocks(graph_2)));
+            expect(eq(collectEdges(graph_1), collectEdges(graph_2)));
+
+            const auto modified_source = graph_source + "\n# modified\n";
+            std::ignore                = load_grc_cached(context->loader, modified_source, imagePath, &stats);
+            expect(!stats.fromImage) << "YAML source changed -> stale image";
+            std::ignore = load_grc_cached(context->loader, modified_source, imagePath, &stats);
+            expect(stats.fromImage) << "image has been regenerated";
+
+            {
+                std::fstream file(imagePath, std::ios::binary | std::ios::in | std::ios::out);
+                constexpr auto offset = static_cast<std::streamoff>(offsetof(detail::GraphImageHeader, blockSetHash));
+                file.seekg(offset);
+                const auto byte = static_cast<char>(~file.get()); // N.B. emulates an image generated with a different set of known blocks/plugins
+                file.seekp(offset);
+                file.put(byte);
+            }
+            std::ignore = load_grc_cached(context->loader, modified_source, imagePath, &stats);
+            expect(!stats.fromImage) << "block set changed -> stale image";
+            std::ignore = load_grc_cached(context->loader, modified_source, imagePath, &stats);
+            expect(stats.fromImage) << "image has been regenerated for the current block set";
+            expect(std::ranges::none_of(std::filesystem::directory_iterator(imagePath.parent_path()), [&imagePath](const auto &file) { return file.path().string().starts_with(imagePath.string() + "."); })) << "no temporary files left behind";
+
+            std::ofstream(imagePath, std::ios::binary | std::ios::trunc) << "corrupt";
+            const auto graph_3 = load_grc_cached(context->loader, modified_source, imagePath, &stats);
+            expect(!stats.fromImage) << "corrupt image -> YAML fallback";
+            expect(eq(collectEdges(graph_1), collectEdges(graph_3)));
+        } catch (const std::string &e) {
+            fmt::println(std::cerr, "Unexpected exception: {}", e);
+            expect(false);
+        }
+        std::filesystem::remove(imagePath);
+    };
 };
 
 } // namespace gr::qa_grc_test
@@ -1,6 +1,11 @@
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <string_view>
 
 #include <boost/ut.hpp>
 
@@ -191,6 +196,74 @@ const boost::ut::suite BasicPluginBlocksConnectionTests = [] {
     };
 };
 
+const boost::ut::suite LazyPluginLoaderTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+
+    "LazyLoadingWithIndex"_test = [] {
+        const std::vector<std::filesystem::path> directories{ "core/test/plugins", "test/plugins", "plugins" };
+        const auto                               indexFile = std::filesystem::temp_directory_path() / "qa_plugins_test.index";
+        std::filesystem::remove(indexFile);
+
+        // N.B. plugin instances are process-wide singletons that are released by their loader -> loaders are intentionally not destroyed
+        auto *scanningLoader = new gr::PluginLoader(globalBlockRegistry(), directories, indexFile);
+        expect(!scanningLoader->plugins().empty()) << "no index -> all plugins are loaded to determine their blocks";
+        expect(!scanningLoader->failed_plugins().empty());
+        expect(std::filesystem::exists(indexFile));
+        const auto index = detail::readPluginIndex(indexFile);
+        expect(eq(index.size(), scanningLoader->plugins().size())) << "failed plugins are not indexed";
+
+        auto *lazyLoader = new gr::PluginLoader(globalBlockRegistry(), directories, indexFile);
+        expect(lazyLoader->plugins().empty()) << "all plugins are indexed -> none is loaded up-front";
+        const auto known = lazyLoader->knownBlocks();
+        for (const auto &required : { names::cout_sink, names::fixed_source, names::divide, names::multiply, names::convert }) {
+            expect(std::ranges::find(known, required) != known.end()) << required;
+        }
+
+        expect(lazyLoader->instantiate(names::fixed_source, "double") != nullptr);
+        expect(eq(lazyLoader->plugins().size(), 1UZ)) << "only the plugin providing the block is loaded";
+        expect(lazyLoader->instantiate(names::cout_sink, "double") != nullptr);
+        expect(eq(lazyLoader->plugins().size(), 1UZ)) << "same plugin";
+        auto convertFactory = lazyLoader->blockFactory(names::convert, "double,float");
+        expect(static_cast<bool>(convertFactory));
+        expect(eq(lazyLoader->plugins().size(), 2UZ));
+        expect(convertFactory({}) != nullptr);
+        expect(lazyLoader->instantiate("ThisBlockDoesNotExist", "double") == nullptr);
+        expect(eq(lazyLoader->plugins().size(), 2UZ));
+
+        std::filesystem::remove(indexFile);
+    };
+
+    "CorruptIndex"_test = [] {
+        const auto indexFile = std::filesystem::temp_directory_path() / "qa_plugins_test_corrupt.index";
+        std::ofstream(indexFile) << detail::kPluginIndexHeader << "\nplugin\tnot-a-number\n";
+        expect(detail::readPluginIndex(indexFile).empty());
+
+        detail::PluginIndex index;
+        index["/some path/with spaces.so"] = detail::PluginIndexEntry{ 42U, -7, { "good::a", "good::b" } };
+        expect(detail::writePluginIndex(indexFile, index));
+        const auto readBack = detail::readPluginIndex(indexFile);
+        expect(eq(readBack.size(), 1UZ)) << fatal;
+        const auto &entry = readBack.at("/some path/with spaces.so");
+        expect(eq(entry.fileSize, std::uintmax_t{ 42U }));
+        expect(eq(entry.lastWriteTime, std::int64_t{ -7 }));
+        expect(eq(entry.blocks, std::vector<std::string>{ "good::a", "good::b" }));
+
+        std::string content;
+        {
+            std::ifstream file(indexFile);
+            content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        for (const std::string_view truncatedAfter : { "good::a\n", "good::b\n" }) { // plugin record cut short, missing trailer
+            std::ofstream(indexFile, std::ios::trunc) << content.substr(0UZ, content.find(truncatedAfter) + truncatedAfter.size());
+            expect(detail::readPluginIndex(indexFile).empty()) << fmt::format("truncated after '{}'", truncatedAfter.substr(0UZ, truncatedAfter.size() - 1UZ));
+        }
+        std::filesystem::remove(indexFile);
+        const auto parent = indexFile.parent_path();
+        expect(std::ranges::none_of(std::filesystem::directory_iterator(parent), [&indexFile](const auto &file) { return file.path().string().starts_with(indexFile.string()); })) << "no temporary files left behind";
+    };
+};
+
 int
 main() { /* not needed for UT */
 }
@@ -1,5 +1,9 @@
 #include <boost/ut.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
 #include <gnuradio-4.0/thread/thread_pool.hpp>
 
 const boost::ut::suite ThreadPoolTests = [] {
@@ -75,6 +79,24 @@ const boost::ut::suite ThreadPoolTests = [] {
         expect(counter.load() == 2_i);
     };
 
+    "parallelFor"_test = [] {
+        gr::thread_pool::BasicThreadPool pool("parallelFor", gr::thread_pool::CPU_BOUND, 2, 4);
+        std::vector<std::atomic<int>>    visited(1000UZ);
+        gr::thread_pool::parallelFor(pool, visited.size(), [&visited](std::size_t index) { visited[index].fetch_add(1); });
+        expect(std::ranges::all_of(visited, [](const auto &count) { return count.load() == 1; })) << "every index is processed exactly once";
+
+        std::atomic<std::size_t> nProcessed{ 0UZ };
+        expect(throws<std::runtime_error>([&] {
+            gr::thread_pool::parallelFor(pool, 100UZ, [&nProcessed](std::size_t index) {
+                nProcessed.fetch_add(1UZ);
+                if (index % 10UZ == 3UZ) {
+                    throw std::runtime_error("task failure");
+                }
+            });
+        }));
+        expect(eq(nProcessed.load(), 100UZ)) << "remaining indices are processed before the exception is re-thrown";
+        expect(nothrow([&] { gr::thread_pool::parallelFor(pool, 0UZ, [](std::size_t) { throw std::runtime_error("must not be called"); }); }));
+    };
     "ThreadPool: Thread count tests"_test = [] {
         struct bounds_def {
             std::uint32_t min, max;
@@ -1,6 +1,7 @@
 #ifndef GNURADIO_TYPELIST_HPP
 #define GNURADIO_TYPELIST_HPP
 
+#include <array>
 #include <bit>
 #include <concepts>
 #include <string>
@@ -416,12 +417,14 @@ struct typelist {
     template<typename Needle>
     static constexpr std::size_t
     index_of() {
-        std::size_t result = static_cast<std::size_t>(-1);
-        gr::meta::typelist<Ts...>::for_each([&](auto index, auto &&t) {
-            if constexpr (std::is_same_v<Needle, std::remove_cvref_t<decltype(t)>>) {
-                result = index;
+        // N.B. does not instantiate Ts{} so that it can be used in constant expressions for non-literal types
+        constexpr std::array<bool, sizeof...(Ts)> matches{ std::is_same_v<Needle, Ts>... };
+        std::size_t                               result = static_cast<std::size_t>(-1);
+        for (std::size_t i = 0; i < matches.size(); ++i) {
+            if (matches[i]) {
+                result = i;
             }
-        });
+        }
         return result;
     }
 